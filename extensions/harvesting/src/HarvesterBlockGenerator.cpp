@@ -19,6 +19,7 @@
 **/
 
 #include "HarvesterBlockGenerator.h"
+#include "HarvesterBlockTemplate.h"
 #include "HarvestingUtFacadeFactory.h"
 #include "TransactionsInfoSupplier.h"
 
@@ -44,7 +45,15 @@ namespace catapult { namespace harvesting {
 			model::TransactionSelectionStrategy strategy,
 			const HarvestingUtFacadeFactory& utFacadeFactory,
 			const cache::ReadWriteUtCache& utCache) {
-		auto transactionsInfoSupplier = CreateTransactionsInfoSupplier(strategy, utCache);
+		return CreateHarvesterBlockGenerator(strategy, utFacadeFactory, utCache, utils::PartitionRunner());
+	}
+
+	BlockGenerator CreateHarvesterBlockGenerator(
+			model::TransactionSelectionStrategy strategy,
+			const HarvestingUtFacadeFactory& utFacadeFactory,
+			const cache::ReadWriteUtCache& utCache,
+			const utils::PartitionRunner& merklePartitionRunner) {
+		auto transactionsInfoSupplier = CreateTransactionsInfoSupplier(strategy, utCache, merklePartitionRunner);
 		return [utFacadeFactory, transactionsInfoSupplier](const auto& blockHeader, auto maxTransactionsPerBlock) {
 			// 1. check height consistency
 			auto pUtFacade = utFacadeFactory.create(blockHeader.Timestamp);
@@ -68,4 +77,10 @@ namespace catapult { namespace harvesting {
 			return pBlock;
 		};
 	}
+
+	BlockGenerator CreateHarvesterBlockGenerator(HarvesterBlockTemplate& blockTemplate) {
+		return [&blockTemplate](const auto& blockHeader, auto maxTransactionsPerBlock) {
+			return blockTemplate.generate(blockHeader, maxTransactionsPerBlock);
+		};
+	}
 }}
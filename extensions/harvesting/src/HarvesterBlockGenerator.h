@@ -19,12 +19,16 @@
 **/
 
 #pragma once
+#include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/model/Block.h"
 #include "catapult/model/TransactionSelectionStrategy.h"
 
 namespace catapult {
 	namespace cache { class ReadWriteUtCache; }
-	namespace harvesting { class HarvestingUtFacadeFactory; }
+	namespace harvesting {
+		class HarvesterBlockTemplate;
+		class HarvestingUtFacadeFactory;
+	}
 }
 
 namespace catapult { namespace harvesting {
@@ -37,4 +41,15 @@ namespace catapult { namespace harvesting {
 			model::TransactionSelectionStrategy strategy,
 			const HarvestingUtFacadeFactory& utFacadeFactory,
 			const cache::ReadWriteUtCache& utCache);
+
+	/// Creates a default block generator around \a utFacadeFactory and \a utCache for specified transaction \a strategy
+	/// that uses \a merklePartitionRunner to hash large transactions merkle tree levels.
+	BlockGenerator CreateHarvesterBlockGenerator(
+			model::TransactionSelectionStrategy strategy,
+			const HarvestingUtFacadeFactory& utFacadeFactory,
+			const cache::ReadWriteUtCache& utCache,
+			const utils::PartitionRunner& merklePartitionRunner);
+
+	/// Creates a block generator that generates blocks from \a blockTemplate.
+	BlockGenerator CreateHarvesterBlockGenerator(HarvesterBlockTemplate& blockTemplate);
 }}
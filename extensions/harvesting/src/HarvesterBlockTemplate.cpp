@@ -0,0 +1,254 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "HarvesterBlockTemplate.h"
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/model/FeeUtils.h"
+
+namespace catapult { namespace harvesting {
+
+	namespace {
+		BlockFeeMultiplier FindMinFeeMultiplier(const std::vector<model::TransactionInfo>& transactionInfos) {
+			if (transactionInfos.empty())
+				return BlockFeeMultiplier();
+
+			auto minFeeMultiplier = BlockFeeMultiplier(std::numeric_limits<BlockFeeMultiplier::ValueType>::max());
+			for (const auto& transactionInfo : transactionInfos)
+				minFeeMultiplier = std::min(minFeeMultiplier, model::CalculateTransactionMaxFeeMultiplier(*transactionInfo.pEntity));
+
+			return minFeeMultiplier;
+		}
+	}
+
+	HarvesterBlockTemplate::HarvesterBlockTemplate(
+			model::TransactionSelectionStrategy strategy,
+			uint32_t maxTransactionsPerBlock,
+			const HarvestingUtFacadeFactory& utFacadeFactory,
+			const cache::ReadWriteUtCache& utCache,
+			const utils::PartitionRunner& merklePartitionRunner)
+			: m_strategy(strategy)
+			, m_maxTransactionsPerBlock(maxTransactionsPerBlock)
+			, m_utFacadeFactory(utFacadeFactory)
+			, m_utCache(utCache)
+			, m_merkleBuilder(0, merklePartitionRunner)
+			, m_numRebuilds(0)
+	{}
+
+	HarvesterBlockTemplate::~HarvesterBlockTemplate() = default;
+
+	Height HarvesterBlockTemplate::height() const {
+		return m_pUtFacade ? m_pUtFacade->height() : Height();
+	}
+
+	size_t HarvesterBlockTemplate::size() const {
+		return m_pUtFacade ? m_pUtFacade->size() : 0;
+	}
+
+	size_t HarvesterBlockTemplate::numRebuilds() const {
+		return m_numRebuilds;
+	}
+
+	void HarvesterBlockTemplate::update(Timestamp blockTime) {
+		prepare(blockTime);
+
+		// hash the transactions merkle tree between harvest attempts so that generation only needs to rehash its right spine
+		m_merkleBuilder.rebuild();
+
+		// release all locks so that the cache can be committed between harvest attempts
+		m_pUtFacade->unlock();
+	}
+
+	std::unique_ptr<model::Block> HarvesterBlockTemplate::generate(
+			const model::BlockHeader& blockHeader,
+			uint32_t maxTransactionsPerBlock) {
+		if (m_maxTransactionsPerBlock != maxTransactionsPerBlock) {
+			m_maxTransactionsPerBlock = maxTransactionsPerBlock;
+			m_pUtFacade.reset();
+		}
+
+		// 1. bring the template up to date
+		prepare(blockHeader.Timestamp);
+
+		// 2. check height consistency
+		if (blockHeader.Height != m_pUtFacade->height()) {
+			CATAPULT_LOG(debug)
+					<< "bypassing state hash calculation because cache height (" << m_pUtFacade->height() - Height(1)
+					<< ") is inconsistent with block height (" << blockHeader.Height << ")";
+			m_pUtFacade->unlock();
+			return nullptr;
+		}
+
+		// 3. build a block
+		auto pBlock = commit(blockHeader);
+		if (!pBlock) {
+			CATAPULT_LOG(warning) << "failed to generate harvested block";
+			return nullptr;
+		}
+
+		return pBlock;
+	}
+
+	void HarvesterBlockTemplate::prepare(Timestamp blockTime) {
+		auto utCacheView = m_utCache.view();
+		if (!tryUpdate(utCacheView, blockTime))
+			rebuild(utCacheView, blockTime);
+	}
+
+	bool HarvesterBlockTemplate::tryUpdate(const cache::MemoryUtCacheView& utCacheView, Timestamp blockTime) {
+		// template is stale when a block has been committed since it was built
+		if (!m_pUtFacade || !m_pUtFacade->tryLock())
+			return false;
+
+		// template is stale when any selected transaction has been removed from the ut cache or has expired
+		for (const auto& transactionInfo : m_pUtFacade->transactionInfos()) {
+			if (!utCacheView.contains(transactionInfo.EntityHash) || transactionInfo.pEntity->Deadline < blockTime)
+				return false;
+		}
+
+		m_pUtFacade->setBlockTime(blockTime);
+		return addNewTransactions(utCacheView);
+	}
+
+	void HarvesterBlockTemplate::rebuild(const cache::MemoryUtCacheView& utCacheView, Timestamp blockTime) {
+		// destroy the previous facade before creating a new one in order to release its (detached) cache delta
+		m_pUtFacade.reset();
+		m_pUtFacade = m_utFacadeFactory.create(blockTime);
+		m_consideredHashes.clear();
+		m_merkleBuilder.truncate(0);
+		m_lastMaxFeeMultiplier = BlockFeeMultiplier();
+		m_maximizer = TransactionFeeMaximizer();
+		++m_numRebuilds;
+
+		CATAPULT_LOG(trace) << "rebuilding block template at height " << m_pUtFacade->height();
+		addNewTransactions(utCacheView);
+	}
+
+	bool HarvesterBlockTemplate::addNewTransactions(const cache::MemoryUtCacheView& utCacheView) {
+		prevalidateNewTransactions(utCacheView);
+
+		auto isOrderPreserved = true;
+		auto consumer = [this, &isOrderPreserved](const auto& transactionInfo) {
+			if (m_consideredHashes.cend() != m_consideredHashes.find(transactionInfo.EntityHash))
+				return true;
+
+			// a new transaction that would have been visited before an already considered transaction invalidates the template
+			auto maxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*transactionInfo.pEntity);
+			if (!m_consideredHashes.empty() && isOrderedBefore(maxFeeMultiplier, m_lastMaxFeeMultiplier)) {
+				isOrderPreserved = false;
+				return false;
+			}
+
+			// all remaining transactions are visited after the considered ones, so none of them can be selected
+			if (m_maxTransactionsPerBlock <= m_pUtFacade->size())
+				return false;
+
+			m_consideredHashes.insert(transactionInfo.EntityHash);
+			m_lastMaxFeeMultiplier = maxFeeMultiplier;
+			if (!m_pUtFacade->apply(transactionInfo))
+				return true;
+
+			m_merkleBuilder.update(transactionInfo.MerkleComponentHash);
+			if (model::TransactionSelectionStrategy::Maximize_Fee == m_strategy)
+				m_maximizer.apply(transactionInfo);
+
+			return true;
+		};
+
+		forEachCandidate(utCacheView, consumer);
+		return isOrderPreserved;
+	}
+
+	void HarvesterBlockTemplate::prevalidateNewTransactions(const cache::MemoryUtCacheView& utCacheView) {
+		if (!m_pUtFacade->canPrevalidate() || m_maxTransactionsPerBlock <= m_pUtFacade->size())
+			return;
+
+		// speculatively validate (at most) as many new transactions as can still be added to the template
+		auto maxCandidates = m_maxTransactionsPerBlock - m_pUtFacade->size();
+		std::vector<const model::TransactionInfo*> candidates;
+		forEachCandidate(utCacheView, [this, maxCandidates, &candidates](const auto& transactionInfo) {
+			if (m_consideredHashes.cend() == m_consideredHashes.find(transactionInfo.EntityHash))
+				candidates.push_back(&transactionInfo);
+
+			return candidates.size() < maxCandidates;
+		});
+
+		m_pUtFacade->prevalidate(candidates);
+	}
+
+	void HarvesterBlockTemplate::forEachCandidate(
+			const cache::MemoryUtCacheView& utCacheView,
+			const predicate<const model::TransactionInfo&>& consumer) const {
+		switch (m_strategy) {
+		case model::TransactionSelectionStrategy::Minimize_Fee:
+			utCacheView.forEach(cache::MaxFeeMultiplierOrder::Ascending, consumer);
+			break;
+
+		case model::TransactionSelectionStrategy::Maximize_Fee:
+			utCacheView.forEach(cache::MaxFeeMultiplierOrder::Descending, consumer);
+			break;
+
+		default:
+			utCacheView.forEach(consumer);
+			break;
+		}
+	}
+
+	bool HarvesterBlockTemplate::isOrderedBefore(BlockFeeMultiplier lhs, BlockFeeMultiplier rhs) const {
+		// new transactions always have larger ids than considered ones, so they can only be ordered before by fee
+		switch (m_strategy) {
+		case model::TransactionSelectionStrategy::Minimize_Fee:
+			return lhs < rhs;
+
+		case model::TransactionSelectionStrategy::Maximize_Fee:
+			return lhs > rhs;
+
+		default:
+			return false;
+		}
+	}
+
+	std::unique_ptr<model::Block> HarvesterBlockTemplate::commit(const model::BlockHeader& originalBlockHeader) {
+		// template is consumed by commit
+		auto pUtFacade = std::move(m_pUtFacade);
+
+		// 1. pick the fee multiplier and truncate the transactions when maximizing fees
+		BlockFeeMultiplier feeMultiplier;
+		if (model::TransactionSelectionStrategy::Maximize_Fee == m_strategy) {
+			const auto& bestFeePolicy = m_maximizer.best();
+			while (pUtFacade->size() > bestFeePolicy.NumTransactions)
+				pUtFacade->unapply();
+
+			m_merkleBuilder.truncate(pUtFacade->size());
+			feeMultiplier = bestFeePolicy.FeeMultiplier;
+		} else {
+			// pick the smallest multiplier so that all transactions pass validation
+			feeMultiplier = FindMinFeeMultiplier(pUtFacade->transactionInfos());
+		}
+
+		// 2. copy and update block header
+		model::BlockHeader blockHeader;
+		std::memcpy(static_cast<void*>(&blockHeader), &originalBlockHeader, sizeof(model::BlockHeader));
+		m_merkleBuilder.final(blockHeader.TransactionsHash);
+		blockHeader.FeeMultiplier = feeMultiplier;
+
+		// 3. generate the block
+		return pUtFacade->commit(blockHeader);
+	}
+}}
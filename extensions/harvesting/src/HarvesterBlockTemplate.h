@@ -0,0 +1,107 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "HarvestingUtFacadeFactory.h"
+#include "TransactionFeeMaximizer.h"
+#include "catapult/crypto/MerkleHashBuilder.h"
+#include "catapult/model/TransactionSelectionStrategy.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_set>
+
+namespace catapult {
+	namespace cache {
+		class MemoryUtCacheView;
+		class ReadWriteUtCache;
+	}
+}
+
+namespace catapult { namespace harvesting {
+
+	/// Block template that keeps candidate transactions applied on top of the chain tip between harvest attempts.
+	/// \note Updates only validate transactions that entered the unconfirmed transactions cache since the previous update.
+	///       The template is rebuilt when a block is committed, when a selected transaction leaves the unconfirmed
+	///       transactions cache or expires, or when a new transaction would change the strategy's selection order.
+	class HarvesterBlockTemplate {
+	public:
+		/// Creates a template around \a utFacadeFactory and \a utCache for specified transaction \a strategy
+		/// that selects at most \a maxTransactionsPerBlock transactions and uses \a merklePartitionRunner
+		/// to hash large transactions merkle tree levels.
+		HarvesterBlockTemplate(
+				model::TransactionSelectionStrategy strategy,
+				uint32_t maxTransactionsPerBlock,
+				const HarvestingUtFacadeFactory& utFacadeFactory,
+				const cache::ReadWriteUtCache& utCache,
+				const utils::PartitionRunner& merklePartitionRunner);
+
+		/// Destroys the template.
+		~HarvesterBlockTemplate();
+
+	public:
+		/// Gets the height of the block being built or zero when the template has not been built.
+		Height height() const;
+
+		/// Gets the number of transactions applied to the template.
+		size_t size() const;
+
+		/// Gets the number of times the template has been built from scratch.
+		size_t numRebuilds() const;
+
+	public:
+		/// Updates the template for a block with \a blockTime.
+		/// \note The template does not hold any cache locks after this call.
+		void update(Timestamp blockTime);
+
+		/// Generates a block with at most \a maxTransactionsPerBlock transactions from the template
+		/// given a seed block header (\a blockHeader).
+		/// \note The template is consumed and rebuilt by the next update.
+		std::unique_ptr<model::Block> generate(const model::BlockHeader& blockHeader, uint32_t maxTransactionsPerBlock);
+
+	private:
+		void prepare(Timestamp blockTime);
+
+		bool tryUpdate(const cache::MemoryUtCacheView& utCacheView, Timestamp blockTime);
+
+		void rebuild(const cache::MemoryUtCacheView& utCacheView, Timestamp blockTime);
+
+		bool addNewTransactions(const cache::MemoryUtCacheView& utCacheView);
+
+		void prevalidateNewTransactions(const cache::MemoryUtCacheView& utCacheView);
+
+		void forEachCandidate(const cache::MemoryUtCacheView& utCacheView, const predicate<const model::TransactionInfo&>& consumer) const;
+
+		bool isOrderedBefore(BlockFeeMultiplier lhs, BlockFeeMultiplier rhs) const;
+
+		std::unique_ptr<model::Block> commit(const model::BlockHeader& blockHeader);
+
+	private:
+		model::TransactionSelectionStrategy m_strategy;
+		uint32_t m_maxTransactionsPerBlock;
+		HarvestingUtFacadeFactory m_utFacadeFactory;
+		const cache::ReadWriteUtCache& m_utCache;
+		crypto::MerkleHashBuilder m_merkleBuilder;
+
+		std::unique_ptr<HarvestingUtFacade> m_pUtFacade;
+		std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> m_consideredHashes;
+		BlockFeeMultiplier m_lastMaxFeeMultiplier;
+		TransactionFeeMaximizer m_maximizer;
+		size_t m_numRebuilds;
+	};
+}}
@@ -44,9 +44,11 @@ namespace catapult { namespace harvesting {
 		LOAD_HARVESTING_PROPERTY(DelegatePrioritizationPolicy);
 		LOAD_HARVESTING_PROPERTY(BeneficiaryPublicKey);
 
+		LOAD_HARVESTING_PROPERTY(EnableSpeculativeValidation);
+
 #undef LOAD_HARVESTING_PROPERTY
 
-		utils::VerifyBagSizeLte(bag, 6);
+		utils::VerifyBagSizeLte(bag, 7);
 		return config;
 	}
 
@@ -48,6 +48,9 @@ namespace catapult { namespace harvesting {
 		/// Public key of the account receiving part of the harvested fee.
 		std::string BeneficiaryPublicKey;
 
+		/// \c true if unconfirmed transactions should be speculatively validated in parallel before being added to a block.
+		bool EnableSpeculativeValidation;
+
 	private:
 		HarvestingConfiguration() = default;
 
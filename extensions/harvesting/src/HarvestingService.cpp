@@ -20,6 +20,7 @@
 
 #include "HarvestingService.h"
 #include "HarvesterBlockGenerator.h"
+#include "HarvesterBlockTemplate.h"
 #include "HarvestingUtFacadeFactory.h"
 #include "ScheduledHarvesterTask.h"
 #include "UnlockedAccounts.h"
@@ -35,7 +36,10 @@
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/EntityRange.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/MultiServicePool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/HexParser.h"
+#include <boost/range/irange.hpp>
 
 namespace catapult { namespace harvesting {
 
@@ -83,8 +87,22 @@ namespace catapult { namespace harvesting {
 			return options;
 		}
 
+		utils::PartitionRunner CreatePartitionRunner(thread::IoThreadPool& pool) {
+			return [&pool](auto count, const auto& callback) {
+				auto indexes = boost::irange<size_t>(0, count);
+				auto partitionCallback = [&callback](auto itBegin, auto itEnd, auto startIndex, auto) {
+					callback(startIndex, static_cast<size_t>(std::distance(itBegin, itEnd)));
+				};
+
+				// harvesting task does not run on any partition pool, so it is safe to block
+				thread::ParallelForPartition(pool.ioContext(), indexes, pool.numWorkerThreads(), partitionCallback).get();
+			};
+		}
+
 		thread::Task CreateHarvestingTask(
 				extensions::ServiceState& state,
+				thread::IoThreadPool& merklePool,
+				const utils::PartitionRunner& validationPartitionRunner,
 				UnlockedAccounts& unlockedAccounts,
 				const crypto::KeyPair& encryptionKeyPair,
 				const Key& beneficiaryPublicKey) {
@@ -93,7 +111,7 @@ namespace catapult { namespace harvesting {
 			const auto& utCache = const_cast<const extensions::ServiceState&>(state).utCache();
 			auto strategy = state.config().Node.TransactionSelectionStrategy;
 			auto executionConfig = extensions::CreateExecutionConfiguration(state.pluginManager());
-			HarvestingUtFacadeFactory utFacadeFactory(cache, blockChainConfig, executionConfig);
+			HarvestingUtFacadeFactory utFacadeFactory(cache, blockChainConfig, executionConfig, validationPartitionRunner);
 
 			auto pUnlockedAccountsUpdater = std::make_shared<UnlockedAccountsUpdater>(
 					cache,
@@ -102,14 +120,36 @@ namespace catapult { namespace harvesting {
 					config::CatapultDataDirectory(state.config().User.DataDirectory));
 			pUnlockedAccountsUpdater->load();
 
-			auto blockGenerator = CreateHarvesterBlockGenerator(strategy, utFacadeFactory, utCache);
+			// block template is only accessed by the harvesting task, which never runs concurrently with itself
+			auto merklePartitionRunner = CreatePartitionRunner(merklePool);
+			auto pBlockTemplate = std::make_shared<HarvesterBlockTemplate>(
+					strategy,
+					blockChainConfig.MaxTransactionsPerBlock,
+					utFacadeFactory,
+					utCache,
+					merklePartitionRunner);
+
+			auto taskOptions = CreateHarvesterTaskOptions(state);
+			auto harvestingAllowed = taskOptions.HarvestingAllowed;
+			auto timeSupplier = taskOptions.TimeSupplier;
+			auto blockGenerator = CreateHarvesterBlockGenerator(*pBlockTemplate);
 			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
-					CreateHarvesterTaskOptions(state),
+					taskOptions,
 					std::make_unique<Harvester>(cache, blockChainConfig, beneficiaryPublicKey, unlockedAccounts, blockGenerator));
 
-			return thread::CreateNamedTask("harvesting task", [pUnlockedAccountsUpdater, pHarvesterTask]() {
+			return thread::CreateNamedTask("harvesting task", [
+					pUnlockedAccountsUpdater,
+					pBlockTemplate,
+					pHarvesterTask,
+					&unlockedAccounts,
+					harvestingAllowed,
+					timeSupplier]() {
 				pUnlockedAccountsUpdater->update();
 
+				// prevalidate new unconfirmed transactions so that a harvest only needs to seal the block template
+				if (harvestingAllowed() && 0 != unlockedAccounts.view().size())
+					pBlockTemplate->update(timeSupplier());
+
 				// harvest the next block
 				pHarvesterTask->harvest();
 				return thread::make_ready_future(thread::TaskResult::Continue);
@@ -171,9 +211,16 @@ namespace catapult { namespace harvesting {
 				locator.registerRootedService("unlockedAccounts", pUnlockedAccounts);
 
 				// add tasks
+				// (notice that the merkle and validator pools are shutdown after the scheduler, which executes the harvesting task)
+				auto pMerklePool = state.pool().pushIsolatedPool("harvesting merkle");
+				auto validationPartitionRunner = m_config.EnableSpeculativeValidation
+						? CreatePartitionRunner(*state.pool().pushIsolatedPool("harvesting validator"))
+						: utils::PartitionRunner();
 				auto beneficiaryPublicKey = utils::ParseByteArray<Key>(m_config.BeneficiaryPublicKey);
 				state.tasks().push_back(CreateHarvestingTask(
 						state,
+						*pMerklePool,
+						validationPartitionRunner,
 						*pUnlockedAccounts,
 						locator.keys().nodeKeyPair(),
 						beneficiaryPublicKey));
@@ -64,12 +64,24 @@ namespace catapult { namespace harvesting {
 				Timestamp blockTime,
 				const cache::CatapultCache& cache,
 				const model::BlockChainConfiguration& blockChainConfig,
-				const chain::ExecutionConfiguration& executionConfig)
+				const chain::ExecutionConfiguration& executionConfig,
+				const utils::PartitionRunner& validationPartitionRunner)
+				: Impl(blockTime, cache.createDetachableDelta(), blockChainConfig, executionConfig, validationPartitionRunner)
+		{}
+
+	private:
+		// cache height lock is only held during construction, afterwards the (locked) delta prevents cache commits
+		Impl(
+				Timestamp blockTime,
+				cache::CatapultCacheDetachableDelta&& cacheDetachableDelta,
+				const model::BlockChainConfiguration& blockChainConfig,
+				const chain::ExecutionConfiguration& executionConfig,
+				const utils::PartitionRunner& validationPartitionRunner)
 				: m_blockTime(blockTime)
 				, m_blockChainConfig(blockChainConfig)
 				, m_executionConfig(executionConfig)
-				, m_cacheDetachableDelta(cache.createDetachableDelta())
-				, m_cacheDetachedDelta(m_cacheDetachableDelta.detach())
+				, m_cacheHeight(cacheDetachableDelta.height())
+				, m_cacheDetachedDelta(cacheDetachableDelta.detach())
 				, m_pCacheDelta(m_cacheDetachedDelta.tryLock()) {
 			// add additional observers to monitor accounts
 			observers::DemuxObserverBuilder observerBuilder;
@@ -77,19 +89,55 @@ namespace catapult { namespace harvesting {
 			observerBuilder.add(CreateHarvestingAccountPublicKeyObserver(m_affectedAccounts.PublicKeys));
 			observerBuilder.add<model::Notification>(std::make_unique<NotificationObserverProxy>(m_executionConfig.pObserver));
 			m_executionConfig.pObserver = observerBuilder.build();
+
+			if (validationPartitionRunner)
+				m_pSpeculativeValidator = std::make_unique<SpeculativeTransactionValidator>(m_executionConfig, validationPartitionRunner);
 		}
 
 	public:
 		Height height() const {
-			return m_cacheDetachableDelta.height() + Height(1);
+			return m_cacheHeight + Height(1);
+		}
+
+		bool canPrevalidate() const {
+			return !!m_pSpeculativeValidator;
+		}
+
+	public:
+		void setBlockTime(Timestamp blockTime) {
+			m_blockTime = blockTime;
+			resetSpeculativeResults();
+		}
+
+		void unlock() {
+			m_pCacheDelta.reset();
+		}
+
+		bool tryLock() {
+			if (!m_pCacheDelta)
+				m_pCacheDelta = m_cacheDetachedDelta.tryLock();
+
+			return !!m_pCacheDelta;
 		}
 
 	public:
+		void prevalidate(const std::vector<const model::TransactionInfo*>& transactionInfos) {
+			if (m_pSpeculativeValidator)
+				m_pSpeculativeValidator->validate(transactionInfos, height(), m_blockTime, cacheDelta());
+		}
+
 		bool apply(const model::TransactionInfo& transactionInfo) {
+			if (m_pSpeculativeValidator && m_pSpeculativeValidator->isKnownInvalid(transactionInfo.EntityHash))
+				return false;
+
 			auto originalSource = m_blockStatementBuilder.source();
 
-			if (apply(model::WeakEntityInfo(*transactionInfo.pEntity, transactionInfo.EntityHash)))
+			if (apply(model::WeakEntityInfo(*transactionInfo.pEntity, transactionInfo.EntityHash))) {
+				if (m_pSpeculativeValidator)
+					m_pSpeculativeValidator->notifyApplied(transactionInfo.EntityHash);
+
 				return true;
+			}
 
 			auto finalSource = m_blockStatementBuilder.source();
 			if (originalSource.PrimaryId != finalSource.PrimaryId)
@@ -101,6 +149,7 @@ namespace catapult { namespace harvesting {
 		void unapply(const model::TransactionInfo& transactionInfo) {
 			unapply(model::WeakEntityInfo(*transactionInfo.pEntity, transactionInfo.EntityHash));
 			m_blockStatementBuilder.popSource();
+			resetSpeculativeResults();
 		}
 
 		std::unique_ptr<model::Block> commit(const model::BlockHeader& blockHeader, const model::Transactions& transactions) {
@@ -109,7 +158,7 @@ namespace catapult { namespace harvesting {
 			auto importanceHeight = model::ConvertToImportanceHeight(pBlock->Height, m_blockChainConfig.ImportanceGrouping);
 
 			// 2. add back fee surpluses to accounts (skip cache lookup if no surplus)
-			auto& accountStateCacheDelta = m_pCacheDelta->sub<cache::AccountStateCache>();
+			auto& accountStateCacheDelta = cacheDelta().sub<cache::AccountStateCache>();
 			for (const auto& transaction : pBlock->Transactions()) {
 				auto surplus = transaction.MaxFee - model::CalculateTransactionFee(blockHeader.FeeMultiplier, transaction);
 				if (Amount(0) != surplus) {
@@ -127,7 +176,7 @@ namespace catapult { namespace harvesting {
 
 			// 5. update block fields
 			pBlock->StateHash = m_blockChainConfig.EnableVerifiableState
-					? m_pCacheDelta->calculateStateHash(height()).StateHash
+					? cacheDelta().calculateStateHash(height()).StateHash
 					: Hash256();
 
 			pBlock->ReceiptsHash = m_blockChainConfig.EnableVerifiableReceipts
@@ -138,6 +187,19 @@ namespace catapult { namespace harvesting {
 		}
 
 	private:
+		void resetSpeculativeResults() {
+			// speculative results are only conclusive relative to the state they were computed against
+			if (m_pSpeculativeValidator)
+				m_pSpeculativeValidator->reset();
+		}
+
+		cache::CatapultCacheDelta& cacheDelta() {
+			if (!m_pCacheDelta)
+				CATAPULT_THROW_RUNTIME_ERROR("facade cannot be used when unlocked");
+
+			return *m_pCacheDelta;
+		}
+
 		using Processor = predicate<
 			const validators::stateful::NotificationValidator&,
 			const validators::ValidatorContext&,
@@ -147,7 +209,7 @@ namespace catapult { namespace harvesting {
 		bool process(const Processor& processor) {
 			// prepare state and contexts
 			chain::ProcessContextsBuilder contextBuilder(height(), m_blockTime, m_executionConfig);
-			contextBuilder.setCache(*m_pCacheDelta);
+			contextBuilder.setCache(cacheDelta());
 			if (m_blockChainConfig.EnableVerifiableReceipts)
 				contextBuilder.setBlockStatementBuilder(m_blockStatementBuilder);
 
@@ -200,12 +262,13 @@ namespace catapult { namespace harvesting {
 		Timestamp m_blockTime;
 		model::BlockChainConfiguration m_blockChainConfig;
 		chain::ExecutionConfiguration m_executionConfig;
-		cache::CatapultCacheDetachableDelta m_cacheDetachableDelta;
+		Height m_cacheHeight;
 		cache::CatapultCacheDetachedDelta m_cacheDetachedDelta;
 		std::unique_ptr<cache::CatapultCacheDelta> m_pCacheDelta;
 
 		model::BlockStatementBuilder m_blockStatementBuilder;
 		HarvestingAffectedAccounts m_affectedAccounts;
+		std::unique_ptr<SpeculativeTransactionValidator> m_pSpeculativeValidator;
 	};
 
 	// endregion
@@ -217,7 +280,16 @@ namespace catapult { namespace harvesting {
 			const cache::CatapultCache& cache,
 			const model::BlockChainConfiguration& blockChainConfig,
 			const chain::ExecutionConfiguration& executionConfig)
-			: m_pImpl(std::make_unique<Impl>(blockTime, cache, blockChainConfig, executionConfig))
+			: HarvestingUtFacade(blockTime, cache, blockChainConfig, executionConfig, utils::PartitionRunner())
+	{}
+
+	HarvestingUtFacade::HarvestingUtFacade(
+			Timestamp blockTime,
+			const cache::CatapultCache& cache,
+			const model::BlockChainConfiguration& blockChainConfig,
+			const chain::ExecutionConfiguration& executionConfig,
+			const utils::PartitionRunner& validationPartitionRunner)
+			: m_pImpl(std::make_unique<Impl>(blockTime, cache, blockChainConfig, executionConfig, validationPartitionRunner))
 	{}
 
 	HarvestingUtFacade::~HarvestingUtFacade() = default;
@@ -234,6 +306,26 @@ namespace catapult { namespace harvesting {
 		return m_transactionInfos;
 	}
 
+	bool HarvestingUtFacade::canPrevalidate() const {
+		return m_pImpl->canPrevalidate();
+	}
+
+	void HarvestingUtFacade::setBlockTime(Timestamp blockTime) {
+		m_pImpl->setBlockTime(blockTime);
+	}
+
+	void HarvestingUtFacade::unlock() {
+		m_pImpl->unlock();
+	}
+
+	bool HarvestingUtFacade::tryLock() {
+		return m_pImpl->tryLock();
+	}
+
+	void HarvestingUtFacade::prevalidate(const std::vector<const model::TransactionInfo*>& transactionInfos) {
+		m_pImpl->prevalidate(transactionInfos);
+	}
+
 	bool HarvestingUtFacade::apply(const model::TransactionInfo& transactionInfo) {
 		if (!m_pImpl->apply(transactionInfo))
 			return false;
@@ -271,13 +363,27 @@ namespace catapult { namespace harvesting {
 			const cache::CatapultCache& cache,
 			const model::BlockChainConfiguration& blockChainConfig,
 			const chain::ExecutionConfiguration& executionConfig)
+			: HarvestingUtFacadeFactory(cache, blockChainConfig, executionConfig, utils::PartitionRunner())
+	{}
+
+	HarvestingUtFacadeFactory::HarvestingUtFacadeFactory(
+			const cache::CatapultCache& cache,
+			const model::BlockChainConfiguration& blockChainConfig,
+			const chain::ExecutionConfiguration& executionConfig,
+			const utils::PartitionRunner& validationPartitionRunner)
 			: m_cache(cache)
 			, m_blockChainConfig(blockChainConfig)
 			, m_executionConfig(executionConfig)
+			, m_validationPartitionRunner(validationPartitionRunner)
 	{}
 
 	std::unique_ptr<HarvestingUtFacade> HarvestingUtFacadeFactory::create(Timestamp blockTime) const {
-		return std::make_unique<HarvestingUtFacade>(blockTime, m_cache, m_blockChainConfig, m_executionConfig);
+		return std::make_unique<HarvestingUtFacade>(
+				blockTime,
+				m_cache,
+				m_blockChainConfig,
+				m_executionConfig,
+				m_validationPartitionRunner);
 	}
 
 	// endregion
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "SpeculativeTransactionValidator.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/chain/ExecutionConfiguration.h"
 #include "catapult/model/Block.h"
@@ -36,6 +37,15 @@ namespace catapult { namespace harvesting {
 				const model::BlockChainConfiguration& blockChainConfig,
 				const chain::ExecutionConfiguration& executionConfig);
 
+		/// Creates a facade around \a blockTime, \a cache, \a blockChainConfig and \a executionConfig
+		/// that uses \a validationPartitionRunner to speculatively validate transactions.
+		HarvestingUtFacade(
+				Timestamp blockTime,
+				const cache::CatapultCache& cache,
+				const model::BlockChainConfiguration& blockChainConfig,
+				const chain::ExecutionConfiguration& executionConfig,
+				const utils::PartitionRunner& validationPartitionRunner);
+
 		/// Destroys the facade.
 		~HarvestingUtFacade();
 
@@ -49,7 +59,27 @@ namespace catapult { namespace harvesting {
 		/// Gets all successfully applied transactions.
 		const std::vector<model::TransactionInfo>& transactionInfos() const;
 
+		/// Returns \c true if the facade supports speculative validation.
+		bool canPrevalidate() const;
+
 	public:
+		/// Sets the block time used when applying transactions and committing to \a blockTime.
+		/// \note Transactions that have already been applied are not revalidated.
+		void setBlockTime(Timestamp blockTime);
+
+		/// Releases all cache locks held by the facade so that the underlying cache can be committed.
+		void unlock();
+
+		/// Attempts to reacquire the cache locks released by unlock.
+		/// \note \c false is returned when the underlying cache has been committed in the meantime.
+		bool tryLock();
+
+	public:
+		/// Speculatively validates \a transactionInfos against the current cache state so that transactions known to be invalid
+		/// can subsequently be rejected by apply without being executed.
+		/// \note This is a no-op when the facade does not support speculative validation.
+		void prevalidate(const std::vector<const model::TransactionInfo*>& transactionInfos);
+
 		/// Attempts to apply \a transactionInfo to the cache.
 		bool apply(const model::TransactionInfo& transactionInfo);
 
@@ -76,6 +106,14 @@ namespace catapult { namespace harvesting {
 				const model::BlockChainConfiguration& blockChainConfig,
 				const chain::ExecutionConfiguration& executionConfig);
 
+		/// Creates a factory around \a cache, \a blockChainConfig and \a executionConfig
+		/// that creates facades using \a validationPartitionRunner to speculatively validate transactions.
+		HarvestingUtFacadeFactory(
+				const cache::CatapultCache& cache,
+				const model::BlockChainConfiguration& blockChainConfig,
+				const chain::ExecutionConfiguration& executionConfig,
+				const utils::PartitionRunner& validationPartitionRunner);
+
 	public:
 		/// Creates a facade for applying transactions at a given block time (\a blockTime).
 		std::unique_ptr<HarvestingUtFacade> create(Timestamp blockTime) const;
@@ -84,5 +122,6 @@ namespace catapult { namespace harvesting {
 		const cache::CatapultCache& m_cache;
 		model::BlockChainConfiguration m_blockChainConfig;
 		chain::ExecutionConfiguration m_executionConfig;
+		utils::PartitionRunner m_validationPartitionRunner;
 	};
 }}
@@ -0,0 +1,240 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SpeculativeTransactionValidator.h"
+#include "catapult/cache/CatapultCacheDelta.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/chain/ProcessContextsBuilder.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/validators/AggregateValidationResult.h"
+#include "catapult/validators/ValidatorContext.h"
+#include <algorithm>
+
+namespace catapult { namespace harvesting {
+
+	namespace {
+		model::FacilityCode GetFacilityCode(model::NotificationType type) {
+			return static_cast<model::FacilityCode>((utils::to_underlying_type(type) >> 16) & 0xFF);
+		}
+
+		class SpeculativeValidatingSubscriber : public model::NotificationSubscriber {
+		public:
+			SpeculativeValidatingSubscriber(
+					const validators::stateful::NotificationValidator& validator,
+					const validators::ValidatorContext& context)
+					: m_validator(validator)
+					, m_context(context)
+					, m_accountStateCache(context.Cache.sub<cache::AccountStateCache>())
+					, m_result(validators::ValidationResult::Success)
+					, m_isFullyTracked(true)
+					, m_areAllAccountsKnown(true)
+			{}
+
+		public:
+			validators::ValidationResult result() const {
+				return m_result;
+			}
+
+			bool isFullyTracked() const {
+				return m_isFullyTracked;
+			}
+
+			bool areAllAccountsKnown() const {
+				return m_areAllAccountsKnown;
+			}
+
+			std::vector<Address>& addresses() {
+				return m_addresses;
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				track(notification);
+
+				if (!IsSet(notification.Type, model::NotificationChannel::Validator) || IsValidationResultFailure(m_result))
+					return;
+
+				validators::AggregateValidationResult(m_result, m_validator.validate(notification, m_context));
+			}
+
+		private:
+			void track(const model::Notification& notification) {
+				switch (notification.Type) {
+				case model::Core_Register_Account_Address_Notification:
+					trackAddress(static_cast<const model::AccountAddressNotification&>(notification).Address);
+					return;
+
+				case model::Core_Register_Account_Public_Key_Notification:
+					trackPublicKey(static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey);
+					return;
+
+				case model::Core_Balance_Transfer_Notification: {
+					const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+					trackPublicKey(transferNotification.Sender);
+					trackAddress(transferNotification.Recipient);
+					return;
+				}
+
+				case model::Core_Balance_Debit_Notification:
+					trackPublicKey(static_cast<const model::BalanceDebitNotification&>(notification).Sender);
+					return;
+
+				case model::Core_Address_Interaction_Notification: {
+					const auto& interactionNotification = static_cast<const model::AddressInteractionNotification&>(notification);
+					trackPublicKey(interactionNotification.Source);
+					for (const auto& address : interactionNotification.ParticipantsByAddress)
+						trackAddress(address);
+
+					for (const auto& publicKey : interactionNotification.ParticipantsByKey)
+						trackPublicKey(publicKey);
+
+					return;
+				}
+
+				// these notifications only reference the signer, which is tracked by its account public key notification
+				case model::Core_Source_Change_Notification:
+				case model::Core_Entity_Notification:
+				case model::Core_Transaction_Notification:
+				case model::Core_Transaction_Deadline_Notification:
+				case model::Core_Transaction_Fee_Notification:
+				case model::Core_Signature_Notification:
+				case model::Core_Mosaic_Required_Notification:
+				case model::Core_Internal_Padding_Notification:
+					return;
+
+				default:
+					// transfer notifications only reference accounts that are also referenced by core notifications
+					if (model::FacilityCode::Transfer != GetFacilityCode(notification.Type))
+						m_isFullyTracked = false;
+
+					return;
+				}
+			}
+
+			void trackAddress(const UnresolvedAddress& unresolvedAddress) {
+				auto address = m_context.Resolvers.resolve(unresolvedAddress);
+				if (!m_accountStateCache.contains(address))
+					m_areAllAccountsKnown = false;
+
+				m_addresses.push_back(address);
+			}
+
+			void trackPublicKey(const Key& publicKey) {
+				if (!m_accountStateCache.contains(publicKey))
+					m_areAllAccountsKnown = false;
+
+				m_addresses.push_back(model::PublicKeyToAddress(publicKey, m_context.Network.Identifier));
+			}
+
+		private:
+			const validators::stateful::NotificationValidator& m_validator;
+			const validators::ValidatorContext& m_context;
+			const cache::ReadOnlyAccountStateCache& m_accountStateCache;
+			validators::ValidationResult m_result;
+			bool m_isFullyTracked;
+			bool m_areAllAccountsKnown;
+			std::vector<Address> m_addresses;
+		};
+	}
+
+	SpeculativeTransactionValidator::SpeculativeTransactionValidator(
+			const chain::ExecutionConfiguration& executionConfig,
+			const utils::PartitionRunner& partitionRunner)
+			: m_executionConfig(executionConfig)
+			, m_partitionRunner(partitionRunner)
+			, m_isAppliedStateUnknown(false)
+	{}
+
+	size_t SpeculativeTransactionValidator::size() const {
+		return m_results.size();
+	}
+
+	bool SpeculativeTransactionValidator::isKnownInvalid(const Hash256& hash) const {
+		auto iter = m_results.find(hash);
+		if (m_results.cend() == iter || m_isAppliedStateUnknown)
+			return false;
+
+		const auto& result = iter->second;
+		if (!result.IsConclusive || !IsValidationResultFailure(result.Result))
+			return false;
+
+		// failure is only conclusive when no applied transaction has touched any account touched by the transaction
+		return std::none_of(result.Addresses.cbegin(), result.Addresses.cend(), [this](const auto& address) {
+			return m_appliedAddresses.cend() != m_appliedAddresses.find(address);
+		});
+	}
+
+	void SpeculativeTransactionValidator::validate(
+			const std::vector<const model::TransactionInfo*>& transactionInfos,
+			Height height,
+			Timestamp blockTime,
+			cache::CatapultCacheDelta& cacheDelta) {
+		reset();
+		if (transactionInfos.empty())
+			return;
+
+		std::vector<SpeculativeResult> results(transactionInfos.size());
+		m_partitionRunner(transactionInfos.size(), [this, &transactionInfos, height, blockTime, &cacheDelta, &results](
+				auto startIndex,
+				auto count) {
+			// each partition uses its own read-only cache and validator context
+			chain::ProcessContextsBuilder contextBuilder(height, blockTime, m_executionConfig);
+			contextBuilder.setCache(cacheDelta);
+			auto validatorContext = contextBuilder.buildValidatorContext();
+
+			for (auto i = startIndex; i < startIndex + count; ++i) {
+				const auto& transactionInfo = *transactionInfos[i];
+				SpeculativeValidatingSubscriber sub(*m_executionConfig.pValidator, validatorContext);
+				m_executionConfig.pNotificationPublisher->publish(
+						model::WeakEntityInfo(*transactionInfo.pEntity, transactionInfo.EntityHash),
+						sub);
+
+				auto& result = results[i];
+				result.Result = sub.result();
+				result.IsFullyTracked = sub.isFullyTracked();
+				result.IsConclusive = sub.isFullyTracked() && sub.areAllAccountsKnown();
+				result.Addresses = std::move(sub.addresses());
+			}
+		});
+
+		for (auto i = 0u; i < transactionInfos.size(); ++i)
+			m_results.emplace(transactionInfos[i]->EntityHash, std::move(results[i]));
+	}
+
+	void SpeculativeTransactionValidator::notifyApplied(const Hash256& hash) {
+		// accounts touched by a transaction that was not (fully) tracked are unknown, so no failure can remain conclusive
+		auto iter = m_results.find(hash);
+		if (m_results.cend() == iter || !iter->second.IsFullyTracked) {
+			m_isAppliedStateUnknown = true;
+			return;
+		}
+
+		const auto& addresses = iter->second.Addresses;
+		m_appliedAddresses.insert(addresses.cbegin(), addresses.cend());
+	}
+
+	void SpeculativeTransactionValidator::reset() {
+		m_results.clear();
+		m_appliedAddresses.clear();
+		m_isAppliedStateUnknown = false;
+	}
+}}
@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/chain/ExecutionConfiguration.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/ParallelRunners.h"
+#include <unordered_map>
+#include <unordered_set>
+
+namespace catapult { namespace cache { class CatapultCacheDelta; } }
+
+namespace catapult { namespace harvesting {
+
+	/// Validator that speculatively validates transactions (possibly in parallel) against a read-only cache state
+	/// and tracks which speculative failures remain conclusive as transactions are applied sequentially.
+	/// \note A speculative failure is conclusive when sequential validation is guaranteed to fail too:
+	///       the transaction only raises core or transfer notifications, all accounts it touches already exist
+	///       and no transaction touching any of them (or raising any other notifications) has been applied since.
+	class SpeculativeTransactionValidator {
+	public:
+		/// Creates a validator around \a executionConfig and \a partitionRunner.
+		SpeculativeTransactionValidator(
+				const chain::ExecutionConfiguration& executionConfig,
+				const utils::PartitionRunner& partitionRunner);
+
+	public:
+		/// Gets the number of transactions with speculative results.
+		size_t size() const;
+
+		/// Returns \c true if the transaction with \a hash is known to fail validation against the current cache state.
+		bool isKnownInvalid(const Hash256& hash) const;
+
+	public:
+		/// Speculatively validates \a transactionInfos at \a height and \a blockTime against \a cacheDelta,
+		/// replacing all previous results.
+		/// \note \a cacheDelta is only read (concurrently) and must not be modified until this function returns.
+		void validate(
+				const std::vector<const model::TransactionInfo*>& transactionInfos,
+				Height height,
+				Timestamp blockTime,
+				cache::CatapultCacheDelta& cacheDelta);
+
+		/// Notifies the validator that the transaction with \a hash has been applied to the cache.
+		void notifyApplied(const Hash256& hash);
+
+		/// Discards all speculative results.
+		void reset();
+
+	private:
+		struct SpeculativeResult {
+			validators::ValidationResult Result;
+			bool IsFullyTracked;
+			bool IsConclusive;
+			std::vector<Address> Addresses;
+		};
+
+	private:
+		chain::ExecutionConfiguration m_executionConfig;
+		utils::PartitionRunner m_partitionRunner;
+
+		std::unordered_map<Hash256, SpeculativeResult, utils::ArrayHasher<Hash256>> m_results;
+		std::unordered_set<Address, utils::ArrayHasher<Address>> m_appliedAddresses;
+		bool m_isAppliedStateUnknown;
+	};
+}}
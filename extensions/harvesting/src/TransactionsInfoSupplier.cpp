@@ -30,20 +30,10 @@ namespace catapult { namespace harvesting {
 	namespace {
 		using TransactionInfoPointers = std::vector<const model::TransactionInfo*>;
 
-		enum class SortDirection { Ascending, Descending };
-
-		template<SortDirection Direction>
-		struct MaxFeeMultiplierComparer {
-			bool operator()(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) const {
-				auto lhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity);
-				auto rhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
-				return SortDirection::Ascending == Direction
-						? lhsMaxFeeMultiplier < rhsMaxFeeMultiplier
-						: lhsMaxFeeMultiplier > rhsMaxFeeMultiplier;
-			}
-		};
-
-		TransactionsInfo ToTransactionsInfo(const TransactionInfoPointers& transactionInfoPointers, BlockFeeMultiplier feeMultiplier) {
+		TransactionsInfo ToTransactionsInfo(
+				const TransactionInfoPointers& transactionInfoPointers,
+				BlockFeeMultiplier feeMultiplier,
+				const utils::PartitionRunner& merklePartitionRunner) {
 			TransactionsInfo transactionsInfo;
 			transactionsInfo.FeeMultiplier = feeMultiplier;
 			transactionsInfo.Transactions.reserve(transactionInfoPointers.size());
@@ -54,12 +44,27 @@ namespace catapult { namespace harvesting {
 				transactionsInfo.TransactionHashes.push_back(pTransactionInfo->EntityHash);
 			}
 
-			CalculateBlockTransactionsHash(transactionInfoPointers, transactionsInfo.TransactionsHash);
+			CalculateBlockTransactionsHash(transactionInfoPointers, merklePartitionRunner, transactionsInfo.TransactionsHash);
 			return transactionsInfo;
 		}
 
-		TransactionsInfo SupplyOldest(const cache::MemoryUtCacheView& utCacheView, HarvestingUtFacade& utFacade, uint32_t count) {
+		template<typename... TOrder>
+		void Prevalidate(const cache::MemoryUtCacheView& utCacheView, HarvestingUtFacade& utFacade, uint32_t count, TOrder... order) {
+			if (!utFacade.canPrevalidate())
+				return;
+
+			utFacade.prevalidate(cache::GetFirstTransactionInfoPointers(utCacheView, count, order..., [](const auto&) {
+				return true;
+			}));
+		}
+
+		TransactionsInfo SupplyOldest(
+				const cache::MemoryUtCacheView& utCacheView,
+				HarvestingUtFacade& utFacade,
+				uint32_t count,
+				const utils::PartitionRunner& merklePartitionRunner) {
 			// 1. get first transactions from the ut cache
+			Prevalidate(utCacheView, utFacade, count);
 			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, [&utFacade](const auto& transactionInfo) {
 				return utFacade.apply(transactionInfo);
 			});
@@ -67,19 +72,23 @@ namespace catapult { namespace harvesting {
 			// 2. pick the smallest multiplier so that all transactions pass validation
 			auto minFeeMultiplier = BlockFeeMultiplier();
 			if (!candidates.empty()) {
-				auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), comparer);
-				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*(*minIter)->pEntity);
+				minFeeMultiplier = BlockFeeMultiplier(std::numeric_limits<BlockFeeMultiplier::ValueType>::max());
+				for (const auto* pTransactionInfo : candidates)
+					minFeeMultiplier = std::min(minFeeMultiplier, model::CalculateTransactionMaxFeeMultiplier(*pTransactionInfo->pEntity));
 			}
 
-			return ToTransactionsInfo(candidates, minFeeMultiplier);
+			return ToTransactionsInfo(candidates, minFeeMultiplier, merklePartitionRunner);
 		}
 
-		TransactionsInfo SupplyMinimumFee(const cache::MemoryUtCacheView& utCacheView, HarvestingUtFacade& utFacade, uint32_t count) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, comparer, [&utFacade](
-					const auto& transactionInfo) {
+		TransactionsInfo SupplyMinimumFee(
+				const cache::MemoryUtCacheView& utCacheView,
+				HarvestingUtFacade& utFacade,
+				uint32_t count,
+				const utils::PartitionRunner& merklePartitionRunner) {
+			// 1. get transactions with smallest max fee multipliers from the ut cache
+			auto order = cache::MaxFeeMultiplierOrder::Ascending;
+			Prevalidate(utCacheView, utFacade, count, order);
+			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, order, [&utFacade](const auto& transactionInfo) {
 				return utFacade.apply(transactionInfo);
 			});
 
@@ -88,14 +97,19 @@ namespace catapult { namespace harvesting {
 			if (!candidates.empty())
 				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*candidates[0]->pEntity);
 
-			return ToTransactionsInfo(candidates, minFeeMultiplier);
+			return ToTransactionsInfo(candidates, minFeeMultiplier, merklePartitionRunner);
 		}
 
-		TransactionsInfo SupplyMaximumFee(const cache::MemoryUtCacheView& utCacheView, HarvestingUtFacade& utFacade, uint32_t count) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Descending>();
+		TransactionsInfo SupplyMaximumFee(
+				const cache::MemoryUtCacheView& utCacheView,
+				HarvestingUtFacade& utFacade,
+				uint32_t count,
+				const utils::PartitionRunner& merklePartitionRunner) {
+			// 1. get transactions with largest max fee multipliers from the ut cache
+			auto order = cache::MaxFeeMultiplierOrder::Descending;
+			Prevalidate(utCacheView, utFacade, count, order);
 			auto maximizer = TransactionFeeMaximizer();
-			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, comparer, [&utFacade, &maximizer](
+			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, order, [&utFacade, &maximizer](
 					const auto& transactionInfo) {
 				if (!utFacade.apply(transactionInfo))
 					return false;
@@ -110,25 +124,32 @@ namespace catapult { namespace harvesting {
 			while (utFacade.size() > bestFeePolicy.NumTransactions)
 				utFacade.unapply();
 
-			return ToTransactionsInfo(candidates, bestFeePolicy.FeeMultiplier);
+			return ToTransactionsInfo(candidates, bestFeePolicy.FeeMultiplier, merklePartitionRunner);
 		}
 	}
 
 	TransactionsInfoSupplier CreateTransactionsInfoSupplier(
 			model::TransactionSelectionStrategy strategy,
 			const cache::ReadWriteUtCache& utCache) {
-		return [strategy, &utCache](auto& utFacade, auto count) {
+		return CreateTransactionsInfoSupplier(strategy, utCache, utils::PartitionRunner());
+	}
+
+	TransactionsInfoSupplier CreateTransactionsInfoSupplier(
+			model::TransactionSelectionStrategy strategy,
+			const cache::ReadWriteUtCache& utCache,
+			const utils::PartitionRunner& merklePartitionRunner) {
+		return [strategy, &utCache, merklePartitionRunner](auto& utFacade, auto count) {
 			auto utCacheView = utCache.view();
 
 			switch (strategy) {
 			case model::TransactionSelectionStrategy::Minimize_Fee:
-				return SupplyMinimumFee(utCacheView, utFacade, count);
+				return SupplyMinimumFee(utCacheView, utFacade, count, merklePartitionRunner);
 
 			case model::TransactionSelectionStrategy::Maximize_Fee:
-				return SupplyMaximumFee(utCacheView, utFacade, count);
+				return SupplyMaximumFee(utCacheView, utFacade, count, merklePartitionRunner);
 
 			default:
-				return SupplyOldest(utCacheView, utFacade, count);
+				return SupplyOldest(utCacheView, utFacade, count, merklePartitionRunner);
 			}
 		};
 	}
@@ -47,8 +47,15 @@ namespace catapult { namespace harvesting {
 	/// Supplies a transactions info composed of a maximum number of transactions for a block given a harvesting ut facade.
 	using TransactionsInfoSupplier = std::function<TransactionsInfo (HarvestingUtFacade&, uint32_t)>;
 
-	/// Creates a default transactions info supplier around\a utCache for specified transaction \a strategy.
+	/// Creates a default transactions info supplier around \a utCache for specified transaction \a strategy.
 	TransactionsInfoSupplier CreateTransactionsInfoSupplier(
 			model::TransactionSelectionStrategy strategy,
 			const cache::ReadWriteUtCache& utCache);
+
+	/// Creates a default transactions info supplier around \a utCache for specified transaction \a strategy
+	/// that uses \a merklePartitionRunner to hash large transactions merkle tree levels.
+	TransactionsInfoSupplier CreateTransactionsInfoSupplier(
+			model::TransactionSelectionStrategy strategy,
+			const cache::ReadWriteUtCache& utCache,
+			const utils::PartitionRunner& merklePartitionRunner);
 }}
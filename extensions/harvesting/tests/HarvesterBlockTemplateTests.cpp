@@ -0,0 +1,416 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "harvesting/src/HarvesterBlockTemplate.h"
+#include "harvesting/src/HarvesterBlockGenerator.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/model/BlockUtils.h"
+#include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/other/MockExecutionConfiguration.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace harvesting {
+
+#define TEST_CLASS HarvesterBlockTemplateTests
+
+	namespace {
+		constexpr auto Cache_Height = Height(7);
+		constexpr auto Max_Transactions_Per_Block = 4u;
+
+		// region test context
+
+		auto CreateBlockChainConfiguration() {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.EnableVerifiableState = true;
+			config.EnableVerifiableReceipts = true;
+			config.CurrencyMosaicId = MosaicId(123);
+			config.ImportanceGrouping = 1;
+			return config;
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(model::TransactionSelectionStrategy strategy)
+					: m_config(CreateBlockChainConfiguration())
+					, m_catapultCache(test::CreateEmptyCatapultCache(m_config, CreateCacheConfiguration(m_dbDirGuard.name())))
+					, m_utFacadeFactory(m_catapultCache, m_config, m_executionConfig.Config)
+					, m_pUtCache(test::CreateSeededMemoryUtCache(0))
+					, m_blockTemplate(
+							strategy,
+							Max_Transactions_Per_Block,
+							m_utFacadeFactory,
+							*m_pUtCache,
+							utils::PartitionRunner())
+					, m_generator(CreateHarvesterBlockGenerator(strategy, m_utFacadeFactory, *m_pUtCache)) {
+				// add 5 transaction infos to UT cache with multipliers alternating between 20 and 10
+				addTransactionInfos({ { 201, 200 }, { 202, 100 }, { 203, 200 }, { 204, 100 }, { 205, 200 } });
+
+				// force state hash recalculation and commit
+				auto cacheDelta = m_catapultCache.createDelta();
+				cacheDelta.calculateStateHash(Cache_Height);
+				m_catapultCache.commit(Cache_Height);
+			}
+
+		public:
+			auto& blockTemplate() {
+				return m_blockTemplate;
+			}
+
+			const auto& transactionInfos() const {
+				return m_transactionInfos;
+			}
+
+			size_t numPublishedEntities() const {
+				return m_executionConfig.pNotificationPublisher->params().size();
+			}
+
+		public:
+			void addTransactionInfos(const std::vector<std::pair<uint32_t, uint32_t>>& sizeMultiplierPairs) {
+				auto transactionInfos = test::CreateTransactionInfosFromSizeMultiplierPairs(sizeMultiplierPairs);
+				for (auto& transactionInfo : transactionInfos)
+					const_cast<model::Transaction&>(*transactionInfo.pEntity).Deadline = Timestamp(1000);
+
+				test::AddAll(*m_pUtCache, transactionInfos);
+
+				// add accounts to cache for fix up support
+				auto cacheDelta = m_catapultCache.createDelta();
+				auto& accountStateCache = cacheDelta.sub<cache::AccountStateCache>();
+				for (auto& transactionInfo : transactionInfos) {
+					accountStateCache.addAccount(transactionInfo.pEntity->SignerPublicKey, Cache_Height);
+					m_transactionInfos.push_back(std::move(transactionInfo));
+				}
+			}
+
+			void removeTransactionInfo(size_t index) {
+				m_pUtCache->modifier().remove(m_transactionInfos[index].EntityHash);
+			}
+
+			void commitCache() {
+				auto cacheDelta = m_catapultCache.createDelta();
+				m_catapultCache.commit(Cache_Height + Height(1));
+			}
+
+			void setValidationFailure() {
+				m_executionConfig.pValidator->setResult(validators::ValidationResult::Failure);
+			}
+
+		public:
+			auto generate(Height blockHeight) {
+				model::BlockHeader blockHeader;
+				PrepareBlockHeader(blockHeader, blockHeight);
+				return m_blockTemplate.generate(blockHeader, Max_Transactions_Per_Block);
+			}
+
+			auto generateFresh(Height blockHeight) {
+				model::BlockHeader blockHeader;
+				PrepareBlockHeader(blockHeader, blockHeight);
+				return m_generator(blockHeader, Max_Transactions_Per_Block);
+			}
+
+		private:
+			static void PrepareBlockHeader(model::BlockHeader& blockHeader, Height blockHeight) {
+				blockHeader.Height = blockHeight;
+				blockHeader.Timestamp = Timestamp(100);
+			}
+
+			static cache::CacheConfiguration CreateCacheConfiguration(const std::string& databaseDirectory) {
+				return cache::CacheConfiguration(databaseDirectory, utils::FileSize(), cache::PatriciaTreeStorageMode::Enabled);
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			model::BlockChainConfiguration m_config;
+			cache::CatapultCache m_catapultCache;
+			test::MockExecutionConfiguration m_executionConfig;
+			HarvestingUtFacadeFactory m_utFacadeFactory;
+			std::unique_ptr<cache::MemoryUtCache> m_pUtCache;
+			HarvesterBlockTemplate m_blockTemplate;
+			BlockGenerator m_generator;
+
+			std::vector<model::TransactionInfo> m_transactionInfos;
+		};
+
+		// endregion
+
+		void AssertTemplate(const HarvesterBlockTemplate& blockTemplate, size_t expectedSize, size_t expectedNumRebuilds) {
+			EXPECT_EQ(Cache_Height + Height(1), blockTemplate.height());
+			EXPECT_EQ(expectedSize, blockTemplate.size());
+			EXPECT_EQ(expectedNumRebuilds, blockTemplate.numRebuilds());
+		}
+	}
+
+#define STRATEGY_BASED_TEST(TEST_NAME) \
+	template<model::TransactionSelectionStrategy Strategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Oldest) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<model::TransactionSelectionStrategy::Oldest>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_MinimizeFee) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<model::TransactionSelectionStrategy::Minimize_Fee>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_MaximizeFee) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<model::TransactionSelectionStrategy::Maximize_Fee>(); \
+	} \
+	template<model::TransactionSelectionStrategy Strategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region constructor
+
+	TEST(TEST_CLASS, TemplateIsInitiallyEmpty) {
+		// Act:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+
+		// Assert:
+		EXPECT_EQ(Height(), context.blockTemplate().height());
+		EXPECT_EQ(0u, context.blockTemplate().size());
+		EXPECT_EQ(0u, context.blockTemplate().numRebuilds());
+	}
+
+	// endregion
+
+	// region update
+
+	STRATEGY_BASED_TEST(FirstUpdateBuildsTemplate) {
+		// Arrange:
+		TestContext context(Strategy);
+
+		// Act:
+		context.blockTemplate().update(Timestamp(100));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 1);
+		EXPECT_EQ(4u, context.numPublishedEntities());
+	}
+
+	STRATEGY_BASED_TEST(UpdateDoesNotReapplyTransactionsWhenUtCacheIsUnchanged) {
+		// Arrange:
+		TestContext context(Strategy);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act:
+		context.blockTemplate().update(Timestamp(101));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 1);
+		EXPECT_EQ(4u, context.numPublishedEntities());
+	}
+
+	STRATEGY_BASED_TEST(UpdateDoesNotPreventCacheCommit) {
+		// Arrange:
+		TestContext context(Strategy);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act: commit would deadlock if the template held any cache locks
+		context.commitCache();
+		context.blockTemplate().update(Timestamp(101));
+
+		// Assert: template was rebuilt on top of the new chain tip
+		EXPECT_EQ(Cache_Height + Height(2), context.blockTemplate().height());
+		EXPECT_EQ(4u, context.blockTemplate().size());
+		EXPECT_EQ(2u, context.blockTemplate().numRebuilds());
+		EXPECT_EQ(8u, context.numPublishedEntities());
+	}
+
+	STRATEGY_BASED_TEST(UpdateRebuildsTemplateWhenSelectedTransactionIsRemovedFromUtCache) {
+		// Arrange:
+		TestContext context(Strategy);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act: transaction 2 is selected by all strategies
+		context.removeTransactionInfo(2);
+		context.blockTemplate().update(Timestamp(101));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 2);
+		EXPECT_EQ(8u, context.numPublishedEntities());
+	}
+
+	STRATEGY_BASED_TEST(UpdateRebuildsTemplateWhenSelectedTransactionExpires) {
+		// Arrange:
+		TestContext context(Strategy);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act: all transactions have deadline 1000
+		context.blockTemplate().update(Timestamp(1001));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 2);
+		EXPECT_EQ(8u, context.numPublishedEntities());
+	}
+
+	TEST(TEST_CLASS, UpdateOnlyAppliesNewTransactionsWhenTemplateIsNotFull) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.removeTransactionInfo(4);
+		context.removeTransactionInfo(3);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act:
+		context.addTransactionInfos({ { 206, 200 } });
+		context.blockTemplate().update(Timestamp(101));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 1);
+		EXPECT_EQ(4u, context.numPublishedEntities());
+	}
+
+	TEST(TEST_CLASS, UpdateIgnoresNewTransactionsWhenTemplateIsFull_Oldest) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act:
+		context.addTransactionInfos({ { 206, 300 } });
+		context.blockTemplate().update(Timestamp(101));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 1);
+		EXPECT_EQ(4u, context.numPublishedEntities());
+	}
+
+	TEST(TEST_CLASS, UpdateRebuildsTemplateWhenNewTransactionIsOrderedBeforeSelectedTransactions_MinimizeFee) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Minimize_Fee);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act:
+		context.addTransactionInfos({ { 206, 50 } });
+		context.blockTemplate().update(Timestamp(101));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 2);
+		EXPECT_EQ(8u, context.numPublishedEntities());
+	}
+
+	TEST(TEST_CLASS, UpdateRebuildsTemplateWhenNewTransactionIsOrderedBeforeSelectedTransactions_MaximizeFee) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Maximize_Fee);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act:
+		context.addTransactionInfos({ { 206, 300 } });
+		context.blockTemplate().update(Timestamp(101));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 2);
+		EXPECT_EQ(8u, context.numPublishedEntities());
+	}
+
+	TEST(TEST_CLASS, UpdateIgnoresNewTransactionsOrderedAfterSelectedTransactionsWhenTemplateIsFull_MaximizeFee) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Maximize_Fee);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act:
+		context.addTransactionInfos({ { 206, 50 } });
+		context.blockTemplate().update(Timestamp(101));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 1);
+		EXPECT_EQ(4u, context.numPublishedEntities());
+	}
+
+	// endregion
+
+	// region generate
+
+	TEST(TEST_CLASS, GenerationFailsWhenBlockHeightMismatchDetected) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+
+		// Act: use mismatched height
+		auto pBlock = context.generate(Cache_Height);
+
+		// Assert: template is preserved
+		EXPECT_FALSE(!!pBlock);
+		AssertTemplate(context.blockTemplate(), 4, 1);
+	}
+
+	TEST(TEST_CLASS, GenerationFailsWhenUtProcessingFails) {
+		// Arrange: set validation failure
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.setValidationFailure();
+
+		// Act:
+		auto pBlock = context.generate(Cache_Height + Height(1));
+
+		// Assert:
+		EXPECT_FALSE(!!pBlock);
+	}
+
+	STRATEGY_BASED_TEST(GenerationConsumesTemplate) {
+		// Arrange:
+		TestContext context(Strategy);
+		context.blockTemplate().update(Timestamp(100));
+
+		// Act:
+		auto pBlock = context.generate(Cache_Height + Height(1));
+
+		// Assert:
+		ASSERT_TRUE(!!pBlock);
+		EXPECT_EQ(Height(), context.blockTemplate().height());
+		EXPECT_EQ(0u, context.blockTemplate().size());
+		EXPECT_EQ(1u, context.blockTemplate().numRebuilds());
+
+		// Act: next update rebuilds the template
+		context.blockTemplate().update(Timestamp(101));
+
+		// Assert:
+		AssertTemplate(context.blockTemplate(), 4, 2);
+	}
+
+	STRATEGY_BASED_TEST(GenerationProducesSameBlockAsDefaultGenerator) {
+		// Arrange:
+		TestContext context(Strategy);
+		context.blockTemplate().update(Timestamp(100));
+		context.addTransactionInfos({ { 206, 150 }, { 207, 50 } });
+
+		// Act:
+		auto pExpectedBlock = context.generateFresh(Cache_Height + Height(1));
+		auto pBlock = context.generate(Cache_Height + Height(1));
+
+		// Assert:
+		ASSERT_TRUE(!!pExpectedBlock);
+		ASSERT_TRUE(!!pBlock);
+		EXPECT_NE(0u, model::CalculateBlockTransactionsInfo(*pBlock).Count);
+		EXPECT_EQ(*pExpectedBlock, *pBlock);
+	}
+
+	STRATEGY_BASED_TEST(GenerationProducesSameBlockAsDefaultGeneratorAfterRebuild) {
+		// Arrange: transaction 2 is selected by all strategies, so removing it rebuilds the template
+		TestContext context(Strategy);
+		context.blockTemplate().update(Timestamp(100));
+		context.removeTransactionInfo(2);
+		context.blockTemplate().update(Timestamp(101));
+
+		// Act:
+		auto pExpectedBlock = context.generateFresh(Cache_Height + Height(1));
+		auto pBlock = context.generate(Cache_Height + Height(1));
+
+		// Assert:
+		ASSERT_TRUE(!!pExpectedBlock);
+		ASSERT_TRUE(!!pBlock);
+		EXPECT_EQ(2u, context.blockTemplate().numRebuilds());
+		EXPECT_NE(0u, model::CalculateBlockTransactionsInfo(*pBlock).Count);
+		EXPECT_EQ(*pExpectedBlock, *pBlock);
+	}
+
+	// endregion
+}}
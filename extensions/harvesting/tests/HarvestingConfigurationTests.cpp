@@ -41,7 +41,9 @@ namespace catapult { namespace harvesting {
 							{ "enableAutoHarvesting", "true" },
 							{ "maxUnlockedAccounts", "2" },
 							{ "delegatePrioritizationPolicy", "Importance" },
-							{ "beneficiaryPublicKey", "beneficiary-key" }
+							{ "beneficiaryPublicKey", "beneficiary-key" },
+
+							{ "enableSpeculativeValidation", "true" }
 						}
 					}
 				};
@@ -60,6 +62,8 @@ namespace catapult { namespace harvesting {
 				EXPECT_EQ(0u, config.MaxUnlockedAccounts);
 				EXPECT_EQ(DelegatePrioritizationPolicy::Age, config.DelegatePrioritizationPolicy);
 				EXPECT_EQ("", config.BeneficiaryPublicKey);
+
+				EXPECT_FALSE(config.EnableSpeculativeValidation);
 			}
 
 			static void AssertCustom(const HarvestingConfiguration& config) {
@@ -71,6 +75,8 @@ namespace catapult { namespace harvesting {
 				EXPECT_EQ(2u, config.MaxUnlockedAccounts);
 				EXPECT_EQ(DelegatePrioritizationPolicy::Importance, config.DelegatePrioritizationPolicy);
 				EXPECT_EQ("beneficiary-key", config.BeneficiaryPublicKey);
+
+				EXPECT_TRUE(config.EnableSpeculativeValidation);
 			}
 		};
 	}
@@ -96,6 +102,8 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ(5u, config.MaxUnlockedAccounts);
 		EXPECT_EQ(DelegatePrioritizationPolicy::Importance, config.DelegatePrioritizationPolicy);
 		EXPECT_EQ("0000000000000000000000000000000000000000000000000000000000000000", config.BeneficiaryPublicKey);
+
+		EXPECT_FALSE(config.EnableSpeculativeValidation);
 	}
 
 	// endregion
@@ -51,6 +51,7 @@ namespace catapult { namespace harvesting {
 			config.EnableAutoHarvesting = test::LocalNodeFlags::Should_Auto_Harvest == flags;
 			config.MaxUnlockedAccounts = 10;
 			config.BeneficiaryPublicKey = std::string(64, '0');
+			config.EnableSpeculativeValidation = false;
 			return config;
 		}
 
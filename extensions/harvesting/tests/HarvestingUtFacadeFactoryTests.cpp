@@ -381,6 +381,225 @@ namespace catapult { namespace harvesting {
 
 	// endregion
 
+	// region setBlockTime
+
+	TEST(TEST_CLASS, SetBlockTimeChangesTimeUsedByValidatorContexts) {
+		// Arrange:
+		RunUtFacadeTest([](auto& facade, const auto& executionConfig) {
+			auto transactionInfos = test::CreateTransactionInfos(2);
+
+			// Act:
+			facade.setBlockTime(Default_Time + Timestamp(100));
+			for (const auto& transactionInfo : transactionInfos)
+				facade.apply(transactionInfo);
+
+			// Assert:
+			EXPECT_EQ(2u, facade.size());
+			test::MockExecutionConfiguration::AssertValidatorContexts(
+					*executionConfig.pValidator,
+					{ 0, 1, 2, 3 },
+					Default_Height + Height(1),
+					Default_Time + Timestamp(100));
+		});
+	}
+
+	// endregion
+
+	// region unlock / tryLock
+
+	namespace {
+		template<typename TAction>
+		void RunRelockableUtFacadeTest(TAction action) {
+			// Arrange: create factory and facade with two applied transactions
+			auto catapultCache = test::CreateCatapultCacheWithMarkerAccount(Default_Height);
+			SetDependentState(catapultCache);
+
+			test::MockExecutionConfiguration executionConfig;
+			HarvestingUtFacadeFactory factory(catapultCache, CreateBlockChainConfiguration(), executionConfig.Config);
+
+			auto pFacade = factory.create(Default_Time);
+			ASSERT_TRUE(!!pFacade);
+
+			auto transactionInfos = test::CreateTransactionInfos(2);
+			for (const auto& transactionInfo : transactionInfos)
+				pFacade->apply(transactionInfo);
+
+			// Act + Assert:
+			action(*pFacade, catapultCache, transactionInfos);
+		}
+	}
+
+	TEST(TEST_CLASS, CanRelockFacadeWhenCacheIsUnchanged) {
+		// Arrange:
+		RunRelockableUtFacadeTest([](auto& facade, const auto&, const auto& transactionInfos) {
+			// Act:
+			facade.unlock();
+			auto isLocked = facade.tryLock();
+
+			// Assert: applied transactions are preserved
+			EXPECT_TRUE(isLocked);
+			EXPECT_EQ(Default_Height + Height(1), facade.height());
+			EXPECT_EQ(2u, facade.size());
+			test::AssertEquivalent(transactionInfos, facade.transactionInfos());
+
+			// - facade can be used again
+			EXPECT_TRUE(facade.apply(test::CreateRandomTransactionInfo()));
+			EXPECT_EQ(3u, facade.size());
+		});
+	}
+
+	TEST(TEST_CLASS, CanRelockFacadeMultipleTimes) {
+		// Arrange:
+		RunRelockableUtFacadeTest([](auto& facade, const auto&, const auto&) {
+			// Act + Assert:
+			EXPECT_TRUE(facade.tryLock());
+
+			facade.unlock();
+			facade.unlock();
+			EXPECT_TRUE(facade.tryLock());
+			EXPECT_TRUE(facade.tryLock());
+		});
+	}
+
+	TEST(TEST_CLASS, UnlockedFacadeDoesNotBlockCacheCommit) {
+		// Arrange:
+		RunRelockableUtFacadeTest([](auto& facade, auto& catapultCache, const auto&) {
+			// Act: commit would deadlock if facade held any cache locks
+			facade.unlock();
+			{
+				auto cacheDelta = catapultCache.createDelta();
+				catapultCache.commit(Default_Height + Height(1));
+			}
+
+			auto isLocked = facade.tryLock();
+
+			// Assert: facade is stale and cannot be relocked
+			EXPECT_FALSE(isLocked);
+		});
+	}
+
+	TEST(TEST_CLASS, CannotApplyTransactionsWhenUnlocked) {
+		// Arrange:
+		RunRelockableUtFacadeTest([](auto& facade, const auto&, const auto&) {
+			// Act:
+			facade.unlock();
+
+			// Assert:
+			EXPECT_THROW(facade.apply(test::CreateRandomTransactionInfo()), catapult_runtime_error);
+			EXPECT_EQ(2u, facade.size());
+		});
+	}
+
+	TEST(TEST_CLASS, CannotCommitWhenUnlocked) {
+		// Arrange:
+		RunRelockableUtFacadeTest([](auto& facade, const auto&, const auto&) {
+			auto pBlockHeader = std::make_unique<model::BlockHeader>();
+			pBlockHeader->Size = sizeof(model::BlockHeader);
+			pBlockHeader->Height = Default_Height + Height(1);
+
+			// Act:
+			facade.unlock();
+
+			// Assert:
+			EXPECT_THROW(facade.commit(*pBlockHeader), catapult_runtime_error);
+		});
+	}
+
+	// endregion
+
+	// region prevalidate
+
+	namespace {
+		template<typename TAction>
+		void RunPrevalidatingUtFacadeTest(TAction action) {
+			// Arrange: create factory and facade with a sequential validation partition runner
+			auto catapultCache = test::CreateCatapultCacheWithMarkerAccount(Default_Height);
+			SetDependentState(catapultCache);
+
+			test::MockExecutionConfiguration executionConfig;
+			auto validationPartitionRunner = [](auto count, const auto& callback) { callback(0, count); };
+			HarvestingUtFacadeFactory factory(
+					catapultCache,
+					CreateBlockChainConfiguration(),
+					executionConfig.Config,
+					validationPartitionRunner);
+
+			auto pFacade = factory.create(Default_Time);
+			ASSERT_TRUE(!!pFacade);
+
+			// Act + Assert:
+			action(*pFacade, executionConfig);
+		}
+
+		std::vector<const model::TransactionInfo*> ToPointers(const std::vector<model::TransactionInfo>& transactionInfos) {
+			std::vector<const model::TransactionInfo*> transactionInfoPointers;
+			for (const auto& transactionInfo : transactionInfos)
+				transactionInfoPointers.push_back(&transactionInfo);
+
+			return transactionInfoPointers;
+		}
+	}
+
+	TEST(TEST_CLASS, PrevalidateIsNoOpWhenFacadeIsCreatedWithoutPartitionRunner) {
+		// Arrange:
+		RunUtFacadeTest([](auto& facade, const auto& executionConfig) {
+			auto transactionInfos = test::CreateTransactionInfos(4);
+
+			// Act:
+			facade.prevalidate(ToPointers(transactionInfos));
+
+			// Assert:
+			EXPECT_FALSE(facade.canPrevalidate());
+			EXPECT_EQ(0u, executionConfig.pNotificationPublisher->params().size());
+			EXPECT_EQ(0u, executionConfig.pValidator->params().size());
+			AssertEmpty(facade);
+		});
+	}
+
+	TEST(TEST_CLASS, PrevalidateValidatesTransactionsWithoutApplyingThemWhenFacadeIsCreatedWithPartitionRunner) {
+		// Arrange:
+		RunPrevalidatingUtFacadeTest([](auto& facade, const auto& executionConfig) {
+			auto transactionInfos = test::CreateTransactionInfos(4);
+			auto transactionHashes = test::ExtractHashes(transactionInfos);
+
+			// Act:
+			facade.prevalidate(ToPointers(transactionInfos));
+
+			// Assert: validator but not observer was called for all notifications (2 per transaction)
+			EXPECT_TRUE(facade.canPrevalidate());
+			EXPECT_EQ(4u, executionConfig.pNotificationPublisher->params().size());
+
+			std::vector<std::pair<size_t, size_t>> expectedIndexIdPairs{
+				{ 0, 1 }, { 0, 2 }, { 1, 1 }, { 1, 2 }, { 2, 1 }, { 2, 2 }, { 3, 1 }, { 3, 2 }
+			};
+			AssertEntityInfos("validator", executionConfig.pValidator->params(), transactionHashes, expectedIndexIdPairs);
+			AssertValidatorContexts(executionConfig, { 0, 0, 0, 0, 0, 0, 0, 0 });
+			EXPECT_EQ(0u, executionConfig.pObserver->params().size());
+			AssertEmpty(facade);
+		});
+	}
+
+	TEST(TEST_CLASS, ApplyExecutesTransactionsWithInconclusiveSpeculativeFailures) {
+		// Arrange: mock notifications are not tracked, so speculative failures are inconclusive
+		RunPrevalidatingUtFacadeTest([](auto& facade, const auto& executionConfig) {
+			auto transactionInfos = test::CreateTransactionInfos(4);
+			executionConfig.pValidator->setResult(validators::ValidationResult::Failure, transactionInfos[1].EntityHash, 1);
+			facade.prevalidate(ToPointers(transactionInfos));
+
+			// Act:
+			std::vector<bool> applyResults;
+			for (const auto& transactionInfo : transactionInfos)
+				applyResults.push_back(facade.apply(transactionInfo));
+
+			// Assert: all transactions were executed
+			EXPECT_EQ(std::vector<bool>({ true, false, true, true }), applyResults);
+			EXPECT_EQ(8u, executionConfig.pNotificationPublisher->params().size());
+			EXPECT_EQ(3u, facade.size());
+		});
+	}
+
+	// endregion
+
 	// region commit - validation
 
 	namespace {
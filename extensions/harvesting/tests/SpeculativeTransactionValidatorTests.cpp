@@ -0,0 +1,482 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "harvesting/src/SpeculativeTransactionValidator.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/validators/AggregateNotificationValidator.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/ResolverTestUtils.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
+#include "tests/test/other/MockExecutionConfiguration.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace harvesting {
+
+#define TEST_CLASS SpeculativeTransactionValidatorTests
+
+	namespace {
+		constexpr auto Network_Identifier = model::NetworkIdentifier::Mijin_Test;
+
+		// region TestNotificationPublisher
+
+		// publishes an account public key notification for the signer followed by optional
+		// account address (tracked) and mock (untracked) notifications
+		class TestNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void setRecipient(const Hash256& hash, const Address& recipient) {
+				m_recipients.emplace(hash, test::UnresolveXor(recipient));
+			}
+
+			void setUntracked(const Hash256& hash) {
+				m_untrackedHashes.insert(hash);
+			}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				sub.notify(model::AccountPublicKeyNotification(entityInfo.entity().SignerPublicKey));
+
+				auto recipientIter = m_recipients.find(entityInfo.hash());
+				if (m_recipients.cend() != recipientIter)
+					sub.notify(model::AccountAddressNotification(recipientIter->second));
+
+				if (m_untrackedHashes.cend() != m_untrackedHashes.find(entityInfo.hash()))
+					sub.notify(test::MockNotification(entityInfo.hash(), 1));
+			}
+
+		private:
+			std::unordered_map<Hash256, UnresolvedAddress, utils::ArrayHasher<Hash256>> m_recipients;
+			std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> m_untrackedHashes;
+		};
+
+		// endregion
+
+		// region TestValidator
+
+		// fails account public key notifications for configured signers and succeeds all other notifications
+		class TestValidator : public validators::stateful::AggregateNotificationValidator {
+		public:
+			TestValidator() : m_name("TestValidator"), m_numValidateCalls(0)
+			{}
+
+		public:
+			size_t numValidateCalls() const {
+				return m_numValidateCalls;
+			}
+
+			void setFailure(const Key& signer) {
+				m_failedSigners.insert(signer);
+			}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { m_name };
+			}
+
+			validators::ValidationResult validate(
+					const model::Notification& notification,
+					const validators::ValidatorContext&) const override {
+				++m_numValidateCalls;
+				if (model::Core_Register_Account_Public_Key_Notification != notification.Type)
+					return validators::ValidationResult::Success;
+
+				const auto& publicKey = static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey;
+				return m_failedSigners.cend() != m_failedSigners.find(publicKey)
+						? validators::ValidationResult::Failure
+						: validators::ValidationResult::Success;
+			}
+
+		private:
+			std::string m_name;
+			utils::KeySet m_failedSigners;
+			mutable std::atomic<size_t> m_numValidateCalls;
+		};
+
+		// endregion
+
+		// region TestContext
+
+		model::BlockChainConfiguration CreateBlockChainConfiguration() {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.Network.Identifier = Network_Identifier;
+			return config;
+		}
+
+		utils::PartitionRunner CreateSequentialPartitionRunner() {
+			return [](auto count, const auto& callback) {
+				callback(0, count);
+			};
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(size_t numTransactions)
+					: TestContext(numTransactions, CreateSequentialPartitionRunner())
+			{}
+
+			TestContext(size_t numTransactions, const utils::PartitionRunner& partitionRunner)
+					: m_pPublisher(std::make_shared<TestNotificationPublisher>())
+					, m_pValidator(std::make_shared<TestValidator>())
+					, m_cache(test::CreateEmptyCatapultCache(CreateBlockChainConfiguration()))
+					, m_cacheDelta(m_cache.createDelta())
+					, m_transactionInfos(test::CreateTransactionInfos(numTransactions))
+					, m_validator(createExecutionConfiguration(), partitionRunner) {
+				// all signers are known accounts
+				for (const auto& transactionInfo : m_transactionInfos)
+					addAccount(transactionInfo.pEntity->SignerPublicKey);
+			}
+
+		public:
+			auto& validator() {
+				return m_validator;
+			}
+
+			const auto& transactionInfos() const {
+				return m_transactionInfos;
+			}
+
+			const auto& hash(size_t index) const {
+				return m_transactionInfos[index].EntityHash;
+			}
+
+			Address signerAddress(size_t index) const {
+				return model::PublicKeyToAddress(m_transactionInfos[index].pEntity->SignerPublicKey, Network_Identifier);
+			}
+
+			size_t numValidateCalls() const {
+				return m_pValidator->numValidateCalls();
+			}
+
+		public:
+			void addAccount(const Key& publicKey) {
+				m_cacheDelta.sub<cache::AccountStateCache>().addAccount(publicKey, Height(1));
+			}
+
+			void addAccount(const Address& address) {
+				m_cacheDelta.sub<cache::AccountStateCache>().addAccount(address, Height(1));
+			}
+
+			void setFailure(size_t index) {
+				m_pValidator->setFailure(m_transactionInfos[index].pEntity->SignerPublicKey);
+			}
+
+			void setRecipient(size_t index, const Address& recipient) {
+				m_pPublisher->setRecipient(hash(index), recipient);
+			}
+
+			void setUntracked(size_t index) {
+				m_pPublisher->setUntracked(hash(index));
+			}
+
+		public:
+			void validate() {
+				std::vector<const model::TransactionInfo*> transactionInfoPointers;
+				for (const auto& transactionInfo : m_transactionInfos)
+					transactionInfoPointers.push_back(&transactionInfo);
+
+				m_validator.validate(transactionInfoPointers, Height(10), Timestamp(987), m_cacheDelta);
+			}
+
+			std::vector<bool> getKnownInvalidFlags() const {
+				std::vector<bool> flags;
+				for (const auto& transactionInfo : m_transactionInfos)
+					flags.push_back(m_validator.isKnownInvalid(transactionInfo.EntityHash));
+
+				return flags;
+			}
+
+		private:
+			chain::ExecutionConfiguration createExecutionConfiguration() const {
+				chain::ExecutionConfiguration executionConfig;
+				executionConfig.Network.Identifier = Network_Identifier;
+				executionConfig.ResolverContextFactory = [](const auto&) {
+					return test::CreateResolverContextXor();
+				};
+				executionConfig.pValidator = m_pValidator;
+				executionConfig.pNotificationPublisher = m_pPublisher;
+				return executionConfig;
+			}
+
+		private:
+			std::shared_ptr<TestNotificationPublisher> m_pPublisher;
+			std::shared_ptr<TestValidator> m_pValidator;
+			cache::CatapultCache m_cache;
+			cache::CatapultCacheDelta m_cacheDelta;
+			std::vector<model::TransactionInfo> m_transactionInfos;
+			SpeculativeTransactionValidator m_validator;
+		};
+
+		// endregion
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateValidator) {
+		// Act:
+		TestContext context(3);
+
+		// Assert:
+		EXPECT_EQ(0u, context.validator().size());
+		EXPECT_EQ(std::vector<bool>(3, false), context.getKnownInvalidFlags());
+	}
+
+	// endregion
+
+	// region validate
+
+	TEST(TEST_CLASS, ValidateProducesResultsForAllTransactions) {
+		// Arrange:
+		TestContext context(4);
+
+		// Act:
+		context.validate();
+
+		// Assert:
+		EXPECT_EQ(4u, context.validator().size());
+		EXPECT_EQ(4u, context.numValidateCalls());
+	}
+
+	TEST(TEST_CLASS, ValidateDoesNotCallPartitionRunnerWhenThereAreNoTransactions) {
+		// Arrange:
+		auto numRunnerCalls = 0u;
+		TestContext context(0, [&numRunnerCalls](auto, const auto&) {
+			++numRunnerCalls;
+		});
+
+		// Act:
+		context.validate();
+
+		// Assert:
+		EXPECT_EQ(0u, context.validator().size());
+		EXPECT_EQ(0u, numRunnerCalls);
+	}
+
+	TEST(TEST_CLASS, ValidateReplacesPreviousResults) {
+		// Arrange:
+		TestContext context(4);
+		context.setFailure(1);
+		context.validate();
+		context.validator().notifyApplied(context.hash(0));
+
+		// Act:
+		context.validate();
+
+		// Assert:
+		EXPECT_EQ(4u, context.validator().size());
+		EXPECT_EQ(8u, context.numValidateCalls());
+		EXPECT_EQ(std::vector<bool>({ false, true, false, false }), context.getKnownInvalidFlags());
+	}
+
+	namespace {
+		void AssertCanValidateWithPartitionRunner(size_t numTransactions, const utils::PartitionRunner& runner) {
+			// Arrange: fail every third transaction
+			TestContext context(numTransactions, runner);
+			std::vector<bool> expectedFlags;
+			for (auto i = 0u; i < numTransactions; ++i) {
+				if (0 == i % 3)
+					context.setFailure(i);
+
+				expectedFlags.push_back(0 == i % 3);
+			}
+
+			// Act:
+			context.validate();
+
+			// Assert:
+			EXPECT_EQ(numTransactions, context.validator().size());
+			EXPECT_EQ(numTransactions, context.numValidateCalls());
+			EXPECT_EQ(expectedFlags, context.getKnownInvalidFlags());
+		}
+	}
+
+	TEST(TEST_CLASS, CanValidateWithSinglePartition) {
+		AssertCanValidateWithPartitionRunner(10, CreateSequentialPartitionRunner());
+	}
+
+	TEST(TEST_CLASS, CanValidateWithMultiplePartitions) {
+		AssertCanValidateWithPartitionRunner(10, [](auto count, const auto& callback) {
+			for (auto i = 0u; i < count; ++i)
+				callback(i, 1);
+		});
+	}
+
+	TEST(TEST_CLASS, CanValidateWithMultiplePartitionsInParallel) {
+		AssertCanValidateWithPartitionRunner(100, [](auto count, const auto& callback) {
+			constexpr auto Num_Threads = 4u;
+			auto partitionSize = (count + Num_Threads - 1) / Num_Threads;
+
+			std::vector<std::thread> threads;
+			for (auto startIndex = 0u; startIndex < count; startIndex += partitionSize) {
+				threads.emplace_back([startIndex, partitionSize, count, &callback]() {
+					callback(startIndex, std::min<size_t>(partitionSize, count - startIndex));
+				});
+			}
+
+			for (auto& thread : threads)
+				thread.join();
+		});
+	}
+
+	// endregion
+
+	// region isKnownInvalid - speculative result
+
+	TEST(TEST_CLASS, SpeculativeSuccessIsNotKnownInvalid) {
+		// Arrange:
+		TestContext context(3);
+
+		// Act:
+		context.validate();
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(3, false), context.getKnownInvalidFlags());
+	}
+
+	TEST(TEST_CLASS, SpeculativeFailureIsKnownInvalidWhenAllAccountsAreKnown) {
+		// Arrange:
+		TestContext context(3);
+		auto recipient = test::GenerateRandomByteArray<Address>();
+		context.addAccount(recipient);
+		context.setRecipient(1, recipient);
+		context.setFailure(1);
+
+		// Act:
+		context.validate();
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>({ false, true, false }), context.getKnownInvalidFlags());
+	}
+
+	TEST(TEST_CLASS, SpeculativeFailureIsNotKnownInvalidWhenAnyAccountIsUnknown) {
+		// Arrange: recipient account would be created by the transaction itself
+		TestContext context(3);
+		context.setRecipient(1, test::GenerateRandomByteArray<Address>());
+		context.setFailure(1);
+
+		// Act:
+		context.validate();
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(3, false), context.getKnownInvalidFlags());
+	}
+
+	TEST(TEST_CLASS, SpeculativeFailureIsNotKnownInvalidWhenTransactionRaisesUntrackedNotifications) {
+		// Arrange:
+		TestContext context(3);
+		context.setUntracked(1);
+		context.setFailure(1);
+
+		// Act:
+		context.validate();
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(3, false), context.getKnownInvalidFlags());
+	}
+
+	// endregion
+
+	// region isKnownInvalid - notifyApplied
+
+	TEST(TEST_CLASS, SpeculativeFailureIsKnownInvalidAfterApplyingTransactionTouchingDisjointAccounts) {
+		// Arrange:
+		TestContext context(3);
+		context.setFailure(1);
+		context.validate();
+
+		// Act:
+		context.validator().notifyApplied(context.hash(0));
+		context.validator().notifyApplied(context.hash(2));
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>({ false, true, false }), context.getKnownInvalidFlags());
+	}
+
+	TEST(TEST_CLASS, SpeculativeFailureIsNotKnownInvalidAfterApplyingTransactionTouchingSameAccount) {
+		// Arrange: transaction 0 touches (sends to) the signer of failed transaction 1
+		TestContext context(3);
+		context.setRecipient(0, context.signerAddress(1));
+		context.setFailure(1);
+		context.validate();
+
+		// Sanity:
+		EXPECT_TRUE(context.validator().isKnownInvalid(context.hash(1)));
+
+		// Act:
+		context.validator().notifyApplied(context.hash(0));
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(3, false), context.getKnownInvalidFlags());
+	}
+
+	TEST(TEST_CLASS, SpeculativeFailureIsNotKnownInvalidAfterApplyingTransactionRaisingUntrackedNotifications) {
+		// Arrange:
+		TestContext context(3);
+		context.setUntracked(0);
+		context.setFailure(1);
+		context.validate();
+
+		// Act:
+		context.validator().notifyApplied(context.hash(0));
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(3, false), context.getKnownInvalidFlags());
+	}
+
+	TEST(TEST_CLASS, SpeculativeFailureIsNotKnownInvalidAfterApplyingTransactionWithoutSpeculativeResult) {
+		// Arrange:
+		TestContext context(3);
+		context.setFailure(1);
+		context.validate();
+
+		// Act:
+		context.validator().notifyApplied(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(3, false), context.getKnownInvalidFlags());
+	}
+
+	// endregion
+
+	// region reset
+
+	TEST(TEST_CLASS, ResetDiscardsAllResults) {
+		// Arrange:
+		TestContext context(3);
+		context.setFailure(1);
+		context.validate();
+
+		// Act:
+		context.validator().reset();
+
+		// Assert:
+		EXPECT_EQ(0u, context.validator().size());
+		EXPECT_EQ(std::vector<bool>(3, false), context.getKnownInvalidFlags());
+	}
+
+	// endregion
+}}
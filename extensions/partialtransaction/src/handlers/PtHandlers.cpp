@@ -62,9 +62,7 @@ namespace catapult { namespace handlers {
 				return PullTransactionsInfo();
 
 			PullTransactionsInfo info;
-			info.ShortHashPairs.reserve(range.size());
-			for (const auto& hashPair : range)
-				info.ShortHashPairs.emplace(hashPair.TransactionShortHash, hashPair.CosignaturesShortHash);
+			info.ShortHashPairs = cache::ShortHashPairMap(std::vector<cache::ShortHashPair>(range.cbegin(), range.cend()));
 
 			info.IsValid = true;
 			return info;
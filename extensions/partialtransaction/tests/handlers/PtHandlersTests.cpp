@@ -110,14 +110,14 @@ namespace catapult { namespace handlers {
 
 	namespace {
 		auto ExtractFromPacket(const ionet::Packet& packet, size_t numRequestHashPairs) {
-			cache::ShortHashPairMap extractedMap;
+			std::vector<cache::ShortHashPair> extractedPairs;
 			auto pData = reinterpret_cast<const cache::ShortHashPair*>(packet.Data());
 			for (auto i = 0u; i < numRequestHashPairs; ++i) {
-				extractedMap.emplace(pData->TransactionShortHash, pData->CosignaturesShortHash);
+				extractedPairs.push_back(*pData);
 				++pData;
 			}
 
-			return extractedMap;
+			return cache::ShortHashPairMap(std::move(extractedPairs));
 		}
 
 		class PullResponseContext {
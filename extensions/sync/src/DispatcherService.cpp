@@ -97,7 +97,7 @@ namespace catapult { namespace sync {
 		std::unique_ptr<ConsumerDispatcher> CreateConsumerDispatcher(
 				extensions::ServiceState& state,
 				const ConsumerDispatcherOptions& options,
-				std::vector<DisruptorConsumer>&& disruptorConsumers) {
+				DisruptorConsumerLevels&& consumerLevels) {
 			auto& nodeSubscriber = state.nodeSubscriber();
 			auto& statusSubscriber = state.transactionStatusSubscriber();
 			auto reclaimMemoryInspector = CreateReclaimMemoryInspector();
@@ -130,10 +130,10 @@ namespace catapult { namespace sync {
 				CATAPULT_LOG(debug) << "enabling auditing to " << auditPath;
 
 				boost::filesystem::create_directories(auditPath);
-				disruptorConsumers.insert(disruptorConsumers.begin(), CreateAuditConsumer(auditPath.generic_string()));
+				consumerLevels.insert(consumerLevels.begin(), { CreateAuditConsumer(auditPath.generic_string()) });
 			}
 
-			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumers, inspector);
+			return std::make_unique<ConsumerDispatcher>(options, consumerLevels, inspector);
 		}
 
 		// endregion
@@ -196,7 +196,9 @@ namespace catapult { namespace sync {
 			auto dataDirectory = config::CatapultDataDirectory(state.config().User.DataDirectory);
 			syncHandlers.PreStateWritten = [](const auto&, auto) {};
 			syncHandlers.TransactionsChange = state.hooks().transactionsChangeHandler();
-			syncHandlers.CommitStep = extensions::CreateCommitStepHandler(dataDirectory);
+			syncHandlers.CommitStep = extensions::CreateCommitStepHandler(
+					dataDirectory,
+					extensions::CreateStateDurabilityBarrier(state.pluginManager()));
 
 			if (state.config().Node.EnableCacheDatabaseStorage)
 				AddSupplementalDataResiliency(syncHandlers, dataDirectory, state.cache(), state.score());
@@ -230,17 +232,25 @@ namespace catapult { namespace sync {
 						m_nodeConfig.MaxBlocksPerSyncAttempt,
 						m_state.config().BlockChain.MaxBlockFutureTime,
 						m_state.timeSupplier()));
-				m_consumers.push_back(CreateBlockStatelessValidationConsumer(
+				auto consumerLevels = ToSequentialConsumerLevels(DisruptorConsumersFromBlockConsumers(m_consumers));
+
+				// stateless validation and signature verification only read blocks, so they can process each element concurrently
+				std::vector<BlockConsumer> validationConsumers;
+				validationConsumers.push_back(CreateBlockStatelessValidationConsumer(
 						CreateParallelValidationPolicy(pValidatorPool, m_state.pluginManager()),
 						requiresValidationPredicate));
-				m_consumers.push_back(CreateBlockBatchSignatureConsumer(
+
+				// each consumer runs on its own dispatcher thread, so signatures of an element are verified
+				// while previous elements are still being synced
+				validationConsumers.push_back(CreateBlockBatchSignatureConsumer(
 						m_state.config().BlockChain.Network.GenerationHashSeed,
 						CreateRandomFiller(m_state.config().Node.BatchVerificationRandomSource),
 						m_state.pluginManager().createNotificationPublisher(),
 						pValidatorPool,
 						requiresValidationPredicate));
 
-				auto disruptorConsumers = DisruptorConsumersFromBlockConsumers(m_consumers);
+				consumerLevels.push_back(DisruptorConsumersFromBlockConsumers(validationConsumers));
+				std::vector<DisruptorConsumer> disruptorConsumers;
 				disruptorConsumers.push_back(CreateBlockChainSyncConsumer(
 						m_state.cache(),
 						m_state.storage(),
@@ -255,10 +265,13 @@ namespace catapult { namespace sync {
 						utils::to_underlying_type(InputSource::Local)
 						| utils::to_underlying_type(InputSource::Remote_Push));
 				disruptorConsumers.push_back(CreateNewBlockConsumer(m_state.hooks().newBlockSink(), newBlockSinkSourceMask));
+
+				auto sequentialConsumerLevels = ToSequentialConsumerLevels(disruptorConsumers);
+				consumerLevels.insert(consumerLevels.end(), sequentialConsumerLevels.cbegin(), sequentialConsumerLevels.cend());
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateBlockConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						std::move(consumerLevels));
 			}
 
 		private:
@@ -339,10 +352,11 @@ namespace catapult { namespace sync {
 					utUpdater.update(std::move(transactionInfos));
 				}));
 
+				// transaction validation consumers update the result severities of elements, so they need to run sequentially
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateTransactionConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						ToSequentialConsumerLevels(disruptorConsumers));
 			}
 
 		private:
@@ -48,6 +48,7 @@ namespace catapult { namespace cache {
 			, MosaicCacheDeltaMixins::Contains(*mosaicSets.pPrimary)
 			, MosaicCacheDeltaMixins::ConstAccessor(*mosaicSets.pPrimary)
 			, MosaicCacheDeltaMixins::MutableAccessor(*mosaicSets.pPrimary)
+			, MosaicCacheDeltaMixins::Prefetch(*mosaicSets.pPrimary)
 			, MosaicCacheDeltaMixins::PatriciaTreeDelta(*mosaicSets.pPrimary, mosaicSets.pPatriciaTree)
 			, MosaicCacheDeltaMixins::ActivePredicate(*mosaicSets.pPrimary)
 			, MosaicCacheDeltaMixins::BasicInsertRemove(*mosaicSets.pPrimary)
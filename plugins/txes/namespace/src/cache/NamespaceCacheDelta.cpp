@@ -46,6 +46,7 @@ namespace catapult { namespace cache {
 				const NamespaceSizes& namespaceSizes)
 			: NamespaceCacheDeltaMixins::Size(*namespaceSets.pPrimary)
 			, NamespaceCacheDeltaMixins::Contains(*namespaceSets.pFlatMap)
+			, NamespaceCacheDeltaMixins::Prefetch(*namespaceSets.pFlatMap)
 			, NamespaceCacheDeltaMixins::PatriciaTreeDelta(*namespaceSets.pPrimary, namespaceSets.pPatriciaTree)
 			, NamespaceCacheDeltaMixins::Touch(*namespaceSets.pPrimary, *namespaceSets.pHeightGrouping)
 			, NamespaceCacheDeltaMixins::DeltaElements(*namespaceSets.pPrimary)
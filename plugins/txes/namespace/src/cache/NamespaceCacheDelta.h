@@ -37,6 +37,7 @@ namespace catapult { namespace cache {
 	public:
 		using Size = PrimaryMixins::Size;
 		using Contains = FlatMapMixins::Contains;
+		using Prefetch = FlatMapMixins::Prefetch;
 		using PatriciaTreeDelta = PrimaryMixins::PatriciaTreeDelta;
 		using Touch = HeightBasedTouchMixin<
 			typename NamespaceCacheTypes::PrimaryTypes::BaseSetDeltaType,
@@ -54,6 +55,7 @@ namespace catapult { namespace cache {
 			: public utils::MoveOnly
 			, public NamespaceCacheDeltaMixins::Size
 			, public NamespaceCacheDeltaMixins::Contains
+			, public NamespaceCacheDeltaMixins::Prefetch
 			, public NamespaceCacheDeltaMixins::PatriciaTreeDelta
 			, public NamespaceCacheDeltaMixins::Touch
 			, public NamespaceCacheDeltaMixins::DeltaElements
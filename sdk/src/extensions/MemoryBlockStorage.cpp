@@ -147,6 +147,15 @@ namespace catapult { namespace extensions {
 		return iter->second;
 	}
 
+	std::vector<std::shared_ptr<const model::BlockElement>> MemoryBlockStorage::loadBlockElements(
+			Height height,
+			size_t maxBlocks,
+			size_t maxBytes) const {
+		return io::LoadBlockElements(chainHeight(), height, maxBlocks, maxBytes, [this](auto blockElementHeight) {
+			return loadBlockElement(blockElementHeight);
+		});
+	}
+
 	namespace {
 		class BufferOutputStream : public io::OutputStream {
 		public:
@@ -47,6 +47,10 @@ namespace catapult { namespace extensions {
 		// BlockStorage
 		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+		std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(
+				Height height,
+				size_t maxBlocks,
+				size_t maxBytes) const override;
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
 
 		// PrunableBlockStorage
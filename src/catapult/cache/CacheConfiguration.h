@@ -20,8 +20,16 @@
 
 #pragma once
 #include "catapult/utils/FileSize.h"
+#include <memory>
 #include <string>
 
+namespace catapult {
+	namespace cache {
+		class PatriciaTreeNodeCache;
+		struct RocksTuningSettings;
+	}
+}
+
 namespace catapult { namespace cache {
 
 	/// Possible patricia tree storage modes.
@@ -66,5 +74,11 @@ namespace catapult { namespace cache {
 
 		/// \c true if patricia trees should be stored, \c false otherwise.
 		bool ShouldStorePatriciaTrees;
+
+		/// Optional (shared) cache of recently used patricia tree nodes.
+		std::shared_ptr<PatriciaTreeNodeCache> pPatriciaTreeNodeCache;
+
+		/// Optional (shared) cache database tuning settings.
+		std::shared_ptr<const RocksTuningSettings> pDatabaseTuning;
 	};
 }}
@@ -21,6 +21,7 @@
 #pragma once
 #include "CacheConfiguration.h"
 #include "catapult/cache_db/CacheDatabase.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
 #include "catapult/cache_db/UpdateSet.h"
 #include "catapult/deltaset/ConditionalContainer.h"
 
@@ -39,10 +40,12 @@ namespace catapult { namespace cache {
 								config.CacheDatabaseDirectory,
 								GetAdjustedColumnFamilyNames(config, columnFamilyNames),
 								config.MaxCacheDatabaseWriteBatchSize,
-								pruningMode))
+								pruningMode,
+								config.pDatabaseTuning ? *config.pDatabaseTuning : RocksTuningSettings()))
 						: std::make_unique<CacheDatabase>())
 				, m_containerMode(GetContainerMode(config))
 				, m_hasPatriciaTreeSupport(config.ShouldStorePatriciaTrees)
+				, m_pPatriciaTreeNodeCache(config.pPatriciaTreeNodeCache)
 		{}
 
 	protected:
@@ -51,6 +54,11 @@ namespace catapult { namespace cache {
 			return m_hasPatriciaTreeSupport;
 		}
 
+		/// Gets the (optional) patricia tree node cache.
+		PatriciaTreeNodeCache* patriciaTreeNodeCache() const {
+			return m_pPatriciaTreeNodeCache.get();
+		}
+
 		/// Gets the database.
 		CacheDatabase& database() {
 			return *m_pDatabase;
@@ -85,5 +93,6 @@ namespace catapult { namespace cache {
 		std::unique_ptr<CacheDatabase> m_pDatabase;
 		const deltaset::ConditionalContainerMode m_containerMode;
 		const bool m_hasPatriciaTreeSupport;
+		std::shared_ptr<PatriciaTreeNodeCache> m_pPatriciaTreeNodeCache;
 	};
 }}
@@ -43,6 +43,7 @@ namespace catapult { namespace cache {
 
 		using ActivePredicate = ActivePredicateMixin<TSet, TCacheDescriptor>;
 		using BasicInsertRemove = BasicInsertRemoveMixin<TSet, TCacheDescriptor>;
+		using Prefetch = PrefetchMixin<TSet, TCacheDescriptor>;
 
 		using DeltaElements = deltaset::DeltaElementsMixin<TSet>;
 	};
@@ -305,6 +305,27 @@ namespace catapult { namespace cache {
 		TSet& m_set;
 	};
 
+	/// Mixin for adding prefetch support to a cache.
+	template<typename TSet, typename TCacheDescriptor>
+	class PrefetchMixin {
+	private:
+		using KeyType = typename TCacheDescriptor::KeyType;
+
+	public:
+		/// Creates a mixin around \a set.
+		explicit PrefetchMixin(const TSet& set) : m_set(set)
+		{}
+
+	public:
+		/// Prefetches the values identified by \a keys so that subsequent accesses do not hit storage individually.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			m_set.prefetch(keys);
+		}
+
+	private:
+		const TSet& m_set;
+	};
+
 	/// Mixin for height-based touching.
 	template<typename TSet, typename THeightGroupedSet>
 	class HeightBasedTouchMixin {
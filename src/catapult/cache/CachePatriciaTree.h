@@ -29,9 +29,9 @@ namespace catapult { namespace cache {
 	template<typename TTree>
 	class CachePatriciaTree {
 	public:
-		/// Creates a tree around \a database and \a columnId if \a enable is \c true.
-		CachePatriciaTree(bool enable, CacheDatabase& database, size_t columnId)
-				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId) : nullptr)
+		/// Creates a tree around \a database and \a columnId with optional \a pNodeCache if \a enable is \c true.
+		CachePatriciaTree(bool enable, CacheDatabase& database, size_t columnId, PatriciaTreeNodeCache* pNodeCache = nullptr)
+				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId, pNodeCache) : nullptr)
 		{}
 
 	public:
@@ -61,18 +61,26 @@ namespace catapult { namespace cache {
 	private:
 		class Impl {
 		public:
-			Impl(CacheDatabase& database, size_t columnId)
+			Impl(CacheDatabase& database, size_t columnId, PatriciaTreeNodeCache* pNodeCache)
 					: m_container(database, columnId)
-					, m_dataSource(m_container)
-					, m_pTree(std::make_unique<TTree>(m_dataSource)) {
+					, m_dataSource(m_container, pNodeCache)
+					, m_pTree(std::make_unique<TTree>(m_dataSource))
+					, m_pNodeCache(pNodeCache) {
 				Hash256 rootHash;
-				if (!m_container.prop("root", rootHash))
-					return;
-
-				if (Hash256() == rootHash)
-					return;
+				if (m_container.prop("root", rootHash) && Hash256() != rootHash)
+					m_pTree = std::make_unique<TTree>(m_dataSource, rootHash);
+
+				// register last because the destructor is not called when the constructor throws
+				if (m_pNodeCache) {
+					m_pNodeCache->registerWarmStartLoader(this, [&dataSource = m_dataSource]() {
+						return dataSource.preload();
+					});
+				}
+			}
 
-				m_pTree = std::make_unique<TTree>(m_dataSource, rootHash);
+			~Impl() {
+				if (m_pNodeCache)
+					m_pNodeCache->unregisterWarmStartLoader(this);
 			}
 
 		public:
@@ -100,6 +108,7 @@ namespace catapult { namespace cache {
 			PatriciaTreeContainer m_container;
 			PatriciaTreeRdbDataSource m_dataSource;
 			std::unique_ptr<TTree> m_pTree;
+			PatriciaTreeNodeCache* m_pNodeCache;
 		};
 
 		std::unique_ptr<Impl> m_pImpl;
@@ -28,6 +28,7 @@
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/state/CatapultState.h"
 #include "catapult/utils/StackLogger.h"
+#include "catapult/utils/StackTimer.h"
 
 namespace catapult { namespace cache {
 
@@ -47,15 +48,39 @@ namespace catapult { namespace cache {
 			return readOnlyViews;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		std::vector<Hash256> CollectSubCacheMerkleRoots(TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
+		template<typename TItems, typename TAction>
+		void RunAll(const TItems& items, const utils::ParallelRunner& runner, TAction action) {
+			if (!runner || items.size() < 2) {
+				for (const auto& item : items)
+					action(item);
+
+				return;
+			}
+
+			// capture exceptions so that they are rethrown on the calling thread instead of a runner thread
+			std::vector<std::exception_ptr> exceptions(items.size());
+			runner(items.size(), [&items, action, &exceptions](auto index) {
+				try {
+					action(items[index]);
+				} catch (...) {
+					exceptions[index] = std::current_exception();
+				}
+			});
+
+			for (const auto& pException : exceptions) {
+				if (pException)
+					std::rethrow_exception(pException);
+			}
+		}
+
+		template<typename TSubCacheViews>
+		std::vector<Hash256> CollectSubCacheMerkleRoots(const TSubCacheViews& subViews) {
 			std::vector<Hash256> merkleRoots;
 			for (const auto& pSubView : subViews) {
 				Hash256 merkleRoot;
 				if (!pSubView)
 					continue;
 
-				updateMerkleRoot(*pSubView);
 				if (pSubView->tryGetMerkleRoot(merkleRoot))
 					merkleRoots.push_back(merkleRoot);
 			}
@@ -78,12 +103,10 @@ namespace catapult { namespace cache {
 			return stateHash;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
-			utils::SlowOperationLogger logger("CalculateStateHashInfo", utils::LogLevel::Warning);
-
+		template<typename TSubCacheViews>
+		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews) {
 			StateHashInfo stateHashInfo;
-			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews, updateMerkleRoot);
+			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews);
 			stateHashInfo.StateHash = CalculateStateHash(stateHashInfo.SubCacheMerkleRoots);
 			return stateHashInfo;
 		}
@@ -115,7 +138,8 @@ namespace catapult { namespace cache {
 	}
 
 	StateHashInfo CatapultCacheView::calculateStateHash() const {
-		return CalculateStateHashInfo(m_subViews, [](const auto&) {});
+		utils::SlowOperationLogger logger("CalculateStateHashInfo", utils::LogLevel::Warning);
+		return CalculateStateHashInfo(m_subViews);
 	}
 
 	ReadOnlyCatapultCache CatapultCacheView::toReadOnly() const {
@@ -126,9 +150,13 @@ namespace catapult { namespace cache {
 
 	// region CatapultCacheDelta
 
-	CatapultCacheDelta::CatapultCacheDelta(state::CatapultState& dependentState, std::vector<std::unique_ptr<SubCacheView>>&& subViews)
+	CatapultCacheDelta::CatapultCacheDelta(
+			state::CatapultState& dependentState,
+			std::vector<std::unique_ptr<SubCacheView>>&& subViews,
+			const StateHashRunners& stateHashRunners)
 			: m_pDependentState(&dependentState)
 			, m_subViews(std::move(subViews))
+			, m_stateHashRunners(stateHashRunners)
 	{}
 
 	CatapultCacheDelta::~CatapultCacheDelta() = default;
@@ -146,7 +174,21 @@ namespace catapult { namespace cache {
 	}
 
 	StateHashInfo CatapultCacheDelta::calculateStateHash(Height height) const {
-		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); });
+		utils::SlowOperationLogger logger("CalculateStateHashInfo", utils::LogLevel::Warning);
+
+		// sub caches are independent, so their merkle roots can be updated concurrently
+		std::vector<SubCacheView*> subViews;
+		for (const auto& pSubView : m_subViews) {
+			if (pSubView)
+				subViews.push_back(pSubView.get());
+		}
+
+		const auto& subtreeRunner = m_stateHashRunners.SubtreeRunner;
+		RunAll(subViews, m_stateHashRunners.SubCacheRunner, [height, &subtreeRunner](auto* pSubView) {
+			pSubView->updateMerkleRoot(height, subtreeRunner);
+		});
+
+		return CalculateStateHashInfo(m_subViews);
 	}
 
 	void CatapultCacheDelta::setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots) {
@@ -181,10 +223,11 @@ namespace catapult { namespace cache {
 	CatapultCacheDetachableDelta::CatapultCacheDetachableDelta(
 			CacheHeightView&& cacheHeightView,
 			const state::CatapultState& dependentState,
-			std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews)
+			std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews,
+			const StateHashRunners& stateHashRunners)
 			// note that CacheHeightView is a unique_ptr to allow CatapultCacheDetachableDelta to be declared without it defined
 			: m_pCacheHeightView(std::make_unique<CacheHeightView>(std::move(cacheHeightView)))
-			, m_detachedDelta(dependentState, std::move(detachedSubViews))
+			, m_detachedDelta(dependentState, std::move(detachedSubViews), stateHashRunners)
 	{}
 
 	CatapultCacheDetachableDelta::~CatapultCacheDetachableDelta() = default;
@@ -205,9 +248,11 @@ namespace catapult { namespace cache {
 
 	CatapultCacheDetachedDelta::CatapultCacheDetachedDelta(
 			const state::CatapultState& dependentState,
-			std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews)
+			std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews,
+			const StateHashRunners& stateHashRunners)
 			: m_pDependentState(std::make_unique<state::CatapultState>(dependentState))
 			, m_detachedSubViews(std::move(detachedSubViews))
+			, m_stateHashRunners(stateHashRunners)
 	{}
 
 	CatapultCacheDetachedDelta::~CatapultCacheDetachedDelta() = default;
@@ -231,7 +276,7 @@ namespace catapult { namespace cache {
 			subViews.push_back(std::move(pSubView));
 		}
 
-		return std::make_unique<CatapultCacheDelta>(*m_pDependentState, std::move(subViews));
+		return std::make_unique<CatapultCacheDelta>(*m_pDependentState, std::move(subViews), m_stateHashRunners);
 	}
 
 	// endregion
@@ -259,6 +304,8 @@ namespace catapult { namespace cache {
 			, m_pDependentState(std::make_unique<state::CatapultState>())
 			, m_pDependentStateDelta(std::make_unique<state::CatapultState>())
 			, m_subCaches(std::move(subCaches))
+			, m_pCommitDurations(std::make_unique<utils::DurationHistogram>())
+			, m_pCommitLockDurations(std::make_unique<utils::DurationHistogram>())
 	{}
 
 	CatapultCache::~CatapultCache() = default;
@@ -281,7 +328,7 @@ namespace catapult { namespace cache {
 
 		// make a copy of the dependent state after all caches are locked with outstanding deltas
 		m_pDependentStateDelta = std::make_unique<state::CatapultState>(*m_pDependentState);
-		return CatapultCacheDelta(*m_pDependentStateDelta, std::move(subViews));
+		return CatapultCacheDelta(*m_pDependentStateDelta, std::move(subViews), m_stateHashRunners);
 	}
 
 	CatapultCacheDetachableDelta CatapultCache::createDetachableDelta() const {
@@ -290,21 +337,52 @@ namespace catapult { namespace cache {
 		auto detachedSubViews = MapSubCaches<DetachedSubCacheView>(m_subCaches, [](const auto& pSubCache) {
 			return pSubCache->createDetachedDelta();
 		});
-		return CatapultCacheDetachableDelta(std::move(pCacheHeightView), *m_pDependentState, std::move(detachedSubViews));
+		return CatapultCacheDetachableDelta(
+				std::move(pCacheHeightView),
+				*m_pDependentState,
+				std::move(detachedSubViews),
+				m_stateHashRunners);
 	}
 
 	void CatapultCache::commit(Height height) {
-		// use the height writer lock to lock the entire cache during commit
-		auto cacheHeightModifier = m_pCacheHeight->modifier();
+		utils::StackTimer commitTimer;
+		{
+			// use the height writer lock to lock the entire cache during commit
+			auto cacheHeightModifier = m_pCacheHeight->modifier();
+			utils::StackTimer lockTimer;
+
+			std::vector<SubCachePlugin*> subCaches;
+			for (const auto& pSubCache : m_subCaches) {
+				if (pSubCache)
+					subCaches.push_back(pSubCache.get());
+			}
 
-		for (const auto& pSubCache : m_subCaches) {
-			if (pSubCache)
-				pSubCache->commit();
+			// sub caches are independent, so they can be committed concurrently
+			RunAll(subCaches, m_commitRunner, [](auto* pSubCache) { pSubCache->commit(); });
+
+			// finally, update the dependent state and cache height
+			m_pDependentState = std::make_unique<state::CatapultState>(*m_pDependentStateDelta);
+			cacheHeightModifier.set(height);
+			m_pCommitLockDurations->add(lockTimer.millis());
 		}
 
-		// finally, update the dependent state and cache height
-		m_pDependentState = std::make_unique<state::CatapultState>(*m_pDependentStateDelta);
-		cacheHeightModifier.set(height);
+		m_pCommitDurations->add(commitTimer.millis());
+	}
+
+	void CatapultCache::setCommitRunner(const CommitRunner& commitRunner) {
+		m_commitRunner = commitRunner;
+	}
+
+	void CatapultCache::setStateHashRunners(const StateHashRunners& stateHashRunners) {
+		m_stateHashRunners = stateHashRunners;
+	}
+
+	const utils::DurationHistogram& CatapultCache::commitDurations() const {
+		return *m_pCommitDurations;
+	}
+
+	const utils::DurationHistogram& CatapultCache::commitLockDurations() const {
+		return *m_pCommitLockDurations;
 	}
 
 	std::vector<std::unique_ptr<const CacheStorage>> CatapultCache::storages() const {
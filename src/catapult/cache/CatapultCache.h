@@ -23,6 +23,9 @@
 #include "CatapultCacheDetachableDelta.h"
 #include "CatapultCacheView.h"
 #include "SubCachePlugin.h"
+#include "catapult/utils/DurationHistogram.h"
+#include "catapult/utils/ParallelRunners.h"
+#include "catapult/functions.h"
 
 namespace catapult {
 	namespace cache {
@@ -38,6 +41,11 @@ namespace catapult { namespace cache {
 
 	/// Central cache holding all sub caches.
 	class CatapultCache {
+	public:
+		/// Calls a work callback for each index less than \a count (possibly in parallel) and returns after all indexes
+		/// have been processed.
+		using CommitRunner = utils::ParallelRunner;
+
 	public:
 		/// Creates a catapult cache around \a subCaches.
 		explicit CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches);
@@ -70,8 +78,22 @@ namespace catapult { namespace cache {
 		CatapultCacheDetachableDelta createDetachableDelta() const;
 
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
+		/// \note Sub caches are committed using the commit runner, if set.
 		void commit(Height height);
 
+		/// Sets the runner used to commit independent sub caches to \a commitRunner.
+		/// \note This must not be called while a commit is in progress.
+		void setCommitRunner(const CommitRunner& commitRunner);
+
+		/// Sets the runners used by all subsequently created deltas to calculate state hashes to \a stateHashRunners.
+		void setStateHashRunners(const StateHashRunners& stateHashRunners);
+
+		/// Gets the histogram of commit durations (including the time spent acquiring the cache lock).
+		const utils::DurationHistogram& commitDurations() const;
+
+		/// Gets the histogram of durations the cache lock was held during commit.
+		const utils::DurationHistogram& commitLockDurations() const;
+
 	public:
 		/// Gets the (const) cache storages for all sub caches.
 		std::vector<std::unique_ptr<const CacheStorage>> storages() const;
@@ -87,5 +109,10 @@ namespace catapult { namespace cache {
 		std::unique_ptr<state::CatapultState> m_pDependentState; // use a unique_ptr to allow fwd declare
 		std::unique_ptr<state::CatapultState> m_pDependentStateDelta; // backing for (single) outstanding delta
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+
+		CommitRunner m_commitRunner;
+		StateHashRunners m_stateHashRunners;
+		std::unique_ptr<utils::DurationHistogram> m_pCommitDurations; // use a unique_ptr to allow moves
+		std::unique_ptr<utils::DurationHistogram> m_pCommitLockDurations; // use a unique_ptr to allow moves
 	};
 }}
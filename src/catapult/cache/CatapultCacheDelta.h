@@ -30,11 +30,24 @@ namespace catapult {
 
 namespace catapult { namespace cache {
 
+	/// Runners used to parallelize state hash calculation.
+	struct StateHashRunners {
+		/// Runner used to update the merkle roots of independent sub caches.
+		utils::ParallelRunner SubCacheRunner;
+
+		/// Runner used to hash disjoint subtrees of a single sub cache patricia tree.
+		utils::ParallelRunner SubtreeRunner;
+	};
+
 	/// Delta on top of a catapult cache.
 	class CatapultCacheDelta {
 	public:
-		/// Creates a locked catapult cache delta from \a dependentState and \a subViews.
-		CatapultCacheDelta(state::CatapultState& dependentState, std::vector<std::unique_ptr<SubCacheView>>&& subViews);
+		/// Creates a locked catapult cache delta from \a dependentState and \a subViews
+		/// that uses \a stateHashRunners to calculate state hashes.
+		CatapultCacheDelta(
+				state::CatapultState& dependentState,
+				std::vector<std::unique_ptr<SubCacheView>>&& subViews,
+				const StateHashRunners& stateHashRunners);
 
 		/// Destroys the delta.
 		~CatapultCacheDelta();
@@ -65,6 +78,7 @@ namespace catapult { namespace cache {
 		state::CatapultState& dependentState();
 
 		/// Calculates the cache state hash given \a height.
+		/// \note Sub cache merkle roots are updated using the state hash runners, if set.
 		StateHashInfo calculateStateHash(Height height) const;
 
 		/// Sets the merkle roots for all sub caches (\a subCacheMerkleRoots).
@@ -77,5 +91,6 @@ namespace catapult { namespace cache {
 	private:
 		state::CatapultState* m_pDependentState; // use a pointer to allow move assignment
 		std::vector<std::unique_ptr<SubCacheView>> m_subViews;
+		StateHashRunners m_stateHashRunners;
 	};
 }}
@@ -31,11 +31,13 @@ namespace catapult { namespace cache {
 	///       when the delta is destroyed.
 	class CatapultCacheDetachableDelta {
 	public:
-		/// Creates a detachable cache delta from a cache height view (\a cacheHeightView), \a dependentState and \a detachedSubViews.
+		/// Creates a detachable cache delta from a cache height view (\a cacheHeightView), \a dependentState and \a detachedSubViews
+		/// that uses \a stateHashRunners to calculate state hashes.
 		CatapultCacheDetachableDelta(
 				CacheHeightView&& cacheHeightView,
 				const state::CatapultState& dependentState,
-				std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews);
+				std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews,
+				const StateHashRunners& stateHashRunners);
 
 		/// Destroys the detachable cache delta.
 		~CatapultCacheDetachableDelta();
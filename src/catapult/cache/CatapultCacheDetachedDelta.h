@@ -29,10 +29,12 @@ namespace catapult { namespace cache {
 	/// Detached delta of the catapult cache.
 	class CatapultCacheDetachedDelta {
 	public:
-		/// Creates a detached cache delta from \a dependentState and \a detachedSubViews.
+		/// Creates a detached cache delta from \a dependentState and \a detachedSubViews
+		/// that uses \a stateHashRunners to calculate state hashes after locking.
 		CatapultCacheDetachedDelta(
 				const state::CatapultState& dependentState,
-				std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews);
+				std::vector<std::unique_ptr<DetachedSubCacheView>>&& detachedSubViews,
+				const StateHashRunners& stateHashRunners);
 
 		/// Destroys the delta.
 		~CatapultCacheDetachedDelta();
@@ -50,5 +52,6 @@ namespace catapult { namespace cache {
 	private:
 		std::unique_ptr<state::CatapultState> m_pDependentState;
 		std::vector<std::unique_ptr<DetachedSubCacheView>> m_detachedSubViews;
+		StateHashRunners m_stateHashRunners;
 	};
 }}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "PatriciaTreeUtils.h"
+#include "SubCachePlugin.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/exceptions.h"
 
@@ -60,6 +61,10 @@ namespace catapult { namespace cache {
 	/// Mixin for adding patricia tree support to a delta cache.
 	template<typename TSet, typename TTree>
 	class PatriciaTreeDeltaMixin {
+	public:
+		/// Minimum number of pending changes required to hash subtrees in parallel.
+		static constexpr size_t Min_Parallel_Hash_Changes = 1024;
+
 	public:
 		/// Creates a mixin around delta \a set and \a pTree.
 		PatriciaTreeDeltaMixin(TSet& set, const std::shared_ptr<TTree>& pTree)
@@ -83,10 +88,19 @@ namespace catapult { namespace cache {
 
 		/// Recalculates the merkle root given the specified chain \a height if supported.
 		void updateMerkleRoot(Height height) {
+			updateMerkleRoot(height, utils::ParallelRunner());
+		}
+
+		/// Recalculates the merkle root given the specified chain \a height if supported.
+		/// \note When many changes are pending, \a subtreeRunner (if set) is used to hash disjoint subtrees in parallel.
+		void updateMerkleRoot(Height height, const utils::ParallelRunner& subtreeRunner) {
 			if (!m_pTree)
 				return;
 
-			ApplyDeltasToTree(*m_pTree, m_set, m_nextGenerationId, height);
+			auto numChanges = ApplyDeltasToTree(*m_pTree, m_set, m_nextGenerationId, height);
+			if (subtreeRunner && numChanges >= Min_Parallel_Hash_Changes)
+				m_pTree->hashAll(subtreeRunner);
+
 			setApplyCheckpoint();
 		}
 
@@ -22,6 +22,7 @@
 #include "catapult/deltaset/DeltaElements.h"
 #include "catapult/tree/PatriciaTree.h"
 #include "catapult/exceptions.h"
+#include <vector>
 
 namespace catapult { namespace cache {
 
@@ -68,21 +69,27 @@ namespace catapult { namespace cache {
 
 	/// Applies all changes in \a set to \a tree for all generations starting at \a minGenerationId through the current generation
 	/// given the current chain \a height.
+	/// \note Returns the number of changes that were applied.
 	template<typename TTree, typename TSet>
-	void ApplyDeltasToTree(TTree& tree, const TSet& set, uint32_t minGenerationId, Height height) {
+	size_t ApplyDeltasToTree(TTree& tree, const TSet& set, uint32_t minGenerationId, Height height) {
 		auto needsApplication = [&set, minGenerationId, maxGenerationId = set.generationId()](const auto& key) {
 			auto generationId = set.generationId(key);
 			return minGenerationId <= generationId && generationId <= maxGenerationId;
 		};
 
-		auto handleModification = [&tree, height](const auto& pair) {
+		auto deltas = set.deltas();
+		using ElementType = typename std::decay_t<decltype(deltas.Added)>::value_type;
+
+		// collect all values that need to be set so that they can be applied in a single (batched) pass
+		std::vector<const ElementType*> setElements;
+		std::vector<const ElementType*> unsetElements;
+		auto handleModification = [height, &setElements, &unsetElements](const auto& pair) {
 			if (detail::IsActiveAdapter::IsActive(pair.second, height))
-				tree.set(pair.first, pair.second);
+				setElements.push_back(&pair);
 			else
-				tree.unset(pair.first);
+				unsetElements.push_back(&pair);
 		};
 
-		auto deltas = set.deltas();
 		for (const auto& pair : deltas.Added) {
 			if (needsApplication(pair.first)) {
 				// a value can be added and deactivated during the processing of a single chain part
@@ -97,7 +104,13 @@ namespace catapult { namespace cache {
 
 		for (const auto& pair : deltas.Removed) {
 			if (needsApplication(pair.first))
-				tree.unset(pair.first);
+				unsetElements.push_back(&pair);
 		}
+
+		tree.setAll(setElements);
+		for (const auto* pElement : unsetElements)
+			tree.unset(pElement->first);
+
+		return setElements.size() + unsetElements.size();
 	}
 }}
@@ -19,6 +19,8 @@
 **/
 
 #pragma once
+#include "catapult/utils/ParallelRunners.h"
+#include "catapult/functions.h"
 #include "catapult/plugins.h"
 #include "catapult/types.h"
 #include <memory>
@@ -89,8 +91,9 @@ namespace catapult { namespace cache {
 		/// Sets the cache merkle root (\a merkleRoot) if supported.
 		virtual bool trySetMerkleRoot(const Hash256& merkleRoot) = 0;
 
-		/// Recalculates the merkle root given the specified chain \a height if supported.
-		virtual void updateMerkleRoot(Height height) = 0;
+		/// Recalculates the merkle root given the specified chain \a height if supported
+		/// using \a subtreeRunner (if set) to hash disjoint subtrees in parallel.
+		virtual void updateMerkleRoot(Height height, const utils::ParallelRunner& subtreeRunner) = 0;
 
 		/// Gets a read-only view of this view.
 		virtual const void* asReadOnly() const = 0;
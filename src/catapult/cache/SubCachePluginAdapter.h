@@ -155,8 +155,8 @@ namespace catapult { namespace cache {
 				return TrySetMerkleRoot(m_view, merkleRoot, merkleRootMutator());
 			}
 
-			void updateMerkleRoot(Height height) override {
-				UpdateMerkleRoot(m_view, height, merkleRootMutator());
+			void updateMerkleRoot(Height height, const utils::ParallelRunner& subtreeRunner) override {
+				UpdateMerkleRoot(m_view, height, subtreeRunner, merkleRootMutator());
 			}
 
 			const void* asReadOnly() const override {
@@ -218,11 +218,11 @@ namespace catapult { namespace cache {
 				return true;
 			}
 
-			static void UpdateMerkleRoot(TView&, Height, UnsupportedMerkleRootFlag)
+			static void UpdateMerkleRoot(TView&, Height, const utils::ParallelRunner&, UnsupportedMerkleRootFlag)
 			{}
 
-			static void UpdateMerkleRoot(TView& view, Height height, SupportedMerkleRootFlag) {
-				view->updateMerkleRoot(height);
+			static void UpdateMerkleRoot(TView& view, Height height, const utils::ParallelRunner& subtreeRunner, SupportedMerkleRootFlag) {
+				view->updateMerkleRoot(height, subtreeRunner);
 			}
 
 		private:
@@ -54,7 +54,7 @@ namespace catapult { namespace cache {
 				: CacheDatabaseMixin(config, { "default", "key_lookup" })
 				, Primary(GetContainerMode(config), database(), 0)
 				, KeyLookupMap(GetContainerMode(config), database(), 1)
-				, PatriciaTree(hasPatriciaTreeSupport(), database(), 2)
+				, PatriciaTree(hasPatriciaTreeSupport(), database(), 2, patriciaTreeNodeCache())
 		{}
 
 	public:
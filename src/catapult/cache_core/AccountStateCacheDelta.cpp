@@ -51,6 +51,7 @@ namespace catapult { namespace cache {
 			, AccountStateCacheDeltaMixins::ConstAccessorKey(*pKeyLookupAdapter)
 			, AccountStateCacheDeltaMixins::MutableAccessorAddress(*accountStateSets.pPrimary)
 			, AccountStateCacheDeltaMixins::MutableAccessorKey(*pKeyLookupAdapter)
+			, AccountStateCacheDeltaMixins::PrefetchAddress(*accountStateSets.pPrimary)
 			, AccountStateCacheDeltaMixins::PatriciaTreeDelta(*accountStateSets.pPrimary, accountStateSets.pPatriciaTree)
 			, AccountStateCacheDeltaMixins::DeltaElements(*accountStateSets.pPrimary)
 			, m_pStateByAddress(accountStateSets.pPrimary)
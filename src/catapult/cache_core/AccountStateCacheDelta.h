@@ -47,6 +47,7 @@ namespace catapult { namespace cache {
 		using ConstAccessorKey = KeyMixins::ConstAccessor;
 		using MutableAccessorAddress = AddressMixins::MutableAccessor;
 		using MutableAccessorKey = KeyMixins::MutableAccessor;
+		using PrefetchAddress = AddressMixins::Prefetch;
 		using PatriciaTreeDelta = AddressMixins::PatriciaTreeDelta;
 		using DeltaElements = AddressMixins::DeltaElements;
 
@@ -63,6 +64,7 @@ namespace catapult { namespace cache {
 			, public AccountStateCacheDeltaMixins::ConstAccessorKey
 			, public AccountStateCacheDeltaMixins::MutableAccessorAddress
 			, public AccountStateCacheDeltaMixins::MutableAccessorKey
+			, public AccountStateCacheDeltaMixins::PrefetchAddress
 			, public AccountStateCacheDeltaMixins::PatriciaTreeDelta
 			, public AccountStateCacheDeltaMixins::DeltaElements {
 	public:
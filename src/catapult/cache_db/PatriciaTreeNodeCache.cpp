@@ -0,0 +1,129 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeNodeCache.h"
+#include <algorithm>
+#include <atomic>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		tree::TreeNode CreateCompactNode(const tree::TreeNode& node) {
+			if (!node.isBranch())
+				return node.copy();
+
+			// linked nodes are not needed to compute the hash of a branch and would keep entire subtrees alive
+			auto branchNode = node.asBranchNode();
+			branchNode.compactLinks();
+			return tree::TreeNode(branchNode);
+		}
+	}
+
+	PatriciaTreeNodeCache::PatriciaTreeNodeCache(size_t maxNodes)
+			: m_maxNodes(maxNodes)
+			, m_numHits(0)
+			, m_numMisses(0)
+	{}
+
+	size_t PatriciaTreeNodeCache::maxNodes() const {
+		return m_maxNodes;
+	}
+
+	bool PatriciaTreeNodeCache::isFull() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_maxNodes == m_entries.size();
+	}
+
+	std::shared_ptr<const tree::TreeNode> PatriciaTreeNodeCache::find(const Hash256& hash) const {
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = findEntry(hash);
+		if (m_entries.end() == iter) {
+			++m_numMisses;
+			return nullptr;
+		}
+
+		++m_numHits;
+		return *iter;
+	}
+
+	PatriciaTreeNodeCacheStatistics PatriciaTreeNodeCache::statistics() const {
+		utils::SpinLockGuard guard(m_lock);
+		return { m_numHits, m_numMisses, m_entries.size() };
+	}
+
+	void PatriciaTreeNodeCache::insert(const tree::TreeNode& node) {
+		if (0 == m_maxNodes || node.empty())
+			return;
+
+		// compact the node outside of the lock
+		auto pNode = std::make_shared<const tree::TreeNode>(CreateCompactNode(node));
+
+		utils::SpinLockGuard guard(m_lock);
+		if (m_entries.end() != findEntry(pNode->hash()))
+			return;
+
+		if (m_maxNodes == m_entries.size()) {
+			m_entryIndex.erase(m_entries.back()->hash());
+			m_entries.pop_back();
+		}
+
+		m_entries.push_front(std::move(pNode));
+		m_entryIndex.emplace(m_entries.front()->hash(), m_entries.begin());
+	}
+
+	void PatriciaTreeNodeCache::registerWarmStartLoader(const void* pOwner, const WarmStartLoader& loader) {
+		utils::SpinLockGuard guard(m_warmStartLoadersLock);
+		m_warmStartLoaders.emplace_back(pOwner, loader);
+	}
+
+	void PatriciaTreeNodeCache::unregisterWarmStartLoader(const void* pOwner) {
+		utils::SpinLockGuard guard(m_warmStartLoadersLock);
+		auto iter = std::remove_if(m_warmStartLoaders.begin(), m_warmStartLoaders.end(), [pOwner](const auto& pair) {
+			return pOwner == pair.first;
+		});
+		m_warmStartLoaders.erase(iter, m_warmStartLoaders.end());
+	}
+
+	size_t PatriciaTreeNodeCache::warmStart(const utils::ParallelRunner& runner) {
+		decltype(m_warmStartLoaders) loaders;
+		{
+			utils::SpinLockGuard guard(m_warmStartLoadersLock);
+			loaders.swap(m_warmStartLoaders);
+		}
+
+		// each loader streams a different column, so all loaders can run concurrently
+		std::atomic<size_t> numLoadedNodes(0);
+		runner(loaders.size(), [&loaders, &numLoadedNodes](auto index) {
+			numLoadedNodes += loaders[index].second();
+		});
+
+		return numLoadedNodes;
+	}
+
+	PatriciaTreeNodeCache::Entries::iterator PatriciaTreeNodeCache::findEntry(const Hash256& hash) const {
+		auto indexIter = m_entryIndex.find(hash);
+		if (m_entryIndex.cend() == indexIter)
+			return m_entries.end();
+
+		// move the entry to the front of the list, which contains the most recently used entries
+		m_entries.splice(m_entries.begin(), m_entries, indexIter->second);
+		return indexIter->second;
+	}
+}}
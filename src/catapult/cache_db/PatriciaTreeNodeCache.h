@@ -0,0 +1,106 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/tree/TreeNode.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/ParallelRunners.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/functions.h"
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Statistics about the nodes cached by a patricia tree node cache.
+	struct PatriciaTreeNodeCacheStatistics {
+		/// Number of lookups served by cached nodes.
+		uint64_t NumHits;
+
+		/// Number of lookups not served by cached nodes.
+		uint64_t NumMisses;
+
+		/// Number of cached nodes.
+		size_t Size;
+	};
+
+	/// Thread safe bounded cache of (compact) patricia tree nodes keyed by node hash.
+	/// \note Nodes are content addressed, so a single cache can be shared by multiple trees and never contains stale nodes.
+	class PatriciaTreeNodeCache {
+	public:
+		/// Loader that streams nodes into the cache and returns the number of loaded nodes.
+		using WarmStartLoader = supplier<size_t>;
+
+	public:
+		/// Creates a cache that holds at most \a maxNodes nodes.
+		explicit PatriciaTreeNodeCache(size_t maxNodes);
+
+	public:
+		/// Gets the maximum number of cached nodes.
+		size_t maxNodes() const;
+
+		/// Returns \c true if the cache holds the maximum number of nodes.
+		bool isFull() const;
+
+		/// Gets the cached node with \a hash or \c nullptr if no such node is cached.
+		std::shared_ptr<const tree::TreeNode> find(const Hash256& hash) const;
+
+		/// Gets statistics about this cache.
+		PatriciaTreeNodeCacheStatistics statistics() const;
+
+	public:
+		/// Adds \a node to the cache, evicting the least recently used node if the cache is full.
+		/// \note Branch links to in memory nodes are compacted before caching \a node.
+		void insert(const tree::TreeNode& node);
+
+	public:
+		/// Registers a warm start \a loader owned by \a pOwner.
+		void registerWarmStartLoader(const void* pOwner, const WarmStartLoader& loader);
+
+		/// Unregisters the warm start loader owned by \a pOwner.
+		void unregisterWarmStartLoader(const void* pOwner);
+
+		/// Runs all registered warm start loaders using \a runner and unregisters them.
+		/// Returns the total number of loaded nodes.
+		/// \note Loaders must not be unregistered while they are running.
+		size_t warmStart(const utils::ParallelRunner& runner);
+
+	private:
+		using Entries = std::list<std::shared_ptr<const tree::TreeNode>>;
+
+	private:
+		Entries::iterator findEntry(const Hash256& hash) const;
+
+	private:
+		size_t m_maxNodes;
+
+		// entries are reordered by (concurrent) readers, so all members are guarded by m_lock
+		mutable Entries m_entries;
+		mutable std::unordered_map<Hash256, Entries::iterator, utils::ArrayHasher<Hash256>> m_entryIndex;
+		mutable uint64_t m_numHits;
+		mutable uint64_t m_numMisses;
+		mutable utils::SpinLock m_lock;
+
+		std::vector<std::pair<const void*, WarmStartLoader>> m_warmStartLoaders;
+		utils::SpinLock m_warmStartLoadersLock;
+	};
+}}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "PatriciaTreeContainer.h"
+#include "PatriciaTreeNodeCache.h"
 #include "catapult/types.h"
 
 namespace catapult { namespace cache {
@@ -27,8 +28,10 @@ namespace catapult { namespace cache {
 	/// Patricia tree rocksdb-based data source.
 	class PatriciaTreeRdbDataSource {
 	public:
-		/// Creates data source around \a container.
-		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container) : m_container(container)
+		/// Creates data source around \a container with optional \a pNodeCache.
+		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container, PatriciaTreeNodeCache* pNodeCache = nullptr)
+				: m_container(container)
+				, m_pNodeCache(pNodeCache)
 		{}
 
 	public:
@@ -39,14 +42,41 @@ namespace catapult { namespace cache {
 
 		/// Gets the tree node associated with \a hash.
 		std::unique_ptr<const tree::TreeNode> get(const Hash256& hash) const {
+			if (m_pNodeCache) {
+				auto pCachedNode = m_pNodeCache->find(hash);
+				if (pCachedNode)
+					return std::make_unique<const tree::TreeNode>(pCachedNode->copy());
+			}
+
 			auto iter = m_container.find(hash);
 			if (m_container.cend() == iter)
 				return nullptr;
 
 			const auto& pair = *iter;
+			if (m_pNodeCache)
+				m_pNodeCache->insert(pair.second);
+
 			return std::make_unique<const tree::TreeNode>(pair.second.copy());
 		}
 
+		/// Streams saved nodes into the node cache until it is full. Returns the number of streamed nodes.
+		size_t preload() const {
+			if (!m_pNodeCache)
+				return 0;
+
+			size_t numNodes = 0;
+			m_container.forEachValue([&nodeCache = *m_pNodeCache, &numNodes](const auto& node) {
+				if (nodeCache.isFull())
+					return false;
+
+				nodeCache.insert(node);
+				++numNodes;
+				return true;
+			});
+
+			return numNodes;
+		}
+
 	public:
 		/// Saves a leaf tree \a node.
 		void set(const tree::LeafTreeNode& node) {
@@ -61,9 +91,14 @@ namespace catapult { namespace cache {
 	private:
 		void set(const tree::TreeNode& node) {
 			m_container.insert(std::make_pair(node.hash(), node.copy()));
+
+			// write through so that recently saved (upper level) nodes are served from memory
+			if (m_pNodeCache)
+				m_pNodeCache->insert(node);
 		}
 
 	private:
 		PatriciaTreeContainer& m_container;
+		PatriciaTreeNodeCache* m_pNodeCache;
 	};
 }}
@@ -29,6 +29,10 @@ namespace catapult { namespace cache {
 			return rocksdb::Slice(reinterpret_cast<const char*>(key.pData), key.Size);
 		}
 
+		auto ToStringView(const RawBuffer& key) {
+			return std::string_view(reinterpret_cast<const char*>(key.pData), key.Size);
+		}
+
 		void VerifyName(const std::string& propertyName) {
 			if (propertyName.size() >= Special_Key_Max_Length)
 				CATAPULT_THROW_INVALID_ARGUMENT_1("property name too long", propertyName);
@@ -54,6 +58,12 @@ namespace catapult { namespace cache {
 		m_database.put(m_columnId, propertyName, strValue);
 	}
 
+	void RdbColumnContainer::clearPrefetched() {
+		// any modification can make prefetched elements stale
+		utils::SpinLockGuard guard(m_prefetchedValuesLock);
+		m_prefetchedValues.clear();
+	}
+
 	void RdbColumnContainer::load(const std::string& propertyName, const consumer<const char*>& sink) const {
 		VerifyName(propertyName);
 		RdbDataIterator iter;
@@ -71,18 +81,64 @@ namespace catapult { namespace cache {
 	}
 
 	void RdbColumnContainer::find(const RawBuffer& key, RdbDataIterator& iterator) const {
+		{
+			utils::SpinLockGuard guard(m_prefetchedValuesLock);
+			auto prefetchedIter = m_prefetchedValues.find(ToStringView(key));
+			if (m_prefetchedValues.cend() != prefetchedIter) {
+				const auto& prefetchedValue = prefetchedIter->second;
+				iterator.setFound(prefetchedValue.IsFound);
+				if (prefetchedValue.IsFound)
+					iterator.storage().PinSelf(prefetchedValue.Value);
+
+				return;
+			}
+		}
+
 		m_database.get(m_columnId, ToSlice(key), iterator);
 	}
 
+	void RdbColumnContainer::prefetch(const std::vector<RawBuffer>& keys) const {
+		std::vector<rocksdb::Slice> slices;
+		slices.reserve(keys.size());
+		for (const auto& key : keys)
+			slices.push_back(ToSlice(key));
+
+		std::vector<RdbDataIterator> results;
+		m_database.multiGet(m_columnId, slices, results);
+
+		decltype(m_prefetchedValues) prefetchedValues;
+		for (auto i = 0u; i < keys.size(); ++i) {
+			auto isFound = RdbDataIterator::End() != results[i];
+			auto value = isFound ? std::string(results[i].storage().data(), results[i].storage().size()) : std::string();
+			prefetchedValues.emplace(std::string(ToStringView(keys[i])), PrefetchedValue{ isFound, std::move(value) });
+		}
+
+		utils::SpinLockGuard guard(m_prefetchedValuesLock);
+		m_prefetchedValues = std::move(prefetchedValues);
+	}
+
 	void RdbColumnContainer::insert(const RawBuffer& key, const std::string& value) {
+		clearPrefetched();
 		m_database.put(m_columnId, ToSlice(key), value);
 	}
 
 	void RdbColumnContainer::remove(const RawBuffer& key) {
+		clearPrefetched();
 		m_database.del(m_columnId, ToSlice(key));
 	}
 
 	size_t RdbColumnContainer::prune(uint64_t pruningBoundary) {
+		clearPrefetched();
 		return m_database.prune(m_columnId, pruningBoundary);
 	}
+
+	void RdbColumnContainer::forEach(const predicate<const RawBuffer&, const RawBuffer&>& sink) const {
+		m_database.forEach(m_columnId, [&sink](const auto& key, const auto& value) {
+			// properties are stored with (short) special keys alongside elements
+			if (key.Size < Special_Key_Max_Length)
+				return true;
+
+			return sink(key, value);
+		});
+	}
 }}
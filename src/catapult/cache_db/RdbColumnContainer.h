@@ -19,9 +19,13 @@
 **/
 
 #pragma once
+#include "catapult/utils/SpinLock.h"
 #include "catapult/exceptions.h"
 #include "catapult/functions.h"
 #include "catapult/types.h"
+#include <map>
+#include <string_view>
+#include <vector>
 
 namespace catapult {
 	namespace cache {
@@ -76,8 +80,13 @@ namespace catapult { namespace cache {
 
 	protected:
 		/// Finds element with \a key, storing result in \a iterator.
+		/// \note Prefetched elements are served from memory.
 		void find(const RawBuffer& key, RdbDataIterator& iterator) const;
 
+		/// Loads elements with \a keys in a single batched read and keeps them in memory for subsequent finds.
+		/// \note Elements prefetched by a previous call are discarded.
+		void prefetch(const std::vector<RawBuffer>& keys) const;
+
 		/// Inserts element with \a key and \a value.
 		void insert(const RawBuffer& key, const std::string& value);
 
@@ -87,14 +96,29 @@ namespace catapult { namespace cache {
 		/// Prunes elements below \a pruningBoundary. Returns number of pruned elements.
 		size_t prune(uint64_t pruningBoundary);
 
+		/// Streams all elements (excluding properties) in key order to \a sink until it returns \c false.
+		void forEach(const predicate<const RawBuffer&, const RawBuffer&>& sink) const;
+
 	private:
 		void load(const std::string& propertyName, const consumer<const char*>& sink) const;
 
 		void save(const std::string& propertyName, const std::string& strValue);
 
+		void clearPrefetched();
+
+	private:
+		// optional value is not used in order to avoid allocating storage for missing elements
+		struct PrefetchedValue {
+			bool IsFound;
+			std::string Value;
+		};
+
 	private:
 		RocksDatabase& m_database;
 		size_t m_columnId;
 		size_t m_size;
+
+		mutable std::map<std::string, PrefetchedValue, std::less<>> m_prefetchedValues;
+		mutable utils::SpinLock m_prefetchedValuesLock;
 	};
 }}
@@ -126,6 +126,16 @@ namespace catapult { namespace cache {
 			return iter;
 		}
 
+		/// Loads elements with \a keys in a single batched read so that subsequent finds are served from memory.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			std::vector<RawBuffer> serializedKeys;
+			serializedKeys.reserve(keys.size());
+			for (const auto& key : keys)
+				serializedKeys.push_back(SerializeKey(key));
+
+			TContainer::prefetch(serializedKeys);
+		}
+
 		/// Prunes elements with keys smaller than \a key. Returns number of pruned elements.
 		size_t prune(const KeyType& key) {
 			return TContainer::prune(TDescriptor::Serializer::KeyToBoundary(key));
@@ -136,6 +146,13 @@ namespace catapult { namespace cache {
 			TContainer::remove(SerializeKey(key));
 		}
 
+		/// Streams all values in key order to \a sink until it returns \c false.
+		void forEachValue(const predicate<const ValueType&>& sink) const {
+			TContainer::forEach([&sink](const auto&, const auto& value) {
+				return sink(TDescriptor::Serializer::DeserializeValue(value));
+			});
+		}
+
 		/// Gets an iterator that represents non-existing element.
 		const_iterator cend() const {
 			return const_iterator();
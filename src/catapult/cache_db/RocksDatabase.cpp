@@ -21,11 +21,17 @@
 #include "RocksDatabase.h"
 #include "RocksInclude.h"
 #include "RocksPruningFilter.h"
+#include "RocksWriteQueue.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/utils/PathUtils.h"
+#include "catapult/utils/ConfigurationValueParsers.h"
 #include "catapult/utils/StackLogger.h"
 #include "catapult/exceptions.h"
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/table.h>
+#include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
+#include <unordered_map>
 
 namespace catapult { namespace cache {
 
@@ -85,14 +91,111 @@ namespace catapult { namespace cache {
 			const std::vector<std::string>& columnFamilyNames,
 			utils::FileSize maxDatabaseWriteBatchSize,
 			FilterPruningMode pruningMode)
+			: RocksDatabaseSettings(databaseDirectory, columnFamilyNames, maxDatabaseWriteBatchSize, pruningMode, RocksTuningSettings())
+	{}
+
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const std::vector<std::string>& columnFamilyNames,
+			utils::FileSize maxDatabaseWriteBatchSize,
+			FilterPruningMode pruningMode,
+			const RocksTuningSettings& tuning)
 			: DatabaseDirectory(databaseDirectory)
 			, ColumnFamilyNames(columnFamilyNames)
 			, MaxDatabaseWriteBatchSize(maxDatabaseWriteBatchSize)
 			, PruningMode(pruningMode)
+			, Tuning(tuning)
 	{}
 
 	// endregion
 
+	namespace {
+		const std::array<std::pair<const char*, rocksdb::CompressionType>, 7> String_To_Compression_Type_Pairs{{
+			{ "none", rocksdb::kNoCompression },
+			{ "snappy", rocksdb::kSnappyCompression },
+			{ "zlib", rocksdb::kZlibCompression },
+			{ "bzip2", rocksdb::kBZip2Compression },
+			{ "lz4", rocksdb::kLZ4Compression },
+			{ "lz4hc", rocksdb::kLZ4HCCompression },
+			{ "zstd", rocksdb::kZSTD }
+		}};
+
+		std::vector<rocksdb::CompressionType> ParseCompressionPerLevel(const std::string& compressionPerLevel) {
+			std::vector<rocksdb::CompressionType> compressionTypes;
+			if (compressionPerLevel.empty())
+				return compressionTypes;
+
+			std::vector<std::string> codecNames;
+			boost::algorithm::split(codecNames, compressionPerLevel, [](auto ch) { return ',' == ch; });
+			for (auto codecName : codecNames) {
+				boost::algorithm::trim(codecName);
+
+				rocksdb::CompressionType compressionType;
+				if (!utils::TryParseEnumValue(String_To_Compression_Type_Pairs, codecName, compressionType))
+					CATAPULT_THROW_INVALID_ARGUMENT_1("unsupported compression codec", codecName);
+
+				compressionTypes.push_back(compressionType);
+			}
+
+			return compressionTypes;
+		}
+
+		rocksdb::ColumnFamilyOptions CreateColumnOptions(
+				const RocksColumnSettings& columnSettings,
+				const RocksSharedResources* pSharedResources,
+				const rocksdb::CompactionFilter* pCompactionFilter) {
+			rocksdb::ColumnFamilyOptions columnOptions;
+			columnOptions.compaction_filter = pCompactionFilter;
+
+			if (0 != columnSettings.WriteBufferSize.bytes())
+				columnOptions.write_buffer_size = columnSettings.WriteBufferSize.bytes();
+
+			auto compressionTypes = ParseCompressionPerLevel(columnSettings.CompressionPerLevel);
+			if (!compressionTypes.empty()) {
+				columnOptions.num_levels = std::max(columnOptions.num_levels, static_cast<int>(compressionTypes.size()));
+				columnOptions.compression_per_level = std::move(compressionTypes);
+			}
+
+			rocksdb::BlockBasedTableOptions tableOptions;
+			if (pSharedResources && pSharedResources->blockCache())
+				tableOptions.block_cache = pSharedResources->blockCache();
+
+			// full (not block based) filters are required by partitioned filters
+			if (0 != columnSettings.BloomFilterBitsPerKey)
+				tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(columnSettings.BloomFilterBitsPerKey, false));
+
+			if (columnSettings.EnablePartitionedIndexFilters) {
+				tableOptions.index_type = rocksdb::BlockBasedTableOptions::kTwoLevelIndexSearch;
+				tableOptions.partition_filters = 0 != columnSettings.BloomFilterBitsPerKey;
+				tableOptions.cache_index_and_filter_blocks = true;
+				tableOptions.pin_top_level_index_and_filter = true;
+			}
+
+			columnOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+			return columnOptions;
+		}
+	}
+
+	// region PendingWrites
+
+	struct RocksDatabase::PendingWrites {
+	public:
+		struct PendingValue {
+			bool IsDeleted;
+			std::string Value;
+		};
+
+	public:
+		explicit PendingWrites(size_t numColumns) : Columns(numColumns)
+		{}
+
+	public:
+		std::unique_ptr<rocksdb::WriteBatch> pWriteBatch;
+		std::vector<std::unordered_map<std::string, PendingValue>> Columns;
+	};
+
+	// endregion
+
 	RocksDatabase::RocksDatabase() = default;
 
 	RocksDatabase::RocksDatabase(const RocksDatabaseSettings& settings)
@@ -115,20 +218,34 @@ namespace catapult { namespace cache {
 		dbOptions.create_if_missing = true;
 		dbOptions.create_missing_column_families = true;
 
-		rocksdb::ColumnFamilyOptions defaultColumnOptions;
-		defaultColumnOptions.compaction_filter = m_pruningFilter.compactionFilter();
+		const auto& tuning = m_settings.Tuning;
+		const auto* pSharedResources = tuning.pSharedResources.get();
+		if (0 != tuning.MaxBackgroundJobs)
+			dbOptions.max_background_jobs = static_cast<int>(tuning.MaxBackgroundJobs);
+
+		if (pSharedResources && pSharedResources->statistics())
+			dbOptions.statistics = pSharedResources->statistics();
 
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
-		for (const auto& columnFamilyName : settings.ColumnFamilyNames)
-			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, defaultColumnOptions));
+		for (const auto& columnFamilyName : settings.ColumnFamilyNames) {
+			const auto& columnSettings = tuning.columnSettings(columnFamilyName);
+			auto columnOptions = CreateColumnOptions(columnSettings, pSharedResources, m_pruningFilter.compactionFilter());
+			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, columnOptions));
+		}
 
 		auto status = rocksdb::DB::Open(dbOptions, m_settings.DatabaseDirectory, columnFamilies, &m_handles, &pDb);
 		m_pDb.reset(pDb);
 		if (!status.ok())
 			CATAPULT_THROW_RUNTIME_ERROR_2("couldn't open database", m_settings.DatabaseDirectory, status.ToString());
+
+		if (isWriteBehindEnabled())
+			m_pCurrentWrites = std::make_unique<PendingWrites>(m_settings.ColumnFamilyNames.size());
 	}
 
 	RocksDatabase::~RocksDatabase() {
+		// queued batches reference this database, so they need to be written before it is closed
+		waitForPendingWrites();
+
 		for (auto* pHandle : m_handles)
 			m_pDb->DestroyColumnFamilyHandle(pHandle);
 	}
@@ -141,6 +258,10 @@ namespace catapult { namespace cache {
 		return FilterPruningMode::Enabled == m_settings.PruningMode;
 	}
 
+	bool RocksDatabase::isWriteBehindEnabled() const {
+		return !!m_settings.Tuning.pWriteQueue;
+	}
+
 	namespace {
 		[[noreturn]]
 		void ThrowError(const std::string& message, const std::string& columnName, const rocksdb::Slice& key) {
@@ -155,6 +276,9 @@ namespace catapult { namespace cache {
 		if (!m_pDb)
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
 
+		if (isWriteBehindEnabled() && tryFindPendingValue(columnId, key, result))
+			return;
+
 		auto status = m_pDb->Get(rocksdb::ReadOptions(), m_handles[columnId], key, &result.storage());
 		result.setFound(status.ok());
 
@@ -166,6 +290,47 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
 	}
 
+	void RocksDatabase::multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		if (!m_pDb)
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		results.clear();
+		results.resize(keys.size());
+		if (keys.empty())
+			return;
+
+		// values of keys with pending (not yet written) writes are not read from the database
+		std::vector<rocksdb::Slice> dbKeys;
+		std::vector<size_t> dbKeyIndexes;
+		for (auto i = 0u; i < keys.size(); ++i) {
+			if (isWriteBehindEnabled() && tryFindPendingValue(columnId, keys[i], results[i]))
+				continue;
+
+			dbKeys.push_back(keys[i]);
+			dbKeyIndexes.push_back(i);
+		}
+
+		if (dbKeys.empty())
+			return;
+
+		// MultiGet requires contiguous output slices, so values are pinned in temporary storage and copied into results
+		std::vector<rocksdb::PinnableSlice> values(dbKeys.size());
+		std::vector<rocksdb::Status> statuses(dbKeys.size());
+		m_pDb->MultiGet(rocksdb::ReadOptions(), m_handles[columnId], dbKeys.size(), dbKeys.data(), values.data(), statuses.data());
+
+		for (auto i = 0u; i < dbKeys.size(); ++i) {
+			const auto& status = statuses[i];
+			const auto& key = dbKeys[i];
+			if (!status.ok() && !status.IsNotFound())
+				CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
+
+			auto& result = results[dbKeyIndexes[i]];
+			result.setFound(status.ok());
+			if (status.ok())
+				result.storage().PinSelf(values[i]);
+		}
+	}
+
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
 		if (!m_pDb)
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
@@ -174,6 +339,9 @@ namespace catapult { namespace cache {
 		if (!status.ok())
 			CATAPULT_THROW_DB_KEY_ERROR("could not add put operation to batch");
 
+		if (m_pCurrentWrites)
+			m_pCurrentWrites->Columns[columnId][key.ToString()] = { false, value };
+
 		saveIfBatchFull();
 	}
 
@@ -187,13 +355,48 @@ namespace catapult { namespace cache {
 		if (!status.ok())
 			CATAPULT_THROW_DB_KEY_ERROR("could not add delete operation to batch");
 
+		if (m_pCurrentWrites)
+			m_pCurrentWrites->Columns[columnId][key.ToString()] = { true, std::string() };
+
 		saveIfBatchFull();
 	}
 
+	namespace {
+		RawBuffer ToRawBuffer(const rocksdb::Slice& slice) {
+			return { reinterpret_cast<const uint8_t*>(slice.data()), slice.size() };
+		}
+	}
+
+	void RocksDatabase::forEach(size_t columnId, const predicate<const RawBuffer&, const RawBuffer&>& sink) const {
+		if (!m_pDb)
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		waitForPendingWrites();
+
+		// bulk scans should not evict hot blocks from the block cache
+		rocksdb::ReadOptions readOptions;
+		readOptions.fill_cache = false;
+
+		std::unique_ptr<rocksdb::Iterator> pIterator(m_pDb->NewIterator(readOptions, m_handles[columnId]));
+		for (pIterator->SeekToFirst(); pIterator->Valid(); pIterator->Next()) {
+			if (!sink(ToRawBuffer(pIterator->key()), ToRawBuffer(pIterator->value())))
+				return;
+		}
+
+		if (!pIterator->status().ok())
+			CATAPULT_THROW_RUNTIME_ERROR_2(
+					"could not iterate column",
+					m_settings.ColumnFamilyNames[columnId],
+					pIterator->status().ToString());
+	}
+
 	size_t RocksDatabase::prune(size_t columnId, uint64_t boundary) {
 		if (!m_pruningFilter.compactionFilter())
 			return 0;
 
+		// compaction only sees written batches
+		waitForPendingWrites();
+
 		m_pruningFilter.setPruningBoundary(boundary);
 		m_pDb->CompactRange({}, m_handles[columnId], nullptr, nullptr);
 		return m_pruningFilter.numRemoved();
@@ -203,16 +406,69 @@ namespace catapult { namespace cache {
 		if (0 == m_pWriteBatch->GetDataSize())
 			return;
 
+		if (!isWriteBehindEnabled()) {
+			write(*m_pWriteBatch);
+			m_pWriteBatch->Clear();
+			return;
+		}
+
+		// hand over the batch to the write queue, but keep its writes readable until it has been written
+		m_pCurrentWrites->pWriteBatch = std::move(m_pWriteBatch);
+		auto pPendingWrites = std::shared_ptr<const PendingWrites>(std::move(m_pCurrentWrites));
+		{
+			utils::SpinLockGuard guard(m_pendingWritesLock);
+			m_pendingWrites.push_back(pPendingWrites);
+		}
+
+		m_pWriteBatch = std::make_unique<rocksdb::WriteBatch>();
+		m_pCurrentWrites = std::make_unique<PendingWrites>(m_settings.ColumnFamilyNames.size());
+
+		// push blocks while the queue is full, which bounds the amount of unwritten data
+		m_settings.Tuning.pWriteQueue->push([this, pPendingWrites]() {
+			write(*pPendingWrites->pWriteBatch);
+
+			utils::SpinLockGuard guard(m_pendingWritesLock);
+			m_pendingWrites.pop_front();
+		});
+	}
+
+	void RocksDatabase::waitForPendingWrites() const {
+		if (isWriteBehindEnabled())
+			m_settings.Tuning.pWriteQueue->drain();
+	}
+
+	bool RocksDatabase::tryFindPendingValue(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result) const {
+		utils::SpinLockGuard guard(m_pendingWritesLock);
+		if (m_pendingWrites.empty())
+			return false;
+
+		// search newest batches first because they overwrite values in older batches
+		auto keyString = key.ToString();
+		for (auto iter = m_pendingWrites.crbegin(); m_pendingWrites.crend() != iter; ++iter) {
+			const auto& pendingValues = (*iter)->Columns[columnId];
+			auto valueIter = pendingValues.find(keyString);
+			if (pendingValues.cend() == valueIter)
+				continue;
+
+			result.setFound(!valueIter->second.IsDeleted);
+			if (!valueIter->second.IsDeleted)
+				result.storage().PinSelf(valueIter->second.Value);
+
+			return true;
+		}
+
+		return false;
+	}
+
+	void RocksDatabase::write(rocksdb::WriteBatch& writeBatch) {
 		rocksdb::WriteOptions writeOptions;
 		writeOptions.sync = true;
 
 		auto directory = m_settings.DatabaseDirectory + "/";
 		utils::SlowOperationLogger logger(utils::ExtractDirectoryName(directory.c_str()).pData, utils::LogLevel::Warning);
-		auto status = m_pDb->Write(writeOptions, m_pWriteBatch.get());
+		auto status = m_pDb->Write(writeOptions, &writeBatch);
 		if (!status.ok())
 			CATAPULT_THROW_RUNTIME_ERROR_1("could not store batch in db", status.ToString());
-
-		m_pWriteBatch->Clear();
 	}
 
 	void RocksDatabase::saveIfBatchFull() {
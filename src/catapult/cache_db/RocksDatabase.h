@@ -20,8 +20,12 @@
 
 #pragma once
 #include "RocksPruningFilter.h"
+#include "RocksTuning.h"
 #include "catapult/utils/FileSize.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/functions.h"
 #include "catapult/types.h"
+#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
@@ -98,6 +102,15 @@ namespace catapult { namespace cache {
 				utils::FileSize maxDatabaseWriteBatchSize,
 				FilterPruningMode pruningMode);
 
+		/// Creates database settings around \a databaseDirectory, column names (\a columnFamilyNames),
+		/// maximum size of saved batch (\a maxDatabaseWriteBatchSize), \a pruningMode and \a tuning settings.
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const std::vector<std::string>& columnFamilyNames,
+				utils::FileSize maxDatabaseWriteBatchSize,
+				FilterPruningMode pruningMode,
+				const RocksTuningSettings& tuning);
+
 	public:
 		/// Database directory.
 		const std::string DatabaseDirectory;
@@ -110,6 +123,9 @@ namespace catapult { namespace cache {
 
 		/// Database pruning mode.
 		const FilterPruningMode PruningMode;
+
+		/// Database tuning settings.
+		const RocksTuningSettings Tuning;
 	};
 
 	/// RocksDb-backed database.
@@ -131,23 +147,43 @@ namespace catapult { namespace cache {
 		/// Returns \c true if pruning is enabled.
 		bool canPrune() const;
 
+		/// Returns \c true if flushed batches are written in the background.
+		bool isWriteBehindEnabled() const;
+
 	public:
 		/// Gets the value associated with \a key from \a columnId and sets \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
+		/// Gets the values associated with \a keys from \a columnId in a single batched read and sets \a results.
+		/// \note \a results is resized to match the number of \a keys.
+		void multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results);
+
 		/// Puts the \a value associated with \a key in \a columnId.
 		void put(size_t columnId, const rocksdb::Slice& key, const std::string& value);
 
 		/// Deletes the value associated with \a key from \a columnId.
 		void del(size_t columnId, const rocksdb::Slice& key);
 
+		/// Streams all keys and values from \a columnId in key order to \a sink until it returns \c false.
+		/// \note Batched operations that have not been flushed are not visible.
+		/// \note When write-behind is enabled, this waits for all flushed batches to be written.
+		void forEach(size_t columnId, const predicate<const RawBuffer&, const RawBuffer&>& sink) const;
+
 		/// Prunes elements from \a columnId below \a boundary. Returns number of pruned elements.
 		size_t prune(size_t columnId, uint64_t boundary);
 
 		/// Finalize batched operations.
+		/// \note When write-behind is enabled, batched operations are visible immediately but are written in the background.
 		void flush();
 
+		/// Blocks until all flushed batches have been written.
+		void waitForPendingWrites() const;
+
 	private:
+		struct PendingWrites;
+
+		bool tryFindPendingValue(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result) const;
+		void write(rocksdb::WriteBatch& writeBatch);
 		void saveIfBatchFull();
 
 	private:
@@ -155,6 +191,11 @@ namespace catapult { namespace cache {
 		RocksPruningFilter m_pruningFilter;
 		std::unique_ptr<rocksdb::WriteBatch> m_pWriteBatch;
 
+		// write-behind state: writes of the current batch and flushed batches that have not yet been written (oldest first)
+		std::unique_ptr<PendingWrites> m_pCurrentWrites;
+		std::deque<std::shared_ptr<const PendingWrites>> m_pendingWrites;
+		mutable utils::SpinLock m_pendingWritesLock;
+
 		std::unique_ptr<rocksdb::DB> m_pDb;
 		std::vector<rocksdb::ColumnFamilyHandle*> m_handles;
 	};
@@ -0,0 +1,70 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "RocksTuning.h"
+#include <rocksdb/cache.h>
+#include <rocksdb/statistics.h>
+
+namespace catapult { namespace cache {
+
+	// region RocksSharedResources
+
+	RocksSharedResources::RocksSharedResources(utils::FileSize blockCacheSize, bool enableStatistics)
+			: m_pBlockCache(0 == blockCacheSize.bytes() ? nullptr : rocksdb::NewLRUCache(blockCacheSize.bytes()))
+			, m_pStatistics(enableStatistics ? rocksdb::CreateDBStatistics() : nullptr)
+	{}
+
+	RocksSharedResources::~RocksSharedResources() = default;
+
+	const std::shared_ptr<rocksdb::Cache>& RocksSharedResources::blockCache() const {
+		return m_pBlockCache;
+	}
+
+	const std::shared_ptr<rocksdb::Statistics>& RocksSharedResources::statistics() const {
+		return m_pStatistics;
+	}
+
+	RocksStatistics RocksSharedResources::collectStatistics() const {
+		RocksStatistics statistics{};
+		if (m_pBlockCache)
+			statistics.BlockCacheUsage = m_pBlockCache->GetUsage();
+
+		if (!m_pStatistics)
+			return statistics;
+
+		statistics.NumBlockCacheHits = m_pStatistics->getTickerCount(rocksdb::BLOCK_CACHE_HIT);
+		statistics.NumBlockCacheMisses = m_pStatistics->getTickerCount(rocksdb::BLOCK_CACHE_MISS);
+		statistics.StallMicros = m_pStatistics->getTickerCount(rocksdb::STALL_MICROS);
+		statistics.NumBytesRead = m_pStatistics->getTickerCount(rocksdb::BYTES_READ)
+				+ m_pStatistics->getTickerCount(rocksdb::ITER_BYTES_READ);
+		statistics.NumCompactionBytesWritten = m_pStatistics->getTickerCount(rocksdb::COMPACT_WRITE_BYTES);
+		return statistics;
+	}
+
+	// endregion
+
+	// region RocksTuningSettings
+
+	const RocksColumnSettings& RocksTuningSettings::columnSettings(const std::string& columnFamilyName) const {
+		auto iter = ColumnSettings.find(columnFamilyName);
+		return ColumnSettings.cend() == iter ? DefaultColumnSettings : iter->second;
+	}
+
+	// endregion
+}}
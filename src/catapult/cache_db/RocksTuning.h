@@ -0,0 +1,120 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#pragma once
+#include "catapult/utils/FileSize.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace rocksdb {
+	class Cache;
+	class Statistics;
+}
+
+namespace catapult { namespace cache { class RocksWriteQueue; } }
+
+namespace catapult { namespace cache {
+
+	/// RocksDb column family tuning settings.
+	struct RocksColumnSettings {
+		/// Size of a single memtable (\c 0 to use rocksdb default).
+		utils::FileSize WriteBufferSize;
+
+		/// Number of bloom filter bits per key (\c 0 to disable bloom filters).
+		uint32_t BloomFilterBitsPerKey = 0;
+
+		/// \c true if index and filter blocks should be partitioned.
+		bool EnablePartitionedIndexFilters = false;
+
+		/// Comma separated compression codecs of levels starting with level zero (empty to use rocksdb default).
+		/// \note Supported codecs are none, snappy, zlib, bzip2, lz4, lz4hc and zstd.
+		std::string CompressionPerLevel;
+	};
+
+	/// Statistics collected by rocksdb databases.
+	struct RocksStatistics {
+		/// Number of block cache hits.
+		uint64_t NumBlockCacheHits;
+
+		/// Number of block cache misses.
+		uint64_t NumBlockCacheMisses;
+
+		/// Number of bytes used by the shared block cache.
+		uint64_t BlockCacheUsage;
+
+		/// Total time writes were stalled by compaction (in microseconds).
+		uint64_t StallMicros;
+
+		/// Number of (uncompressed) bytes read by point lookups and iterators.
+		uint64_t NumBytesRead;
+
+		/// Number of bytes written by compactions.
+		uint64_t NumCompactionBytesWritten;
+	};
+
+	/// Resources shared by (multiple) rocksdb databases.
+	class RocksSharedResources {
+	public:
+		/// Creates resources around a shared block cache with \a blockCacheSize capacity (\c 0 to disable)
+		/// and optionally shared statistics (\a enableStatistics).
+		RocksSharedResources(utils::FileSize blockCacheSize, bool enableStatistics);
+
+		/// Destroys resources.
+		~RocksSharedResources();
+
+	public:
+		/// Gets the shared block cache or \c nullptr if there is none.
+		const std::shared_ptr<rocksdb::Cache>& blockCache() const;
+
+		/// Gets the shared statistics or \c nullptr if statistics are disabled.
+		const std::shared_ptr<rocksdb::Statistics>& statistics() const;
+
+		/// Gets a snapshot of the statistics collected by all databases using these resources.
+		/// \note All values except for block cache usage are zero when statistics are disabled.
+		RocksStatistics collectStatistics() const;
+
+	private:
+		std::shared_ptr<rocksdb::Cache> m_pBlockCache;
+		std::shared_ptr<rocksdb::Statistics> m_pStatistics;
+	};
+
+	/// RocksDb tuning settings.
+	struct RocksTuningSettings {
+		/// Maximum number of concurrent background flush and compaction jobs (\c 0 to use rocksdb default).
+		uint32_t MaxBackgroundJobs = 0;
+
+		/// Settings of columns without custom settings.
+		RocksColumnSettings DefaultColumnSettings;
+
+		/// Custom column settings keyed by column family name.
+		std::unordered_map<std::string, RocksColumnSettings> ColumnSettings;
+
+		/// Optional resources shared with other databases.
+		std::shared_ptr<RocksSharedResources> pSharedResources;
+
+		/// Optional queue used to write flushed batches in the background (write-behind).
+		/// \note When set, flushed batches are readable immediately but are only durable after they have been written by the queue.
+		std::shared_ptr<RocksWriteQueue> pWriteQueue;
+
+	public:
+		/// Gets the settings of the column named \a columnFamilyName.
+		const RocksColumnSettings& columnSettings(const std::string& columnFamilyName) const;
+	};
+}}
@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "RocksWriteQueue.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace cache {
+
+	RocksWriteQueue::RocksWriteQueue(size_t maxPendingOperations)
+			: m_maxPendingOperations(maxPendingOperations)
+			, m_isRunningOperation(false)
+			, m_isStopping(false) {
+		if (0 == m_maxPendingOperations)
+			CATAPULT_THROW_INVALID_ARGUMENT("write queue must allow at least one pending operation");
+
+		m_writerThread = std::thread([this]() { run(); });
+	}
+
+	RocksWriteQueue::~RocksWriteQueue() {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_isStopping = true;
+		}
+
+		m_operationsChanged.notify_all();
+		m_writerThread.join();
+	}
+
+	size_t RocksWriteQueue::maxPendingOperations() const {
+		return m_maxPendingOperations;
+	}
+
+	size_t RocksWriteQueue::numPendingOperations() const {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_operations.size() + (m_isRunningOperation ? 1 : 0);
+	}
+
+	void RocksWriteQueue::push(const action& operation) {
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_operationsChanged.wait(lock, [this]() { return m_operations.size() < m_maxPendingOperations; });
+			m_operations.push_back(operation);
+		}
+
+		m_operationsChanged.notify_all();
+	}
+
+	void RocksWriteQueue::drain() {
+		// operations are executed in order, so a sentinel operation completes after all previously queued operations
+		bool isDrained = false;
+		push([this, &isDrained]() {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			isDrained = true;
+		});
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_operationsChanged.wait(lock, [&isDrained]() { return isDrained; });
+	}
+
+	void RocksWriteQueue::run() {
+		for (;;) {
+			action operation;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_operationsChanged.wait(lock, [this]() { return !m_operations.empty() || m_isStopping; });
+
+				// pending operations are always executed, even when stopping, so that no queued write is lost
+				if (m_operations.empty())
+					return;
+
+				operation = std::move(m_operations.front());
+				m_operations.pop_front();
+				m_isRunningOperation = true;
+			}
+
+			// notify producers blocked on a full queue
+			m_operationsChanged.notify_all();
+			operation();
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_isRunningOperation = false;
+			}
+
+			m_operationsChanged.notify_all();
+		}
+	}
+}}
@@ -0,0 +1,66 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#pragma once
+#include "catapult/functions.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace catapult { namespace cache {
+
+	/// Bounded queue of (database write) operations that are executed in order by a dedicated writer thread.
+	class RocksWriteQueue {
+	public:
+		/// Creates a queue that holds at most \a maxPendingOperations operations.
+		explicit RocksWriteQueue(size_t maxPendingOperations);
+
+		/// Destroys the queue after executing all pending operations.
+		~RocksWriteQueue();
+
+	public:
+		/// Gets the maximum number of pending operations.
+		size_t maxPendingOperations() const;
+
+		/// Gets the number of operations that have been queued but have not completed.
+		size_t numPendingOperations() const;
+
+	public:
+		/// Queues \a operation, blocking while the queue is full.
+		/// \note An operation that throws terminates the process.
+		void push(const action& operation);
+
+		/// Blocks until all operations queued before this call have completed.
+		void drain();
+
+	private:
+		void run();
+
+	private:
+		size_t m_maxPendingOperations;
+		std::deque<action> m_operations;
+		bool m_isRunningOperation;
+		bool m_isStopping;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_operationsChanged;
+		std::thread m_writerThread;
+	};
+}}
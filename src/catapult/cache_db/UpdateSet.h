@@ -45,6 +45,14 @@ namespace catapult { namespace cache {
 		elements.setSize(size);
 	}
 
+	/// Prefetches elements identified by \a keys from \a elements.
+	template<typename TDescriptor, typename TContainer>
+	void PrefetchBaseSet(
+			const RdbTypedColumnContainer<TDescriptor, TContainer>& elements,
+			const std::vector<typename TDescriptor::KeyType>& keys) {
+		elements.prefetch(keys);
+	}
+
 	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
 	template<typename TDescriptor, typename TContainer, typename TPruningBoundary>
 	void PruneBaseSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const TPruningBoundary& pruningBoundary) {
@@ -128,11 +128,10 @@ namespace catapult { namespace cache {
 		UnknownTransactionInfos unknownTransactionInfos;
 		for (const auto& pair : m_transactionDataContainer) {
 			const auto& ptData = pair.second;
-			auto shortHash = utils::ToShortHash(ptData.entityHash());
-			auto iter = knownShortHashPairs.find(shortHash);
+			const auto* pKnownCosignaturesShortHash = knownShortHashPairs.find(utils::ToShortHash(ptData.entityHash()));
 
 			// if both hashes match, the data is completely known, so skip it
-			if (knownShortHashPairs.cend() != iter && iter->second == utils::ToShortHash(ptData.cosignaturesHash()))
+			if (pKnownCosignaturesShortHash && *pKnownCosignaturesShortHash == utils::ToShortHash(ptData.cosignaturesHash()))
 				continue;
 
 			auto entrySize = sizeof(Hash256) + sizeof(model::Cosignature) * ptData.cosignatures().size();
@@ -141,7 +140,7 @@ namespace catapult { namespace cache {
 			transactionInfo.Cosignatures = ptData.cosignatures();
 
 			// only add the transaction if it is unknown
-			if (knownShortHashPairs.cend() == iter) {
+			if (!pKnownCosignaturesShortHash) {
 				transactionInfo.pTransaction = ptData.transaction();
 				entrySize += transactionInfo.pTransaction->Size;
 			}
@@ -26,37 +26,14 @@
 
 namespace catapult { namespace cache {
 
-	struct TransactionData : public model::TransactionInfo, public utils::NonCopyable {
-	public:
-		explicit TransactionData(size_t id)
-				: model::TransactionInfo()
-				, Id(id)
-		{}
-
-		TransactionData(const model::TransactionInfo& transactionInfo, size_t id)
-				: model::TransactionInfo(transactionInfo.copy())
-				, Id(id)
-		{}
-
-	public:
-		bool operator<(const TransactionData& rhs) const {
-			return Id < rhs.Id;
-		}
-
-	public:
-		size_t Id;
-	};
-
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
-			const IdLookup& idLookup,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
-			, m_idLookup(idLookup)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -65,21 +42,21 @@ namespace catapult { namespace cache {
 	}
 
 	bool MemoryUtCacheView::contains(const Hash256& hash) const {
-		return m_idLookup.cend() != m_idLookup.find(hash);
+		return !!m_transactionDataContainer.find(hash);
 	}
 
 	void MemoryUtCacheView::forEach(const TransactionInfoConsumer& consumer) const {
-		for (const auto& data : m_transactionDataContainer) {
-			if (!consumer(data))
-				return;
-		}
+		m_transactionDataContainer.forEach(consumer);
+	}
+
+	void MemoryUtCacheView::forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const {
+		m_transactionDataContainer.forEach(order, consumer);
 	}
 
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
-		auto shortHashesIter = shortHashes.begin();
-		for (const auto& data : m_transactionDataContainer)
-			*shortHashesIter++ = utils::ToShortHash(data.EntityHash);
+		if (!shortHashes.empty())
+			m_transactionDataContainer.copyShortHashesTo(&*shortHashes.begin());
 
 		return shortHashes;
 	}
@@ -89,21 +66,18 @@ namespace catapult { namespace cache {
 			const utils::ShortHashesSet& knownShortHashes) const {
 		uint64_t totalSize = 0;
 		UnknownTransactions transactions;
-		for (const auto& data : m_transactionDataContainer) {
+		m_transactionDataContainer.forEachUnknown(knownShortHashes, [this, minFeeMultiplier, &totalSize, &transactions](const auto& data) {
 			if (data.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *data.pEntity))
-				continue;
+				return true;
 
-			auto shortHash = utils::ToShortHash(data.EntityHash);
-			auto iter = knownShortHashes.find(shortHash);
-			if (knownShortHashes.cend() == iter) {
-				auto pTransaction = data.pEntity;
-				totalSize += pTransaction->Size;
-				if (totalSize > m_maxResponseSize)
-					break;
+			auto pTransaction = data.pEntity;
+			totalSize += pTransaction->Size;
+			if (totalSize > m_maxResponseSize)
+				return false;
 
-				transactions.push_back(pTransaction);
-			}
-		}
+			transactions.push_back(pTransaction);
+			return true;
+		});
 
 		return transactions;
 	}
@@ -114,21 +88,16 @@ namespace catapult { namespace cache {
 
 	namespace {
 		class MemoryUtCacheModifier : public UtCacheModifier {
-		private:
-			using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
-
 		public:
 			MemoryUtCacheModifier(
 					uint64_t maxCacheSize,
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
-					IdLookup& idLookup,
 					AccountCounters& counters,
 					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
-					, m_idLookup(idLookup)
 					, m_counters(counters)
 					, m_writeLock(std::move(writeLock))
 			{}
@@ -142,12 +111,10 @@ namespace catapult { namespace cache {
 				if (m_maxCacheSize <= m_transactionDataContainer.size())
 					return false;
 
-				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
+				if (!m_transactionDataContainer.insert(transactionInfo, m_idSequence + 1))
 					return false;
 
-				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
-
+				++m_idSequence;
 				m_counters.increment(transactionInfo.pEntity->SignerPublicKey);
 
 				LogSizes("unconfirmed transactions", m_transactionDataContainer.size(), m_maxCacheSize);
@@ -155,17 +122,10 @@ namespace catapult { namespace cache {
 			}
 
 			model::TransactionInfo remove(const Hash256& hash) override {
-				auto iter = m_idLookup.find(hash);
-				if (m_idLookup.cend() == iter)
-					return model::TransactionInfo();
-
-				auto dataIter = m_transactionDataContainer.find(TransactionData(iter->second));
-				auto erasedInfo = dataIter->copy();
+				auto erasedInfo = m_transactionDataContainer.remove(hash);
+				if (erasedInfo)
+					m_counters.decrement(erasedInfo.pEntity->SignerPublicKey);
 
-				m_counters.decrement(dataIter->pEntity->SignerPublicKey);
-
-				m_transactionDataContainer.erase(dataIter);
-				m_idLookup.erase(iter);
 				return erasedInfo;
 			}
 
@@ -177,24 +137,14 @@ namespace catapult { namespace cache {
 				if (!m_transactionDataContainer.empty())
 					CATAPULT_LOG(debug) << "removing " << m_transactionDataContainer.size() << " elements from ut cache";
 
-				// unfortunately cannot just move m_transactionDataContainer because it contains a different (derived) type
-				std::vector<model::TransactionInfo> transactionInfosCopy;
-				transactionInfosCopy.reserve(m_transactionDataContainer.size());
-
-				for (const auto& data : m_transactionDataContainer)
-					transactionInfosCopy.emplace_back(data.copy());
-
-				m_transactionDataContainer.clear();
-				m_idLookup.clear();
 				m_counters.reset();
-				return transactionInfosCopy;
+				return m_transactionDataContainer.removeAll();
 			}
 
 		private:
 			uint64_t m_maxCacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
-			IdLookup& m_idLookup;
 			AccountCounters& m_counters;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		};
@@ -206,7 +156,6 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
-		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
 		AccountCounters Counters;
 	};
 
@@ -220,7 +169,7 @@ namespace catapult { namespace cache {
 
 	MemoryUtCacheView MemoryUtCache::view() const {
 		auto readLock = m_lock.acquireReader();
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, std::move(readLock));
+		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, std::move(readLock));
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -229,7 +178,6 @@ namespace catapult { namespace cache {
 				m_options.MaxCacheSize,
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
-				m_pImpl->IdLookup,
 				m_pImpl->Counters,
 				std::move(writeLock)));
 	}
@@ -21,35 +21,25 @@
 #pragma once
 #include "MemoryCacheOptions.h"
 #include "MemoryCacheProxy.h"
+#include "TransactionDataContainer.h"
 #include "UtCache.h"
 #include "catapult/model/RangeTypes.h"
-#include "catapult/utils/Hashers.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
-#include <set>
-#include <unordered_map>
-
-namespace catapult { namespace cache { struct TransactionData; } }
 
 namespace catapult { namespace cache {
 
-	/// Internal container wrapped by MemoryUtCache.
-	/// \note std::set is used to allow incomplete type.
-	using TransactionDataContainer = std::set<TransactionData>;
-
 	/// Read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
 		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
-		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
 		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
 
 	public:
-		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// Creates a view around a maximum response size (\a maxResponseSize) and a transaction data container
+		/// (\a transactionDataContainer) with lock context \a readLock.
 		MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
-				const IdLookup& idLookup,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
@@ -62,6 +52,11 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos visited in max fee multiplier \a order
+		/// until all are consumed or \c false is returned by consumer.
+		/// \note Transaction infos with equal max fee multipliers are always visited from oldest to newest.
+		void forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// Each short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -73,7 +68,6 @@ namespace catapult { namespace cache {
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
-		const IdLookup& m_idLookup;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
@@ -55,6 +55,27 @@ namespace catapult { namespace cache {
 		return transactionInfoPointers;
 	}
 
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t count,
+			MaxFeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter) {
+		std::vector<const model::TransactionInfo*> transactionInfoPointers;
+		transactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), count));
+
+		if (0 != count) {
+			// index is maintained by the cache, so only the visited transaction infos need to be filtered
+			utCacheView.forEach(order, [count, filter, &transactionInfoPointers](const auto& transactionInfo) {
+				if (filter(transactionInfo))
+					transactionInfoPointers.push_back(&transactionInfo);
+
+				return transactionInfoPointers.size() != count;
+			});
+		}
+
+		return transactionInfoPointers;
+	}
+
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
 			const MemoryUtCacheView& utCacheView,
 			uint32_t count,
@@ -34,6 +34,15 @@ namespace catapult { namespace cache {
 			uint32_t count,
 			const predicate<const model::TransactionInfo&>& filter);
 
+	/// Gets the pointers to the first \a count transaction infos in \a utCacheView that pass \a filter
+	/// when visited in max fee multiplier \a order.
+	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t count,
+			MaxFeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter);
+
 	/// Gets the pointers to the first \a count transaction infos in \a utCacheView that pass \a filter after sorting by \a sortComparer.
 	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
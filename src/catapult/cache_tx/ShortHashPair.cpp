@@ -0,0 +1,86 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ShortHashPair.h"
+#include <algorithm>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		std::vector<ShortHashPair> ToShortHashPairs(std::initializer_list<std::pair<utils::ShortHash, utils::ShortHash>> shortHashPairs) {
+			std::vector<ShortHashPair> pairs;
+			pairs.reserve(shortHashPairs.size());
+			for (const auto& pair : shortHashPairs)
+				pairs.push_back({ pair.first, pair.second });
+
+			return pairs;
+		}
+	}
+
+	ShortHashPairMap::ShortHashPairMap(std::initializer_list<std::pair<utils::ShortHash, utils::ShortHash>> shortHashPairs)
+			: ShortHashPairMap(ToShortHashPairs(shortHashPairs))
+	{}
+
+	ShortHashPairMap::ShortHashPairMap(std::vector<ShortHashPair>&& shortHashPairs) {
+		auto hasLowerTransactionShortHash = [](const auto& lhs, const auto& rhs) {
+			return lhs.TransactionShortHash < rhs.TransactionShortHash;
+		};
+		auto hasEqualTransactionShortHash = [](const auto& lhs, const auto& rhs) {
+			return lhs.TransactionShortHash == rhs.TransactionShortHash;
+		};
+
+		// stable sort so that unique keeps the first pair of each transaction short hash
+		std::stable_sort(shortHashPairs.begin(), shortHashPairs.end(), hasLowerTransactionShortHash);
+		shortHashPairs.erase(
+				std::unique(shortHashPairs.begin(), shortHashPairs.end(), hasEqualTransactionShortHash),
+				shortHashPairs.end());
+
+		std::vector<utils::ShortHash> transactionShortHashes;
+		transactionShortHashes.reserve(shortHashPairs.size());
+		m_cosignaturesShortHashes.reserve(shortHashPairs.size());
+		for (const auto& pair : shortHashPairs) {
+			transactionShortHashes.push_back(pair.TransactionShortHash);
+			m_cosignaturesShortHashes.push_back(pair.CosignaturesShortHash);
+		}
+
+		m_transactionShortHashes = utils::ShortHashesSet(std::move(transactionShortHashes));
+	}
+
+	size_t ShortHashPairMap::size() const {
+		return m_cosignaturesShortHashes.size();
+	}
+
+	bool ShortHashPairMap::empty() const {
+		return m_cosignaturesShortHashes.empty();
+	}
+
+	const utils::ShortHash* ShortHashPairMap::find(utils::ShortHash transactionShortHash) const {
+		auto position = m_transactionShortHashes.find(transactionShortHash);
+		return utils::ShortHashesSet::Npos == position ? nullptr : &m_cosignaturesShortHashes[position];
+	}
+
+	bool ShortHashPairMap::operator==(const ShortHashPairMap& rhs) const {
+		return m_transactionShortHashes == rhs.m_transactionShortHashes && m_cosignaturesShortHashes == rhs.m_cosignaturesShortHashes;
+	}
+
+	bool ShortHashPairMap::operator!=(const ShortHashPairMap& rhs) const {
+		return !(*this == rhs);
+	}
+}}
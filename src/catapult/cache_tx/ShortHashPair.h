@@ -21,7 +21,6 @@
 #pragma once
 #include "catapult/model/EntityRange.h"
 #include "catapult/utils/ShortHash.h"
-#include <unordered_map>
 
 namespace catapult { namespace cache {
 
@@ -53,6 +52,40 @@ namespace catapult { namespace cache {
 	/// Entity range composed of short hash pairs.
 	using ShortHashPairRange = model::EntityRange<ShortHashPair>;
 
-	/// Map composed of short hash pairs where the key is the transaction short hash and the value is the cosignatures short hash.
-	using ShortHashPairMap = std::unordered_map<utils::ShortHash, utils::ShortHash, utils::ShortHashHasher>;
+	/// Immutable map composed of short hash pairs where the key is the transaction short hash
+	/// and the value is the cosignatures short hash.
+	/// \note Pairs are stored in contiguous arrays sorted by transaction short hash.
+	///       When a transaction short hash is present multiple times, only its first pair is kept.
+	class ShortHashPairMap {
+	public:
+		/// Creates an empty map.
+		ShortHashPairMap() = default;
+
+		/// Creates a map around (transaction short hash, cosignatures short hash) pairs (\a shortHashPairs).
+		ShortHashPairMap(std::initializer_list<std::pair<utils::ShortHash, utils::ShortHash>> shortHashPairs);
+
+		/// Creates a map around \a shortHashPairs.
+		explicit ShortHashPairMap(std::vector<ShortHashPair>&& shortHashPairs);
+
+	public:
+		/// Gets the number of pairs in the map.
+		size_t size() const;
+
+		/// Returns \c true if the map is empty.
+		bool empty() const;
+
+		/// Gets the cosignatures short hash associated with \a transactionShortHash or \c nullptr if it is not present.
+		const utils::ShortHash* find(utils::ShortHash transactionShortHash) const;
+
+	public:
+		/// Returns \c true if this map is equal to \a rhs.
+		bool operator==(const ShortHashPairMap& rhs) const;
+
+		/// Returns \c true if this map is not equal to \a rhs.
+		bool operator!=(const ShortHashPairMap& rhs) const;
+
+	private:
+		utils::ShortHashesSet m_transactionShortHashes;
+		std::vector<utils::ShortHash> m_cosignaturesShortHashes;
+	};
 }}
@@ -0,0 +1,149 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TransactionDataContainer.h"
+#include "catapult/model/FeeUtils.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		// small containers are not worth compacting
+		constexpr size_t Min_Compaction_Tombstones = 64;
+	}
+
+	TransactionData::TransactionData(const model::TransactionInfo& transactionInfo, size_t id)
+			: model::TransactionInfo(transactionInfo.copy())
+			, Id(id)
+			, MaxFeeMultiplier(model::CalculateTransactionMaxFeeMultiplier(*pEntity))
+	{}
+
+	TransactionDataContainer::TransactionDataContainer() : m_size(0)
+	{}
+
+	size_t TransactionDataContainer::size() const {
+		return m_size;
+	}
+
+	bool TransactionDataContainer::empty() const {
+		return 0 == m_size;
+	}
+
+	size_t TransactionDataContainer::slotCount() const {
+		return m_slots.size();
+	}
+
+	const TransactionData* TransactionDataContainer::find(const Hash256& hash) const {
+		auto position = m_hashIndex.find(hash);
+		return TransactionHashIndex::Npos == position ? nullptr : &m_slots[position];
+	}
+
+	void TransactionDataContainer::copyShortHashesTo(utils::ShortHash* pShortHashes) const {
+		if (m_slots.size() == m_size) {
+			std::copy(m_shortHashes.cbegin(), m_shortHashes.cend(), pShortHashes);
+			return;
+		}
+
+		for (auto i = 0u; i < m_shortHashes.size(); ++i) {
+			if (!m_slots[i].isTombstone())
+				*pShortHashes++ = m_shortHashes[i];
+		}
+	}
+
+	bool TransactionDataContainer::insert(const model::TransactionInfo& transactionInfo, size_t id) {
+		if (!m_hashIndex.insert(transactionInfo.EntityHash, m_slots.size()))
+			return false;
+
+		m_slots.emplace_back(transactionInfo, id);
+		m_shortHashes.push_back(utils::ToShortHash(transactionInfo.EntityHash));
+
+		const auto& data = m_slots.back();
+		m_maxFeeMultiplierIndex.insert(m_maxFeeMultiplierIndex.cend(), { data.MaxFeeMultiplier, data.Id, m_slots.size() - 1 });
+		++m_size;
+		return true;
+	}
+
+	model::TransactionInfo TransactionDataContainer::remove(const Hash256& hash) {
+		auto position = m_hashIndex.find(hash);
+		if (TransactionHashIndex::Npos == position)
+			return model::TransactionInfo();
+
+		auto& data = m_slots[position];
+		m_maxFeeMultiplierIndex.erase(MaxFeeMultiplierKey{ data.MaxFeeMultiplier, data.Id, position });
+		m_hashIndex.erase(hash);
+		--m_size;
+
+		// leave a tombstone that keeps its id so that slots remain ordered by id
+		auto erasedInfo = model::TransactionInfo(std::move(data));
+		data.pEntity.reset();
+		data.OptionalExtractedAddresses.reset();
+
+		if (0 == m_size) {
+			m_slots.clear();
+			m_shortHashes.clear();
+		} else {
+			auto numTombstones = m_slots.size() - m_size;
+			if (numTombstones >= Min_Compaction_Tombstones && numTombstones > m_size)
+				compact();
+		}
+
+		return erasedInfo;
+	}
+
+	std::vector<model::TransactionInfo> TransactionDataContainer::removeAll() {
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.reserve(m_size);
+		for (auto& data : m_slots) {
+			if (!data.isTombstone())
+				transactionInfos.push_back(model::TransactionInfo(std::move(data)));
+		}
+
+		m_slots.clear();
+		m_shortHashes.clear();
+		m_size = 0;
+		m_hashIndex.clear();
+		m_maxFeeMultiplierIndex.clear();
+		return transactionInfos;
+	}
+
+	void TransactionDataContainer::compact() {
+		// move live data to the front, preserving insertion order, and remember where each moved slot ended up
+		std::vector<size_t> newPositions(m_slots.size(), TransactionHashIndex::Npos);
+		size_t nextPosition = 0;
+		for (size_t i = 0; i < m_slots.size(); ++i) {
+			auto& data = m_slots[i];
+			if (data.isTombstone())
+				continue;
+
+			if (i != nextPosition) {
+				m_slots[nextPosition] = std::move(data);
+				m_shortHashes[nextPosition] = m_shortHashes[i];
+				m_hashIndex.update(m_slots[nextPosition].EntityHash, nextPosition);
+			}
+
+			newPositions[i] = nextPosition++;
+		}
+
+		m_slots.erase(m_slots.begin() + static_cast<std::ptrdiff_t>(nextPosition), m_slots.end());
+		m_shortHashes.resize(nextPosition);
+
+		for (const auto& key : m_maxFeeMultiplierIndex)
+			key.Position = newPositions[key.Position];
+	}
+}}
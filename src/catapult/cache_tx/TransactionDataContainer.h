@@ -0,0 +1,183 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TransactionHashIndex.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/utils/ShortHash.h"
+#include <set>
+
+namespace catapult { namespace cache {
+
+	/// Order in which transaction infos are visited by max fee multiplier.
+	enum class MaxFeeMultiplierOrder {
+		/// Transaction infos with smallest max fee multipliers are visited first.
+		Ascending,
+
+		/// Transaction infos with largest max fee multipliers are visited first.
+		Descending
+	};
+
+	/// Transaction info stored in a transaction data container.
+	struct TransactionData : public model::TransactionInfo {
+	public:
+		/// Creates data around \a transactionInfo with insertion \a id.
+		TransactionData(const model::TransactionInfo& transactionInfo, size_t id);
+
+	public:
+		/// Returns \c true if this data has been removed and is only occupying its slot.
+		bool isTombstone() const {
+			return !pEntity;
+		}
+
+	public:
+		/// Insertion id.
+		size_t Id;
+
+		/// Max fee multiplier of the transaction.
+		BlockFeeMultiplier MaxFeeMultiplier;
+	};
+
+	/// Insertion ordered container of transaction data that is stored contiguously.
+	/// \note Removed data is tombstoned in place and compacted away once tombstones outnumber live data.
+	/// \note Short hashes are additionally stored in a separate array parallel to the data so that they can be probed
+	///       without touching the (much larger) data.
+	class TransactionDataContainer {
+	public:
+		/// Creates an empty container.
+		TransactionDataContainer();
+
+	public:
+		/// Gets the number of (live) transaction data.
+		size_t size() const;
+
+		/// Returns \c true if the container is empty.
+		bool empty() const;
+
+		/// Gets the number of slots, including tombstones.
+		size_t slotCount() const;
+
+		/// Gets the transaction data associated with \a hash or \c nullptr if not present.
+		const TransactionData* find(const Hash256& hash) const;
+
+	public:
+		/// Calls \a consumer with all transaction data in insertion order until all are consumed or \c false is returned by consumer.
+		template<typename TConsumer>
+		void forEach(const TConsumer& consumer) const {
+			for (const auto& data : m_slots) {
+				if (!data.isTombstone() && !consumer(data))
+					return;
+			}
+		}
+
+		/// Calls \a consumer with all transaction data in insertion order that do not have a short hash in \a knownShortHashes
+		/// until all are consumed or \c false is returned by consumer.
+		template<typename TConsumer>
+		void forEachUnknown(const utils::ShortHashesSet& knownShortHashes, const TConsumer& consumer) const {
+			for (auto i = 0u; i < m_shortHashes.size(); ++i) {
+				if (knownShortHashes.contains(m_shortHashes[i]) || m_slots[i].isTombstone())
+					continue;
+
+				if (!consumer(m_slots[i]))
+					return;
+			}
+		}
+
+		/// Calls \a consumer with all transaction data visited in max fee multiplier \a order
+		/// until all are consumed or \c false is returned by consumer.
+		/// \note Transaction data with equal max fee multipliers are always visited from oldest to newest.
+		template<typename TConsumer>
+		void forEach(MaxFeeMultiplierOrder order, const TConsumer& consumer) const {
+			if (MaxFeeMultiplierOrder::Descending == order) {
+				for (const auto& key : m_maxFeeMultiplierIndex) {
+					if (!consumer(m_slots[key.Position]))
+						return;
+				}
+
+				return;
+			}
+
+			// index is ordered by descending max fee multiplier, so visit groups of equal multipliers from last to first
+			// in order to keep older transactions before newer ones within each group
+			auto groupEnd = m_maxFeeMultiplierIndex.cend();
+			while (m_maxFeeMultiplierIndex.cbegin() != groupEnd) {
+				auto groupBegin = m_maxFeeMultiplierIndex.lower_bound(std::prev(groupEnd)->MaxFeeMultiplier);
+				for (auto iter = groupBegin; groupEnd != iter; ++iter) {
+					if (!consumer(m_slots[iter->Position]))
+						return;
+				}
+
+				groupEnd = groupBegin;
+			}
+		}
+
+		/// Copies the short hashes of all transaction data in insertion order into \a pShortHashes,
+		/// which must be large enough to hold size() short hashes.
+		void copyShortHashesTo(utils::ShortHash* pShortHashes) const;
+
+	public:
+		/// Appends \a transactionInfo with insertion \a id.
+		/// Returns \c false if a transaction info with the same hash is already present.
+		/// \note \a id must be greater than the ids of all previously inserted transaction infos.
+		bool insert(const model::TransactionInfo& transactionInfo, size_t id);
+
+		/// Removes the transaction info associated with \a hash and returns it.
+		/// Returns an empty transaction info if \a hash is not present.
+		model::TransactionInfo remove(const Hash256& hash);
+
+		/// Removes all transaction infos and returns them in insertion order.
+		std::vector<model::TransactionInfo> removeAll();
+
+	private:
+		void compact();
+
+	private:
+		struct MaxFeeMultiplierKey {
+			BlockFeeMultiplier MaxFeeMultiplier;
+			size_t Id;
+			mutable size_t Position; // not part of ordering, so it can be updated during compaction
+		};
+
+		// orders by descending max fee multiplier and then by ascending id
+		struct MaxFeeMultiplierKeyComparer {
+			using is_transparent = void;
+
+			bool operator()(const MaxFeeMultiplierKey& lhs, const MaxFeeMultiplierKey& rhs) const {
+				// prefer older transactions when max fee multipliers are equal
+				return lhs.MaxFeeMultiplier != rhs.MaxFeeMultiplier ? lhs.MaxFeeMultiplier > rhs.MaxFeeMultiplier : lhs.Id < rhs.Id;
+			}
+
+			bool operator()(const MaxFeeMultiplierKey& lhs, BlockFeeMultiplier rhs) const {
+				return lhs.MaxFeeMultiplier > rhs;
+			}
+
+			bool operator()(BlockFeeMultiplier lhs, const MaxFeeMultiplierKey& rhs) const {
+				return lhs > rhs.MaxFeeMultiplier;
+			}
+		};
+
+	private:
+		std::vector<TransactionData> m_slots;
+		std::vector<utils::ShortHash> m_shortHashes;
+		size_t m_size;
+		TransactionHashIndex m_hashIndex;
+		std::set<MaxFeeMultiplierKey, MaxFeeMultiplierKeyComparer> m_maxFeeMultiplierIndex;
+	};
+}}
@@ -0,0 +1,151 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TransactionHashIndex.h"
+#include "catapult/utils/Hashers.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr size_t Min_Capacity = 16;
+
+		// capacity is always a power of two, so the (uniformly distributed) hash can be masked instead of divided
+		size_t GetHomeBucket(const Hash256& hash, size_t capacity) {
+			return utils::ArrayHasher<Hash256>()(hash) & (capacity - 1);
+		}
+
+		bool IsOverloaded(size_t size, size_t capacity) {
+			// keep load factor at most 3/4 so that probe sequences stay short
+			return 4 * size > 3 * capacity;
+		}
+	}
+
+	TransactionHashIndex::TransactionHashIndex() : m_size(0)
+	{}
+
+	size_t TransactionHashIndex::size() const {
+		return m_size;
+	}
+
+	size_t TransactionHashIndex::capacity() const {
+		return m_buckets.size();
+	}
+
+	size_t TransactionHashIndex::find(const Hash256& hash) const {
+		auto bucketIndex = findBucket(hash);
+		return Npos == bucketIndex ? Npos : m_buckets[bucketIndex].Position;
+	}
+
+	bool TransactionHashIndex::insert(const Hash256& hash, size_t position) {
+		if (Npos != findBucket(hash))
+			return false;
+
+		if (m_buckets.empty() || IsOverloaded(m_size + 1, m_buckets.size()))
+			rehash(std::max(Min_Capacity, 2 * m_buckets.size()));
+
+		auto mask = m_buckets.size() - 1;
+		auto bucketIndex = GetHomeBucket(hash, m_buckets.size());
+		while (Npos != m_buckets[bucketIndex].Position)
+			bucketIndex = (bucketIndex + 1) & mask;
+
+		m_buckets[bucketIndex] = { hash, position };
+		++m_size;
+		return true;
+	}
+
+	bool TransactionHashIndex::update(const Hash256& hash, size_t position) {
+		auto bucketIndex = findBucket(hash);
+		if (Npos == bucketIndex)
+			return false;
+
+		m_buckets[bucketIndex].Position = position;
+		return true;
+	}
+
+	bool TransactionHashIndex::erase(const Hash256& hash) {
+		auto bucketIndex = findBucket(hash);
+		if (Npos == bucketIndex)
+			return false;
+
+		// shift following buckets of the cluster backward when the emptied bucket lies on their probe sequences
+		auto mask = m_buckets.size() - 1;
+		auto emptyIndex = bucketIndex;
+		auto currentIndex = bucketIndex;
+		for (;;) {
+			currentIndex = (currentIndex + 1) & mask;
+			auto& bucket = m_buckets[currentIndex];
+			if (Npos == bucket.Position)
+				break;
+
+			auto homeIndex = GetHomeBucket(bucket.Hash, m_buckets.size());
+			auto distanceToCurrent = (currentIndex - homeIndex) & mask;
+			auto distanceToEmpty = (emptyIndex - homeIndex) & mask;
+			if (distanceToEmpty < distanceToCurrent) {
+				m_buckets[emptyIndex] = bucket;
+				emptyIndex = currentIndex;
+			}
+		}
+
+		m_buckets[emptyIndex].Position = Npos;
+		--m_size;
+		return true;
+	}
+
+	void TransactionHashIndex::clear() {
+		m_buckets.clear();
+		m_buckets.shrink_to_fit();
+		m_size = 0;
+	}
+
+	size_t TransactionHashIndex::findBucket(const Hash256& hash) const {
+		if (m_buckets.empty())
+			return Npos;
+
+		auto mask = m_buckets.size() - 1;
+		auto bucketIndex = GetHomeBucket(hash, m_buckets.size());
+		for (;;) {
+			const auto& bucket = m_buckets[bucketIndex];
+			if (Npos == bucket.Position)
+				return Npos;
+
+			if (hash == bucket.Hash)
+				return bucketIndex;
+
+			bucketIndex = (bucketIndex + 1) & mask;
+		}
+	}
+
+	void TransactionHashIndex::rehash(size_t capacity) {
+		std::vector<Bucket> buckets(capacity, Bucket{ Hash256(), Npos });
+		buckets.swap(m_buckets);
+
+		auto mask = capacity - 1;
+		for (const auto& bucket : buckets) {
+			if (Npos == bucket.Position)
+				continue;
+
+			auto bucketIndex = GetHomeBucket(bucket.Hash, capacity);
+			while (Npos != m_buckets[bucketIndex].Position)
+				bucketIndex = (bucketIndex + 1) & mask;
+
+			m_buckets[bucketIndex] = bucket;
+		}
+	}
+}}
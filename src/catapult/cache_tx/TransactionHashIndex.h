@@ -0,0 +1,80 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <limits>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Open addressing index of transaction hashes to positions.
+	/// \note Collisions are resolved by linear probing and erasures shift subsequent buckets backward,
+	///       so the index never contains deleted markers.
+	class TransactionHashIndex {
+	public:
+		/// Position returned when a hash is not indexed.
+		static constexpr size_t Npos = std::numeric_limits<size_t>::max();
+
+	public:
+		/// Creates an empty index.
+		TransactionHashIndex();
+
+	public:
+		/// Gets the number of indexed hashes.
+		size_t size() const;
+
+		/// Gets the number of buckets.
+		size_t capacity() const;
+
+		/// Gets the position associated with \a hash or Npos if \a hash is not indexed.
+		size_t find(const Hash256& hash) const;
+
+	public:
+		/// Associates \a hash with \a position.
+		/// Returns \c false if \a hash is already indexed.
+		bool insert(const Hash256& hash, size_t position);
+
+		/// Changes the position associated with \a hash to \a position.
+		/// Returns \c false if \a hash is not indexed.
+		bool update(const Hash256& hash, size_t position);
+
+		/// Removes \a hash from the index.
+		/// Returns \c false if \a hash is not indexed.
+		bool erase(const Hash256& hash);
+
+		/// Removes all hashes from the index.
+		void clear();
+
+	private:
+		struct Bucket {
+			Hash256 Hash;
+			size_t Position;
+		};
+
+	private:
+		size_t findBucket(const Hash256& hash) const;
+		void rehash(size_t capacity);
+
+	private:
+		std::vector<Bucket> m_buckets;
+		size_t m_size;
+	};
+}}
@@ -20,6 +20,7 @@
 
 #include "BlockExecutor.h"
 #include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/Address.h"
 #include "catapult/model/Block.h"
 #include "catapult/observers/EntityObserver.h"
 
@@ -33,6 +34,25 @@ namespace catapult { namespace chain {
 			return observers::ObserverContext(executionContext.State, height, mode, executionContext.Resolvers);
 		}
 
+		void PrefetchAccounts(const model::BlockElement& blockElement, const BlockExecutionContext& executionContext) {
+			// warm accounts referenced by the block so that observers do not hit (disk-based) storage one account at a time
+			const auto& block = blockElement.Block;
+			std::vector<Address> addresses{
+				model::PublicKeyToAddress(block.SignerPublicKey, block.Network),
+				model::PublicKeyToAddress(block.BeneficiaryPublicKey, block.Network)
+			};
+
+			for (const auto& transactionElement : blockElement.Transactions) {
+				if (!transactionElement.OptionalExtractedAddresses)
+					continue;
+
+				for (const auto& address : *transactionElement.OptionalExtractedAddresses)
+					addresses.push_back(executionContext.Resolvers.resolve(address));
+			}
+
+			executionContext.State.Cache.sub<cache::AccountStateCache>().prefetch(addresses);
+		}
+
 		void ObserveAll(
 				const observers::EntityObserver& observer,
 				observers::ObserverContext& context,
@@ -45,6 +65,7 @@ namespace catapult { namespace chain {
 	void ExecuteBlock(const model::BlockElement& blockElement, const BlockExecutionContext& executionContext) {
 		model::WeakEntityInfos entityInfos;
 		model::ExtractEntityInfos(blockElement, entityInfos);
+		PrefetchAccounts(blockElement, executionContext);
 
 		auto context = CreateObserverContext(executionContext, blockElement.Block.Height, observers::NotifyMode::Commit);
 		ObserveAll(executionContext.Observer, context, entityInfos);
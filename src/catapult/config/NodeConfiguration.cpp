@@ -41,6 +41,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableAddressReuse);
 		LOAD_NODE_PROPERTY(EnableSingleThreadPool);
 		LOAD_NODE_PROPERTY(EnableCacheDatabaseStorage);
+		LOAD_NODE_PROPERTY(EnablePackedBlockStorage);
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
@@ -48,6 +49,7 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxCachedBlockElements);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -75,6 +77,8 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableDispatcherInputAuditing);
 
 		LOAD_NODE_PROPERTY(MaxCacheDatabaseWriteBatchSize);
+		LOAD_NODE_PROPERTY(MaxCachedPatriciaTreeNodes);
+		LOAD_NODE_PROPERTY(EnablePatriciaTreeWarmStart);
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
 		LOAD_NODE_PROPERTY(BatchVerificationRandomSource);
@@ -125,7 +129,41 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeLte(bag, 34 + 4 + 4 + 5 + 7);
+#define LOAD_CACHE_DATABASE_PROPERTY(NAME) utils::LoadIniProperty(bag, "cache_database", #NAME, config.CacheDatabase.NAME)
+
+		LOAD_CACHE_DATABASE_PROPERTY(EnableStatistics);
+		LOAD_CACHE_DATABASE_PROPERTY(MaxBackgroundJobs);
+		LOAD_CACHE_DATABASE_PROPERTY(BlockCacheSize);
+		LOAD_CACHE_DATABASE_PROPERTY(MaxPendingWriteBatches);
+
+		LOAD_CACHE_DATABASE_PROPERTY(WriteBufferSize);
+		LOAD_CACHE_DATABASE_PROPERTY(BloomFilterBitsPerKey);
+		LOAD_CACHE_DATABASE_PROPERTY(EnablePartitionedIndexFilters);
+		LOAD_CACHE_DATABASE_PROPERTY(CompressionPerLevel);
+
+#undef LOAD_CACHE_DATABASE_PROPERTY
+
+		size_t numCacheDatabaseColumnProperties = 0;
+		for (const auto& section : bag.sections()) {
+			std::string prefix("cache_database:");
+			if (section.size() <= prefix.size() || 0 != section.find(prefix))
+				continue;
+
+			auto& columnConfig = config.CacheDatabase.Columns[section.substr(prefix.size())];
+
+#define LOAD_CACHE_DATABASE_COLUMN_PROPERTY(NAME) utils::LoadIniProperty(bag, section.c_str(), #NAME, columnConfig.NAME)
+
+			LOAD_CACHE_DATABASE_COLUMN_PROPERTY(WriteBufferSize);
+			LOAD_CACHE_DATABASE_COLUMN_PROPERTY(BloomFilterBitsPerKey);
+			LOAD_CACHE_DATABASE_COLUMN_PROPERTY(EnablePartitionedIndexFilters);
+			LOAD_CACHE_DATABASE_COLUMN_PROPERTY(CompressionPerLevel);
+
+#undef LOAD_CACHE_DATABASE_COLUMN_PROPERTY
+
+			numCacheDatabaseColumnProperties += 4;
+		}
+
+		utils::VerifyBagSizeLte(bag, 38 + 4 + 4 + 5 + 7 + 8 + numCacheDatabaseColumnProperties);
 		return config;
 	}
 
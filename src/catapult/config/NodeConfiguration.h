@@ -23,6 +23,7 @@
 #include "catapult/model/TransactionSelectionStrategy.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/utils/TimeSpan.h"
+#include <unordered_map>
 #include <unordered_set>
 
 namespace catapult { namespace utils { class ConfigurationBag; } }
@@ -47,6 +48,9 @@ namespace catapult { namespace config {
 		/// \c true if cache data should be saved in a database.
 		bool EnableCacheDatabaseStorage;
 
+		/// \c true if blocks should be stored in memory mapped pack files instead of in one file per block.
+		bool EnablePackedBlockStorage;
+
 		/// \c true if temporary sync files should be automatically cleaned up.
 		/// \note This should be \c false if broker process is running.
 		bool EnableAutoSyncCleanup;
@@ -63,6 +67,9 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of recently loaded block elements to cache in memory.
+		uint32_t MaxCachedBlockElements;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -124,6 +131,12 @@ namespace catapult { namespace config {
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
 
+		/// Maximum number of recently used patricia tree nodes to cache in memory.
+		uint32_t MaxCachedPatriciaTreeNodes;
+
+		/// \c true if patricia tree nodes should be streamed into memory when the node starts.
+		bool EnablePatriciaTreeWarmStart;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
@@ -214,6 +227,44 @@ namespace catapult { namespace config {
 		/// Bannning configuration
 		BanningSubConfiguration Banning;
 
+	public:
+		/// Cache database column configuration.
+		struct CacheDatabaseColumnSubConfiguration {
+			/// Size of a single column memtable (\c 0 to use database default).
+			utils::FileSize WriteBufferSize;
+
+			/// Number of bloom filter bits per key (\c 0 to disable bloom filters).
+			uint32_t BloomFilterBitsPerKey;
+
+			/// \c true if index and filter blocks should be partitioned.
+			bool EnablePartitionedIndexFilters;
+
+			/// Comma separated compression codecs of levels starting with level zero (empty to use database default).
+			std::string CompressionPerLevel;
+		};
+
+		/// Cache database configuration.
+		struct CacheDatabaseSubConfiguration : public CacheDatabaseColumnSubConfiguration {
+			/// Size of the block cache shared by all cache database columns (\c 0 to use database default).
+			utils::FileSize BlockCacheSize;
+
+			/// Maximum number of concurrent background flush and compaction jobs per database (\c 0 to use database default).
+			uint32_t MaxBackgroundJobs;
+
+			/// \c true if database statistics should be collected.
+			bool EnableStatistics;
+
+			/// Maximum number of flushed batches that are queued for writing in the background (\c 0 to write batches synchronously).
+			uint32_t MaxPendingWriteBatches;
+
+			/// Custom column configurations keyed by column name.
+			std::unordered_map<std::string, CacheDatabaseColumnSubConfiguration> Columns;
+		};
+
+	public:
+		/// Cache database configuration.
+		CacheDatabaseSubConfiguration CacheDatabase;
+
 	private:
 		NodeConfiguration() = default;
 
@@ -32,10 +32,12 @@ namespace catapult { namespace consumers {
 	namespace {
 		class SignatureCapturingNotificationSubscriber : public model::NotificationSubscriber {
 		public:
-			explicit SignatureCapturingNotificationSubscriber(const GenerationHashSeed& generationHashSeed)
+			SignatureCapturingNotificationSubscriber(const GenerationHashSeed& generationHashSeed, size_t capacityHint)
 					: m_generationHashSeed(generationHashSeed)
-					, m_entityIndex(0)
-			{}
+					, m_entityIndex(0) {
+				m_notificationToEntityIndexMap.reserve(capacityHint);
+				m_inputs.reserve(capacityHint);
+			}
 
 		public:
 			const auto& notificationToEntityIndexMap() const {
@@ -62,7 +64,7 @@ namespace catapult { namespace consumers {
 
 		private:
 			void add(const model::SignatureNotification& notification) {
-				std::vector<RawBuffer> buffers;
+				crypto::SignatureInputBuffers buffers;
 				if (model::SignatureNotification::ReplayProtectionMode::Enabled == notification.DataReplayProtectionMode)
 					buffers.push_back(m_generationHashSeed);
 
@@ -82,7 +84,8 @@ namespace catapult { namespace consumers {
 				const GenerationHashSeed& generationHashSeed,
 				const model::NotificationPublisher& publisher,
 				const model::WeakEntityInfos& entityInfos) {
-			auto pSub = std::make_unique<SignatureCapturingNotificationSubscriber>(generationHashSeed);
+			// every entity is expected to have at least one signature, so presize the captured inputs accordingly
+			auto pSub = std::make_unique<SignatureCapturingNotificationSubscriber>(generationHashSeed, entityInfos.size());
 			for (const auto& entityInfo : entityInfos) {
 				publisher.publish(entityInfo, *pSub);
 				pSub->next();
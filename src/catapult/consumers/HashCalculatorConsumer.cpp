@@ -21,7 +21,6 @@
 #include "BlockConsumers.h"
 #include "ConsumerResultFactory.h"
 #include "TransactionConsumers.h"
-#include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/model/EntityHasher.h"
 
@@ -42,17 +41,26 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				// note that disruptor input elements have been extracted from a packet (or created within this
+				// process), so their sizes have already been validated
 				for (auto& element : elements) {
-					// note that disruptor input elements have been extracted from a packet (or created within this
-					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.push_back(model::TransactionElement(transaction));
+				}
+
+				// calculate the hashes of all transactions in all blocks together
+				model::TransactionHashesBuilder transactionHashesBuilder(m_transactionRegistry, m_generationHashSeed);
+				for (auto& element : elements) {
+					for (auto& transactionElement : element.Transactions)
+						transactionHashesBuilder.update(transactionElement);
+				}
 
+				transactionHashesBuilder.final();
+
+				for (auto& element : elements) {
+					crypto::MerkleHashBuilder transactionsHashBuilder(element.Transactions.size());
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
@@ -92,8 +100,11 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				model::TransactionHashesBuilder transactionHashesBuilder(m_transactionRegistry, m_generationHashSeed);
 				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, element);
+					transactionHashesBuilder.update(element);
+
+				transactionHashesBuilder.final();
 
 				return Continue();
 			}
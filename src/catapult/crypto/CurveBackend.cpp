@@ -0,0 +1,112 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CurveBackend.h"
+#include "CryptoUtils.h"
+#include "MultiLaneCurveKernels.h"
+#include "catapult/utils/CpuFeatures.h"
+#include <vector>
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"
+#pragma clang diagnostic ignored "-Wcast-align"
+#pragma clang diagnostic ignored "-Wcast-qual"
+#pragma clang diagnostic ignored "-Wimplicit-fallthrough"
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#pragma clang diagnostic ignored "-Wunused-function"
+#pragma clang diagnostic ignored "-Wreserved-id-macro"
+#pragma clang diagnostic ignored "-Wdocumentation"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+#elif defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4324) /* ed25519 structs use __declspec(align()) */
+#pragma warning(disable : 4388) /* signed/unsigned mismatch */
+#pragma warning(disable : 4505) /* unreferenced local function has been removed */
+#endif
+
+extern "C" {
+#include <donna/ed25519-donna.h>
+}
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		using CheckMainSubgroupKernel = void (*)(const detail::EncodedExtendedPoint*, size_t, bool*);
+
+		void CheckMultiLane(CheckMainSubgroupKernel checkMainSubgroup, const ge25519* pPoints, size_t count, bool* pResults) {
+			// multi-lane kernels work on canonically encoded coordinates
+			std::vector<detail::EncodedExtendedPoint> encodedPoints(count);
+			for (auto i = 0u; i < count; ++i) {
+				curve25519_contract(encodedPoints[i].X, pPoints[i].x);
+				curve25519_contract(encodedPoints[i].Y, pPoints[i].y);
+				curve25519_contract(encodedPoints[i].Z, pPoints[i].z);
+				curve25519_contract(encodedPoints[i].T, pPoints[i].t);
+			}
+
+			checkMainSubgroup(encodedPoints.data(), count, pResults);
+		}
+	}
+
+	bool IsCurveBackendSupported(CurveBackend backend) {
+		switch (backend) {
+		case CurveBackend::Scalar:
+			return true;
+
+		case CurveBackend::Avx2:
+			return detail::IsAvx2KernelAvailable() && utils::IsCpuFeatureSupported(utils::CpuFeature::Avx2);
+
+		case CurveBackend::Avx512:
+			return detail::IsAvx512KernelAvailable() && utils::IsCpuFeatureSupported(utils::CpuFeature::Avx512);
+		}
+
+		return false;
+	}
+
+	CurveBackend GetDefaultCurveBackend() {
+		// 4-way avx2 field arithmetic is register bound and does not outperform donna, so it is never selected implicitly
+		static const auto Default_Backend = IsCurveBackendSupported(CurveBackend::Avx512) ? CurveBackend::Avx512 : CurveBackend::Scalar;
+		return Default_Backend;
+	}
+
+	void CheckMainSubgroup(CurveBackend backend, const ge25519* pPoints, size_t count, bool* pResults) {
+		if (IsCurveBackendSupported(backend)) {
+			if (CurveBackend::Avx2 == backend)
+				return CheckMultiLane(detail::CheckMainSubgroupAvx2, pPoints, count, pResults);
+
+			if (CurveBackend::Avx512 == backend)
+				return CheckMultiLane(detail::CheckMainSubgroupAvx512, pPoints, count, pResults);
+		}
+
+		for (auto i = 0u; i < count; ++i)
+			pResults[i] = IsInMainSubgroup(pPoints[i]);
+	}
+}}
@@ -0,0 +1,51 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <stddef.h>
+
+struct ge25519_t;
+using ge25519 = ge25519_t;
+
+namespace catapult { namespace crypto {
+
+	/// Curve arithmetic backends.
+	enum class CurveBackend {
+		/// Portable scalar field arithmetic.
+		Scalar,
+
+		/// 4-way avx2 field arithmetic.
+		Avx2,
+
+		/// 8-way avx512 field arithmetic.
+		Avx512
+	};
+
+	/// Returns \c true if \a backend is compiled in and supported by the current cpu.
+	bool IsCurveBackendSupported(CurveBackend backend);
+
+	/// Gets the fastest curve backend that is supported by the current cpu (avx2 is only used when requested explicitly).
+	CurveBackend GetDefaultCurveBackend();
+
+	/// Checks whether each of the \a count points pointed to by \a pPoints is in the main subgroup using \a backend
+	/// and stores the results in \a pResults.
+	/// \note The scalar backend is used when \a backend is not supported.
+	void CheckMainSubgroup(CurveBackend backend, const ge25519* pPoints, size_t count, bool* pResults);
+}}
@@ -19,72 +19,122 @@
 **/
 
 #include "MerkleHashBuilder.h"
-#include "Hashes.h"
-#include "catapult/functions.h"
+#include "MultiBufferHashes.h"
+#include <algorithm>
 
 namespace catapult { namespace crypto {
 
-	namespace {
-		Hash256 Final(std::vector<Hash256>& hashes, const consumer<const Hash256*, size_t>& hashConsumer) {
-			if (hashes.empty()) {
-				Hash256 hash{};
-				hashConsumer(&hash, 1);
-				return hash;
-			}
-
-			// build the merkle tree
-			auto numRemainingHashes = hashes.size();
-			hashConsumer(hashes.data(), hashes.size());
-			while (numRemainingHashes > 1) {
-				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
-				// pushed into the vector because nodes with same depth should be consecutive entries in the vector
-				if (1 == numRemainingHashes % 2)
-					hashConsumer(&hashes[numRemainingHashes - 1], 1);
-
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256::Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
-
-					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
-					++numRemainingHashes;
-				}
-
-				numRemainingHashes /= 2;
-			}
+	MerkleHashBuilder::MerkleHashBuilder(size_t capacity) : MerkleHashBuilder(capacity, utils::PartitionRunner())
+	{}
 
-			return hashes[0];
-		}
+	MerkleHashBuilder::MerkleHashBuilder(size_t capacity, const utils::PartitionRunner& partitionRunner)
+			: m_partitionRunner(partitionRunner)
+			, m_levels(1)
+			, m_numFinalNodes(1, 0) {
+		m_levels[0].reserve(capacity);
 	}
 
-	MerkleHashBuilder::MerkleHashBuilder(size_t capacity) {
-		m_hashes.reserve(capacity);
+	size_t MerkleHashBuilder::size() const {
+		return m_levels[0].size();
 	}
 
 	void MerkleHashBuilder::update(const Hash256& hash) {
-		m_hashes.push_back(hash);
+		m_levels[0].push_back(hash);
+	}
+
+	void MerkleHashBuilder::truncate(size_t size) {
+		if (size >= m_levels[0].size())
+			return;
+
+		// a node stays final only when all leaves below it are retained
+		m_levels[0].resize(size);
+		for (auto level = 1u; level < m_levels.size(); ++level)
+			m_numFinalNodes[level] = std::min(m_numFinalNodes[level], size >> level);
+
+		m_numFinalNodes[0] = size;
 	}
 
 	void MerkleHashBuilder::final(Hash256& hash) {
 		// build the merkle root
-		hash = Final(m_hashes, [](const auto*, auto) {});
+		if (m_levels[0].empty()) {
+			hash = Hash256();
+			return;
+		}
+
+		rebuild();
+		hash = m_levels.back()[0];
 	}
 
 	void MerkleHashBuilder::final(std::vector<Hash256>& tree) {
 		// build the complete merkle tree
-		tree.reserve(TreeSize(m_hashes.size()));
-		Final(m_hashes, [&tree](const Hash256* pHash, size_t count) {
-			for (auto i = 0u; i < count; ++i)
-				tree.push_back(*pHash++);
-		});
+		if (m_levels[0].empty()) {
+			tree.push_back(Hash256());
+			return;
+		}
+
+		rebuild();
+		tree.reserve(tree.size() + TreeSize(m_levels[0].size()));
+		for (const auto& hashes : m_levels) {
+			tree.insert(tree.end(), hashes.cbegin(), hashes.cend());
+
+			// merkle tree needs padding in case of an odd number of hashes (other than the root)
+			if (hashes.size() > 1 && 1 == hashes.size() % 2)
+				tree.push_back(hashes.back());
+		}
+	}
+
+	void MerkleHashBuilder::rebuild() {
+		// all leaves are final, so a parent node is final when both of its children are final;
+		// only nodes that are not final (the right spine and all nodes above new leaves) need to be rehashed
+		auto numFinalChildNodes = m_levels[0].size();
+		auto level = 1u;
+		for (; m_levels[level - 1].size() > 1; ++level) {
+			if (m_levels.size() == level) {
+				m_levels.emplace_back();
+				m_numFinalNodes.push_back(0);
+			}
+
+			m_levels[level].resize((m_levels[level - 1].size() + 1) / 2);
+			hashLevel(level, m_numFinalNodes[level]);
+
+			numFinalChildNodes /= 2;
+			m_numFinalNodes[level] = numFinalChildNodes;
+		}
+
+		// drop levels above the root that are left over from a larger (truncated) tree
+		m_levels.resize(level);
+		m_numFinalNodes.resize(level);
+		m_numFinalNodes[0] = m_levels[0].size();
+	}
+
+	void MerkleHashBuilder::hashLevel(size_t level, size_t startIndex) {
+		const auto& childHashes = m_levels[level - 1];
+		auto& hashes = m_levels[level];
+		auto hashPartition = [&childHashes, &hashes, startIndex](auto partitionStartIndex, auto count) {
+			// note: all nodes in a level are independent, so they are hashed together
+			Sha3_256_MultiBuilder builder(count);
+			for (auto i = startIndex + partitionStartIndex; i < startIndex + partitionStartIndex + count; ++i) {
+				const auto& leftHash = childHashes[2 * i];
+				if (2 * i + 1 < childHashes.size()) {
+					builder.add({ { leftHash.data(), 2 * Hash256::Size } }, hashes[i]);
+					continue;
+				}
+
+				// if there is an odd number of hashes, duplicate the last one
+				builder.add({ leftHash, leftHash }, hashes[i]);
+			}
+
+			builder.final();
+		};
+
+		auto numHashes = hashes.size() - startIndex;
+		if (0 == numHashes)
+			return;
+
+		if (m_partitionRunner && numHashes >= Min_Partitioned_Level_Size)
+			m_partitionRunner(numHashes, hashPartition);
+		else
+			hashPartition(0, numHashes);
 	}
 
 	size_t MerkleHashBuilder::TreeSize(size_t leafCount) {
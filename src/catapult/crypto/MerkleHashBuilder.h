@@ -19,25 +19,48 @@
 **/
 
 #pragma once
+#include "catapult/utils/ParallelRunners.h"
 #include "catapult/types.h"
 #include <vector>
 
 namespace catapult { namespace crypto {
 
 	/// Builder for creating a merkle hash.
+	/// \note Interior nodes are cached across finalizations, so adding leaves after a finalization only rehashes the right spine.
 	class MerkleHashBuilder {
+	public:
+		/// Minimum number of nodes that need to be (re)hashed in a level before the partition runner is used.
+		static constexpr size_t Min_Partitioned_Level_Size = 1024;
+
 	public:
 		/// Creates a new merkle hash builder with the specified initial \a capacity.
 		explicit MerkleHashBuilder(size_t capacity = 0);
 
+		/// Creates a new merkle hash builder with the specified initial \a capacity that uses \a partitionRunner to hash large levels.
+		MerkleHashBuilder(size_t capacity, const utils::PartitionRunner& partitionRunner);
+
+	public:
+		/// Gets the number of hashes added to the merkle hash.
+		size_t size() const;
+
 	public:
 		/// Adds \a hash to the merkle hash.
 		void update(const Hash256& hash);
 
+		/// Removes all but the first \a size hashes from the merkle hash.
+		/// \note Cached interior nodes that only depend on the remaining hashes are preserved.
+		void truncate(size_t size);
+
+		/// Hashes all interior nodes that are not cached without finalizing the merkle hash.
+		/// \note This allows the hashing work of a later finalization to be done ahead of time.
+		void rebuild();
+
 		/// Finalizes the merkle hash into \a hash.
+		/// \note Builder can continue to be updated after finalization.
 		void final(Hash256& hash);
 
 		/// Finalizes the complete merkle tree into \a tree.
+		/// \note Builder can continue to be updated after finalization.
 		void final(std::vector<Hash256>& tree);
 
 	public:
@@ -45,6 +68,15 @@ namespace catapult { namespace crypto {
 		static size_t TreeSize(size_t leafCount);
 
 	private:
-		std::vector<Hash256> m_hashes;
+		void hashLevel(size_t level, size_t startIndex);
+
+	private:
+		utils::PartitionRunner m_partitionRunner;
+
+		// first level contains the leaves, last level contains the root
+		std::vector<std::vector<Hash256>> m_levels;
+
+		// number of (leading) nodes in each level that were calculated from final child nodes and never need to be rehashed
+		std::vector<size_t> m_numFinalNodes;
 	};
 }}
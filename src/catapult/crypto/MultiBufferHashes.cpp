@@ -0,0 +1,232 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiBufferHashes.h"
+#include "Hashes.h"
+#include "MultiLaneKeccakKernels.h"
+#include "catapult/utils/CpuFeatures.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <cstring>
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		// region multi-lane sponge
+
+		constexpr size_t Sha3_256_Rate = 136;
+		constexpr size_t Max_Lanes = 8;
+
+		using PermuteKernel = void (*)(uint64_t*);
+
+		struct HashInput {
+			const RawBuffer* pBuffers;
+			size_t NumBuffers;
+			Hash256* pHash;
+		};
+
+		struct LaneCursor {
+			const RawBuffer* pBuffer;
+			const RawBuffer* pBuffersEnd;
+			size_t Offset;
+			Hash256* pHash;
+			bool IsActive;
+			bool IsLastBlock;
+		};
+
+		size_t Gather(LaneCursor& cursor, uint8_t* pBlock) {
+			size_t size = 0;
+			while (size < Sha3_256_Rate && cursor.pBuffersEnd != cursor.pBuffer) {
+				auto numBytes = std::min(Sha3_256_Rate - size, cursor.pBuffer->Size - cursor.Offset);
+				if (0 != numBytes)
+					std::memcpy(pBlock + size, cursor.pBuffer->pData + cursor.Offset, numBytes);
+
+				size += numBytes;
+				cursor.Offset += numBytes;
+				if (cursor.pBuffer->Size == cursor.Offset) {
+					++cursor.pBuffer;
+					cursor.Offset = 0;
+				}
+			}
+
+			return size;
+		}
+
+		template<typename TInputAccessor>
+		void HashMultiLane(PermuteKernel permute, size_t numLanes, size_t count, TInputAccessor inputAccessor) {
+			alignas(64) uint64_t states[detail::Keccak_State_Words * Max_Lanes];
+			LaneCursor cursors[Max_Lanes];
+
+			size_t nextInputIndex = 0;
+			auto assignNextInput = [&states, &cursors, &nextInputIndex, numLanes, count, inputAccessor](auto lane) {
+				for (auto i = 0u; i < detail::Keccak_State_Words; ++i)
+					states[i * numLanes + lane] = 0;
+
+				auto& cursor = cursors[lane];
+				cursor.IsActive = nextInputIndex < count;
+				cursor.IsLastBlock = false;
+				if (!cursor.IsActive)
+					return false;
+
+				auto input = inputAccessor(nextInputIndex++);
+				cursor.pBuffer = input.pBuffers;
+				cursor.pBuffersEnd = input.pBuffers + input.NumBuffers;
+				cursor.Offset = 0;
+				cursor.pHash = input.pHash;
+				return true;
+			};
+
+			auto numActiveLanes = 0u;
+			for (auto lane = 0u; lane < numLanes; ++lane)
+				numActiveLanes += assignNextInput(lane) ? 1 : 0;
+
+			while (0 != numActiveLanes) {
+				// absorb the next block of every active lane, lanes that are idle keep permuting their (ignored) state
+				for (auto lane = 0u; lane < numLanes; ++lane) {
+					auto& cursor = cursors[lane];
+					if (!cursor.IsActive)
+						continue;
+
+					alignas(8) uint8_t block[Sha3_256_Rate]{};
+					auto size = Gather(cursor, block);
+					if (Sha3_256_Rate != size) {
+						// sha3 domain separation and pad10*1
+						block[size] ^= 0x06;
+						block[Sha3_256_Rate - 1] ^= 0x80;
+						cursor.IsLastBlock = true;
+					}
+
+					for (auto i = 0u; i < Sha3_256_Rate / sizeof(uint64_t); ++i) {
+						uint64_t word;
+						std::memcpy(&word, block + i * sizeof(uint64_t), sizeof(uint64_t));
+						states[i * numLanes + lane] ^= word;
+					}
+				}
+
+				permute(states);
+
+				// squeeze all completed lanes and refill them with pending inputs
+				for (auto lane = 0u; lane < numLanes; ++lane) {
+					auto& cursor = cursors[lane];
+					if (!cursor.IsActive || !cursor.IsLastBlock)
+						continue;
+
+					for (auto i = 0u; i < Hash256::Size / sizeof(uint64_t); ++i)
+						std::memcpy(cursor.pHash->data() + i * sizeof(uint64_t), &states[i * numLanes + lane], sizeof(uint64_t));
+
+					if (!assignNextInput(lane))
+						--numActiveLanes;
+				}
+			}
+		}
+
+		// endregion
+
+		template<typename TInputAccessor>
+		void HashMulti(MultiBufferHashBackend backend, size_t count, TInputAccessor inputAccessor) {
+			if (IsMultiBufferHashBackendSupported(backend)) {
+				if (MultiBufferHashBackend::Avx2 == backend)
+					return HashMultiLane(detail::KeccakF1600Avx2, 4, count, inputAccessor);
+
+				if (MultiBufferHashBackend::Avx512 == backend)
+					return HashMultiLane(detail::KeccakF1600Avx512, 8, count, inputAccessor);
+			}
+
+			for (auto i = 0u; i < count; ++i) {
+				auto input = inputAccessor(i);
+
+				Sha3_256_Builder builder;
+				for (auto j = 0u; j < input.NumBuffers; ++j)
+					builder.update(input.pBuffers[j]);
+
+				builder.final(*input.pHash);
+			}
+		}
+	}
+
+	bool IsMultiBufferHashBackendSupported(MultiBufferHashBackend backend) {
+		switch (backend) {
+		case MultiBufferHashBackend::Scalar:
+			return true;
+
+		case MultiBufferHashBackend::Avx2:
+			return detail::IsKeccakAvx2KernelAvailable() && utils::IsCpuFeatureSupported(utils::CpuFeature::Avx2);
+
+		case MultiBufferHashBackend::Avx512:
+			return detail::IsKeccakAvx512KernelAvailable() && utils::IsCpuFeatureSupported(utils::CpuFeature::Avx512);
+		}
+
+		return false;
+	}
+
+	MultiBufferHashBackend GetDefaultMultiBufferHashBackend() {
+		static const auto Default_Backend = IsMultiBufferHashBackendSupported(MultiBufferHashBackend::Avx512)
+				? MultiBufferHashBackend::Avx512
+				: IsMultiBufferHashBackendSupported(MultiBufferHashBackend::Avx2)
+						? MultiBufferHashBackend::Avx2
+						: MultiBufferHashBackend::Scalar;
+		return Default_Backend;
+	}
+
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes) {
+		Sha3_256_Multi(GetDefaultMultiBufferHashBackend(), pDataBuffers, count, pHashes);
+	}
+
+	void Sha3_256_Multi(MultiBufferHashBackend backend, const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes) {
+		HashMulti(backend, count, [pDataBuffers, pHashes](auto index) {
+			return HashInput{ pDataBuffers + index, 1, pHashes + index };
+		});
+	}
+
+	Sha3_256_MultiBuilder::Sha3_256_MultiBuilder(size_t capacity)
+			: Sha3_256_MultiBuilder(GetDefaultMultiBufferHashBackend(), capacity)
+	{}
+
+	Sha3_256_MultiBuilder::Sha3_256_MultiBuilder(MultiBufferHashBackend backend, size_t capacity) : m_backend(backend) {
+		m_inputs.reserve(capacity);
+	}
+
+	size_t Sha3_256_MultiBuilder::size() const {
+		return m_inputs.size();
+	}
+
+	void Sha3_256_MultiBuilder::add(std::initializer_list<const RawBuffer> buffers, Hash256& hash) {
+		m_inputs.push_back({ m_buffers.size(), buffers.size(), &hash });
+		m_buffers.insert(m_buffers.end(), buffers.begin(), buffers.end());
+	}
+
+	void Sha3_256_MultiBuilder::append(const RawBuffer& buffer) {
+		if (m_inputs.empty())
+			CATAPULT_THROW_RUNTIME_ERROR("cannot append buffer to empty multi builder");
+
+		m_buffers.push_back(buffer);
+		++m_inputs.back().NumBuffers;
+	}
+
+	void Sha3_256_MultiBuilder::final() {
+		HashMulti(m_backend, m_inputs.size(), [this](auto index) {
+			const auto& input = m_inputs[index];
+			return HashInput{ m_buffers.data() + input.BufferIndex, input.NumBuffers, input.pHash };
+		});
+
+		m_buffers.clear();
+		m_inputs.clear();
+	}
+}}
@@ -0,0 +1,92 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <initializer_list>
+#include <vector>
+
+namespace catapult { namespace crypto {
+
+	/// Multi-buffer hashing backends.
+	enum class MultiBufferHashBackend {
+		/// One (openssl) hash calculation per input.
+		Scalar,
+
+		/// 4-way avx2 keccak.
+		Avx2,
+
+		/// 8-way avx512 keccak.
+		Avx512
+	};
+
+	/// Returns \c true if \a backend is compiled in and supported by the current cpu.
+	bool IsMultiBufferHashBackendSupported(MultiBufferHashBackend backend);
+
+	/// Gets the fastest multi-buffer hashing backend that is supported by the current cpu.
+	MultiBufferHashBackend GetDefaultMultiBufferHashBackend();
+
+	/// Calculates the 256-bit SHA3 hashes of all \a count independent buffers pointed to by \a pDataBuffers into \a pHashes.
+	/// \note \a pHashes must not overlap any data buffer.
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes);
+
+	/// Calculates the 256-bit SHA3 hashes of all \a count independent buffers pointed to by \a pDataBuffers into \a pHashes
+	/// using \a backend.
+	/// \note The scalar backend is used when \a backend is not supported.
+	void Sha3_256_Multi(MultiBufferHashBackend backend, const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes);
+
+	/// Builder for calculating multiple independent 256-bit SHA3 hashes at once.
+	class Sha3_256_MultiBuilder {
+	public:
+		/// Creates a builder with the specified initial \a capacity (number of hashes) using the default backend.
+		explicit Sha3_256_MultiBuilder(size_t capacity = 0);
+
+		/// Creates a builder with the specified initial \a capacity (number of hashes) using \a backend.
+		Sha3_256_MultiBuilder(MultiBufferHashBackend backend, size_t capacity);
+
+	public:
+		/// Gets the number of pending hashes.
+		size_t size() const;
+
+	public:
+		/// Adds a hash of the concatenated \a buffers that will be stored in \a hash when the builder is finalized.
+		void add(std::initializer_list<const RawBuffer> buffers, Hash256& hash);
+
+		/// Appends \a buffer to the data of the most recently added hash.
+		void append(const RawBuffer& buffer);
+
+		/// Calculates all pending hashes and resets the builder.
+		/// \note All buffers and hashes passed to the builder must remain valid until this function is called
+		///       and no hash can overlap any buffer.
+		void final();
+
+	private:
+		struct Input {
+			size_t BufferIndex;
+			size_t NumBuffers;
+			Hash256* pHash;
+		};
+
+	private:
+		MultiBufferHashBackend m_backend;
+		std::vector<RawBuffer> m_buffers;
+		std::vector<Input> m_inputs;
+	};
+}}
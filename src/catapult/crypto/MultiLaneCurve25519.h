@@ -0,0 +1,625 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "MultiLaneCurveKernels.h"
+#include <string.h>
+
+namespace catapult { namespace crypto { namespace detail {
+
+	// field elements are stored in radix 2^25.5 (alternating 26 and 25 bit limbs) with one 64-bit lane per element,
+	// which allows 32x32->64 bit lane multiplication to be used for the limb products (like curve25519-donna-32bit)
+	//
+	// TLanes must provide:
+	// - Vector type and Count (number of lanes)
+	// - Broadcast, Load, Store
+	// - Add, Sub, And, Mul (multiplication of the low 32 bits of each lane)
+	// - ShiftLeft<N>, ShiftRight<N>
+	//
+	// all functions are static members of a class template instantiated with a lane type that is local to a single
+	// translation unit, so no code compiled with extended instruction sets can leak into other translation units
+
+	/// Multi-lane curve25519 arithmetic that processes TLanes::Count independent points at once.
+	template<typename TLanes>
+	class MultiLaneCurve25519 {
+	private:
+		using Vector = typename TLanes::Vector;
+
+		static constexpr size_t Num_Lanes = TLanes::Count;
+		static constexpr size_t Num_Limbs = 10;
+		static constexpr uint64_t Mask_25 = (static_cast<uint64_t>(1) << 25) - 1;
+		static constexpr uint64_t Mask_26 = (static_cast<uint64_t>(1) << 26) - 1;
+
+		struct FieldElement {
+			Vector Limbs[Num_Limbs];
+		};
+
+		struct ExtendedPoint {
+			FieldElement X;
+			FieldElement Y;
+			FieldElement Z;
+			FieldElement T;
+		};
+
+		struct CompletedPoint {
+			FieldElement X;
+			FieldElement Y;
+			FieldElement Z;
+			FieldElement T;
+		};
+
+		struct PnielsPoint {
+			FieldElement YSubX;
+			FieldElement XAddY;
+			FieldElement Z;
+			FieldElement T2d;
+		};
+
+	public:
+		/// Checks whether each of the \a count points pointed to by \a pPoints is in the main subgroup
+		/// and stores the results in \a pResults.
+		static void CheckMainSubgroup(const EncodedExtendedPoint* pPoints, size_t count, bool* pResults) {
+			for (size_t offset = 0; offset < count; offset += Num_Lanes) {
+				auto numPoints = count - offset < Num_Lanes ? count - offset : Num_Lanes;
+
+				ExtendedPoint point;
+				Load(point, pPoints + offset, numPoints);
+
+				ExtendedPoint result;
+				ScalarMultGroupOrder(result, point);
+
+				// A is in the main subgroup iff q * A is the neutral element (x == 0, y == z)
+				alignas(64) uint8_t encodedX[Num_Lanes][32];
+				alignas(64) uint8_t encodedY[Num_Lanes][32];
+				alignas(64) uint8_t encodedZ[Num_Lanes][32];
+				Contract(encodedX, result.X);
+				Contract(encodedY, result.Y);
+				Contract(encodedZ, result.Z);
+
+				static const uint8_t Zero[32] = {};
+				for (size_t i = 0; i < numPoints; ++i)
+					pResults[offset + i] = 0 == memcmp(encodedX[i], Zero, 32) && 0 == memcmp(encodedY[i], encodedZ[i], 32);
+			}
+		}
+
+	private:
+		// region scalar conversions
+
+		static void Expand(uint64_t* limbs, const uint8_t* encoded) {
+			uint64_t words[4];
+			memcpy(words, encoded, sizeof(words)); // little endian
+
+			limbs[0] = words[0] & Mask_26;
+			limbs[1] = (words[0] >> 26) & Mask_25;
+			limbs[2] = ((words[0] >> 51) | (words[1] << 13)) & Mask_26;
+			limbs[3] = (words[1] >> 13) & Mask_25;
+			limbs[4] = (words[1] >> 38) & Mask_26;
+			limbs[5] = words[2] & Mask_25;
+			limbs[6] = (words[2] >> 25) & Mask_26;
+			limbs[7] = ((words[2] >> 51) | (words[3] << 13)) & Mask_25;
+			limbs[8] = (words[3] >> 12) & Mask_26;
+			limbs[9] = (words[3] >> 38) & Mask_25;
+		}
+
+		static void CarryScalar(uint64_t* limbs) {
+			uint64_t carry = 0;
+			for (auto i = 0u; i < Num_Limbs; ++i) {
+				limbs[i] += carry;
+				carry = limbs[i] >> (0 == i % 2 ? 26 : 25);
+				limbs[i] &= 0 == i % 2 ? Mask_26 : Mask_25;
+			}
+
+			limbs[0] += carry * 19;
+		}
+
+		static void ContractScalar(uint8_t* encoded, uint64_t* limbs) {
+			// fully carry twice so that all limbs fit and value < 2 * p
+			CarryScalar(limbs);
+			CarryScalar(limbs);
+
+			// q = (value + 19) >> 255 is 1 iff value >= p
+			auto q = (limbs[0] + 19) >> 26;
+			for (auto i = 1u; i < Num_Limbs; ++i)
+				q = (limbs[i] + q) >> (0 == i % 2 ? 26 : 25);
+
+			// value - q * p = value + 19 * q - q * 2^255
+			limbs[0] += 19 * q;
+			uint64_t carry = 0;
+			for (auto i = 0u; i < Num_Limbs; ++i) {
+				limbs[i] += carry;
+				carry = limbs[i] >> (0 == i % 2 ? 26 : 25);
+				limbs[i] &= 0 == i % 2 ? Mask_26 : Mask_25;
+			}
+
+			uint64_t words[4];
+			words[0] = limbs[0] | (limbs[1] << 26) | (limbs[2] << 51);
+			words[1] = (limbs[2] >> 13) | (limbs[3] << 13) | (limbs[4] << 38);
+			words[2] = limbs[5] | (limbs[6] << 25) | (limbs[7] << 51);
+			words[3] = (limbs[7] >> 13) | (limbs[8] << 12) | (limbs[9] << 38);
+			memcpy(encoded, words, sizeof(words)); // little endian
+		}
+
+		static void Load(FieldElement& element, const uint8_t* (&encodedElements)[Num_Lanes]) {
+			alignas(64) uint64_t lanes[Num_Limbs][Num_Lanes];
+			for (size_t i = 0; i < Num_Lanes; ++i) {
+				uint64_t limbs[Num_Limbs];
+				Expand(limbs, encodedElements[i]);
+				for (auto j = 0u; j < Num_Limbs; ++j)
+					lanes[j][i] = limbs[j];
+			}
+
+			for (auto j = 0u; j < Num_Limbs; ++j)
+				element.Limbs[j] = TLanes::Load(lanes[j]);
+		}
+
+		static void Load(ExtendedPoint& point, const EncodedExtendedPoint* pPoints, size_t numPoints) {
+			// unused lanes are filled with the first point
+			const uint8_t* encodedElements[4][Num_Lanes];
+			for (size_t i = 0; i < Num_Lanes; ++i) {
+				const auto& encodedPoint = pPoints[i < numPoints ? i : 0];
+				encodedElements[0][i] = encodedPoint.X;
+				encodedElements[1][i] = encodedPoint.Y;
+				encodedElements[2][i] = encodedPoint.Z;
+				encodedElements[3][i] = encodedPoint.T;
+			}
+
+			Load(point.X, encodedElements[0]);
+			Load(point.Y, encodedElements[1]);
+			Load(point.Z, encodedElements[2]);
+			Load(point.T, encodedElements[3]);
+		}
+
+		static void Contract(uint8_t (&encodedElements)[Num_Lanes][32], const FieldElement& element) {
+			alignas(64) uint64_t lanes[Num_Limbs][Num_Lanes];
+			for (auto j = 0u; j < Num_Limbs; ++j)
+				TLanes::Store(lanes[j], element.Limbs[j]);
+
+			for (size_t i = 0; i < Num_Lanes; ++i) {
+				uint64_t limbs[Num_Limbs];
+				for (auto j = 0u; j < Num_Limbs; ++j)
+					limbs[j] = lanes[j][i];
+
+				ContractScalar(encodedElements[i], limbs);
+			}
+		}
+
+		static void SetConstant(FieldElement& element, const uint64_t* limbs) {
+			for (auto j = 0u; j < Num_Limbs; ++j)
+				element.Limbs[j] = TLanes::Broadcast(limbs[j]);
+		}
+
+		// endregion
+
+		// region field arithmetic
+
+		// carries 64-bit limbs so that all limbs (except limbs 1 and 5, which can exceed their widths slightly) fit
+		static void Carry(FieldElement& out, Vector (&h)[Num_Limbs]) {
+			auto mask25 = TLanes::Broadcast(Mask_25);
+			auto mask26 = TLanes::Broadcast(Mask_26);
+
+			// carry two independent chains (0 -> 5 and 4 -> 10) in parallel in order to shorten dependencies (like ref10)
+			Vector carry0, carry1;
+			carry0 = TLanes::template ShiftRight<26>(h[0]); h[0] = TLanes::And(h[0], mask26); h[1] = TLanes::Add(h[1], carry0);
+			carry1 = TLanes::template ShiftRight<26>(h[4]); h[4] = TLanes::And(h[4], mask26); h[5] = TLanes::Add(h[5], carry1);
+			carry0 = TLanes::template ShiftRight<25>(h[1]); h[1] = TLanes::And(h[1], mask25); h[2] = TLanes::Add(h[2], carry0);
+			carry1 = TLanes::template ShiftRight<25>(h[5]); h[5] = TLanes::And(h[5], mask25); h[6] = TLanes::Add(h[6], carry1);
+			carry0 = TLanes::template ShiftRight<26>(h[2]); h[2] = TLanes::And(h[2], mask26); h[3] = TLanes::Add(h[3], carry0);
+			carry1 = TLanes::template ShiftRight<26>(h[6]); h[6] = TLanes::And(h[6], mask26); h[7] = TLanes::Add(h[7], carry1);
+			carry0 = TLanes::template ShiftRight<25>(h[3]); h[3] = TLanes::And(h[3], mask25); h[4] = TLanes::Add(h[4], carry0);
+			carry1 = TLanes::template ShiftRight<25>(h[7]); h[7] = TLanes::And(h[7], mask25); h[8] = TLanes::Add(h[8], carry1);
+			carry0 = TLanes::template ShiftRight<26>(h[4]); h[4] = TLanes::And(h[4], mask26); h[5] = TLanes::Add(h[5], carry0);
+			carry1 = TLanes::template ShiftRight<26>(h[8]); h[8] = TLanes::And(h[8], mask26); h[9] = TLanes::Add(h[9], carry1);
+			carry1 = TLanes::template ShiftRight<25>(h[9]); h[9] = TLanes::And(h[9], mask25);
+
+			// carry can exceed 32 bits, so multiply by 19 = 16 + 2 + 1 with shifts
+			auto carry19 = TLanes::Add(
+					TLanes::Add(TLanes::template ShiftLeft<4>(carry1), TLanes::template ShiftLeft<1>(carry1)),
+					carry1);
+			h[0] = TLanes::Add(h[0], carry19);
+			carry0 = TLanes::template ShiftRight<26>(h[0]); h[0] = TLanes::And(h[0], mask26); h[1] = TLanes::Add(h[1], carry0);
+
+			for (auto j = 0u; j < Num_Limbs; ++j)
+				out.Limbs[j] = h[j];
+		}
+
+		static void Add(FieldElement& out, const FieldElement& a, const FieldElement& b) {
+			Vector h[Num_Limbs];
+			for (auto j = 0u; j < Num_Limbs; ++j)
+				h[j] = TLanes::Add(a.Limbs[j], b.Limbs[j]);
+
+			Carry(out, h);
+		}
+
+		static void Sub(FieldElement& out, const FieldElement& a, const FieldElement& b) {
+			// add 4 * p in order to keep all limbs positive
+			auto fourP0 = TLanes::Broadcast(0x0FFFFFB4);
+			auto fourPEven = TLanes::Broadcast(0x0FFFFFFC);
+			auto fourPOdd = TLanes::Broadcast(0x07FFFFFC);
+
+			Vector h[Num_Limbs];
+			for (auto j = 0u; j < Num_Limbs; ++j) {
+				const auto& fourP = 0 == j ? fourP0 : 0 == j % 2 ? fourPEven : fourPOdd;
+				h[j] = TLanes::Sub(TLanes::Add(a.Limbs[j], fourP), b.Limbs[j]);
+			}
+
+			Carry(out, h);
+		}
+
+		static void Mul(FieldElement& out, const FieldElement& a, const FieldElement& b) {
+			auto nineteen = TLanes::Broadcast(19);
+
+			// products of two odd limbs are doubled, products that wrap around 2^255 are multiplied by 19
+			// precompute doubled odd limbs of a and 19 multiples of b
+			auto a1_2 = TLanes::Add(a.Limbs[1], a.Limbs[1]);
+			auto a3_2 = TLanes::Add(a.Limbs[3], a.Limbs[3]);
+			auto a5_2 = TLanes::Add(a.Limbs[5], a.Limbs[5]);
+			auto a7_2 = TLanes::Add(a.Limbs[7], a.Limbs[7]);
+			auto a9_2 = TLanes::Add(a.Limbs[9], a.Limbs[9]);
+			auto b1_19 = TLanes::Mul(b.Limbs[1], nineteen);
+			auto b2_19 = TLanes::Mul(b.Limbs[2], nineteen);
+			auto b3_19 = TLanes::Mul(b.Limbs[3], nineteen);
+			auto b4_19 = TLanes::Mul(b.Limbs[4], nineteen);
+			auto b5_19 = TLanes::Mul(b.Limbs[5], nineteen);
+			auto b6_19 = TLanes::Mul(b.Limbs[6], nineteen);
+			auto b7_19 = TLanes::Mul(b.Limbs[7], nineteen);
+			auto b8_19 = TLanes::Mul(b.Limbs[8], nineteen);
+			auto b9_19 = TLanes::Mul(b.Limbs[9], nineteen);
+
+			Vector h[Num_Limbs];
+			h[0] = TLanes::Mul(a.Limbs[0], b.Limbs[0]);
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a1_2, b9_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a.Limbs[2], b8_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a3_2, b7_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a.Limbs[4], b6_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a5_2, b5_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a.Limbs[6], b4_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a7_2, b3_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a.Limbs[8], b2_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a9_2, b1_19));
+			h[1] = TLanes::Mul(a.Limbs[0], b.Limbs[1]);
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a.Limbs[1], b.Limbs[0]));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a.Limbs[2], b9_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a.Limbs[3], b8_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a.Limbs[4], b7_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a.Limbs[5], b6_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a.Limbs[6], b5_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a.Limbs[7], b4_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a.Limbs[8], b3_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a.Limbs[9], b2_19));
+			h[2] = TLanes::Mul(a.Limbs[0], b.Limbs[2]);
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a1_2, b.Limbs[1]));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a.Limbs[2], b.Limbs[0]));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a3_2, b9_19));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a.Limbs[4], b8_19));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a5_2, b7_19));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a.Limbs[6], b6_19));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a7_2, b5_19));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a.Limbs[8], b4_19));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a9_2, b3_19));
+			h[3] = TLanes::Mul(a.Limbs[0], b.Limbs[3]);
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a.Limbs[1], b.Limbs[2]));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a.Limbs[2], b.Limbs[1]));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a.Limbs[3], b.Limbs[0]));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a.Limbs[4], b9_19));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a.Limbs[5], b8_19));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a.Limbs[6], b7_19));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a.Limbs[7], b6_19));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a.Limbs[8], b5_19));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a.Limbs[9], b4_19));
+			h[4] = TLanes::Mul(a.Limbs[0], b.Limbs[4]);
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a1_2, b.Limbs[3]));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a.Limbs[2], b.Limbs[2]));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a3_2, b.Limbs[1]));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a.Limbs[4], b.Limbs[0]));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a5_2, b9_19));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a.Limbs[6], b8_19));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a7_2, b7_19));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a.Limbs[8], b6_19));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a9_2, b5_19));
+			h[5] = TLanes::Mul(a.Limbs[0], b.Limbs[5]);
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a.Limbs[1], b.Limbs[4]));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a.Limbs[2], b.Limbs[3]));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a.Limbs[3], b.Limbs[2]));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a.Limbs[4], b.Limbs[1]));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a.Limbs[5], b.Limbs[0]));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a.Limbs[6], b9_19));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a.Limbs[7], b8_19));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a.Limbs[8], b7_19));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a.Limbs[9], b6_19));
+			h[6] = TLanes::Mul(a.Limbs[0], b.Limbs[6]);
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a1_2, b.Limbs[5]));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a.Limbs[2], b.Limbs[4]));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a3_2, b.Limbs[3]));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a.Limbs[4], b.Limbs[2]));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a5_2, b.Limbs[1]));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a.Limbs[6], b.Limbs[0]));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a7_2, b9_19));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a.Limbs[8], b8_19));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a9_2, b7_19));
+			h[7] = TLanes::Mul(a.Limbs[0], b.Limbs[7]);
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a.Limbs[1], b.Limbs[6]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a.Limbs[2], b.Limbs[5]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a.Limbs[3], b.Limbs[4]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a.Limbs[4], b.Limbs[3]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a.Limbs[5], b.Limbs[2]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a.Limbs[6], b.Limbs[1]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a.Limbs[7], b.Limbs[0]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a.Limbs[8], b9_19));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a.Limbs[9], b8_19));
+			h[8] = TLanes::Mul(a.Limbs[0], b.Limbs[8]);
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a1_2, b.Limbs[7]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a.Limbs[2], b.Limbs[6]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a3_2, b.Limbs[5]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a.Limbs[4], b.Limbs[4]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a5_2, b.Limbs[3]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a.Limbs[6], b.Limbs[2]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a7_2, b.Limbs[1]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a.Limbs[8], b.Limbs[0]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a9_2, b9_19));
+			h[9] = TLanes::Mul(a.Limbs[0], b.Limbs[9]);
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a.Limbs[1], b.Limbs[8]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a.Limbs[2], b.Limbs[7]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a.Limbs[3], b.Limbs[6]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a.Limbs[4], b.Limbs[5]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a.Limbs[5], b.Limbs[4]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a.Limbs[6], b.Limbs[3]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a.Limbs[7], b.Limbs[2]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a.Limbs[8], b.Limbs[1]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a.Limbs[9], b.Limbs[0]));
+
+			Carry(out, h);
+		}
+
+		static void Square(FieldElement& out, const FieldElement& a) {
+			auto nineteen = TLanes::Broadcast(19);
+			auto thirtyEight = TLanes::Broadcast(38);
+
+			// cross products are doubled in addition to the multiplication rules
+			// precompute doubled limbs and small multiples of a
+			auto a0_2 = TLanes::Add(a.Limbs[0], a.Limbs[0]);
+			auto a1_2 = TLanes::Add(a.Limbs[1], a.Limbs[1]);
+			auto a2_2 = TLanes::Add(a.Limbs[2], a.Limbs[2]);
+			auto a3_2 = TLanes::Add(a.Limbs[3], a.Limbs[3]);
+			auto a4_2 = TLanes::Add(a.Limbs[4], a.Limbs[4]);
+			auto a5_2 = TLanes::Add(a.Limbs[5], a.Limbs[5]);
+			auto a6_2 = TLanes::Add(a.Limbs[6], a.Limbs[6]);
+			auto a7_2 = TLanes::Add(a.Limbs[7], a.Limbs[7]);
+			auto a8_2 = TLanes::Add(a.Limbs[8], a.Limbs[8]);
+			auto a5_38 = TLanes::Mul(a.Limbs[5], thirtyEight);
+			auto a6_19 = TLanes::Mul(a.Limbs[6], nineteen);
+			auto a7_19 = TLanes::Mul(a.Limbs[7], nineteen);
+			auto a7_38 = TLanes::Mul(a.Limbs[7], thirtyEight);
+			auto a8_19 = TLanes::Mul(a.Limbs[8], nineteen);
+			auto a9_19 = TLanes::Mul(a.Limbs[9], nineteen);
+			auto a9_38 = TLanes::Mul(a.Limbs[9], thirtyEight);
+
+			Vector h[Num_Limbs];
+			h[0] = TLanes::Mul(a.Limbs[0], a.Limbs[0]);
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a1_2, a9_38));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a2_2, a8_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a3_2, a7_38));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a4_2, a6_19));
+			h[0] = TLanes::Add(h[0], TLanes::Mul(a.Limbs[5], a5_38));
+			h[1] = TLanes::Mul(a0_2, a.Limbs[1]);
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a2_2, a9_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a3_2, a8_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a4_2, a7_19));
+			h[1] = TLanes::Add(h[1], TLanes::Mul(a5_2, a6_19));
+			h[2] = TLanes::Mul(a0_2, a.Limbs[2]);
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a.Limbs[1], a1_2));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a3_2, a9_38));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a4_2, a8_19));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a5_2, a7_38));
+			h[2] = TLanes::Add(h[2], TLanes::Mul(a.Limbs[6], a6_19));
+			h[3] = TLanes::Mul(a0_2, a.Limbs[3]);
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a1_2, a.Limbs[2]));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a4_2, a9_19));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a5_2, a8_19));
+			h[3] = TLanes::Add(h[3], TLanes::Mul(a6_2, a7_19));
+			h[4] = TLanes::Mul(a0_2, a.Limbs[4]);
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a1_2, a3_2));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a.Limbs[2], a.Limbs[2]));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a5_2, a9_38));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a6_2, a8_19));
+			h[4] = TLanes::Add(h[4], TLanes::Mul(a.Limbs[7], a7_38));
+			h[5] = TLanes::Mul(a0_2, a.Limbs[5]);
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a1_2, a.Limbs[4]));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a2_2, a.Limbs[3]));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a6_2, a9_19));
+			h[5] = TLanes::Add(h[5], TLanes::Mul(a7_2, a8_19));
+			h[6] = TLanes::Mul(a0_2, a.Limbs[6]);
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a1_2, a5_2));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a2_2, a.Limbs[4]));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a.Limbs[3], a3_2));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a7_2, a9_38));
+			h[6] = TLanes::Add(h[6], TLanes::Mul(a.Limbs[8], a8_19));
+			h[7] = TLanes::Mul(a0_2, a.Limbs[7]);
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a1_2, a.Limbs[6]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a2_2, a.Limbs[5]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a3_2, a.Limbs[4]));
+			h[7] = TLanes::Add(h[7], TLanes::Mul(a8_2, a9_19));
+			h[8] = TLanes::Mul(a0_2, a.Limbs[8]);
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a1_2, a7_2));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a2_2, a.Limbs[6]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a3_2, a5_2));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a.Limbs[4], a.Limbs[4]));
+			h[8] = TLanes::Add(h[8], TLanes::Mul(a.Limbs[9], a9_38));
+			h[9] = TLanes::Mul(a0_2, a.Limbs[9]);
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a1_2, a.Limbs[8]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a2_2, a.Limbs[7]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a3_2, a.Limbs[6]));
+			h[9] = TLanes::Add(h[9], TLanes::Mul(a4_2, a.Limbs[5]));
+
+			Carry(out, h);
+		}
+
+		// endregion
+
+		// region group arithmetic (ported from ed25519-donna-impl-base)
+
+		static void SetNeutral(ExtendedPoint& point) {
+			static const uint64_t Zero[Num_Limbs] = {};
+			static const uint64_t One[Num_Limbs] = { 1 };
+			SetConstant(point.X, Zero);
+			SetConstant(point.Y, One);
+			SetConstant(point.Z, One);
+			SetConstant(point.T, Zero);
+		}
+
+		static void ToPartial(ExtendedPoint& r, const CompletedPoint& p) {
+			Mul(r.X, p.X, p.T);
+			Mul(r.Y, p.Y, p.Z);
+			Mul(r.Z, p.Z, p.T);
+		}
+
+		static void ToFull(ExtendedPoint& r, const CompletedPoint& p) {
+			ToPartial(r, p);
+			Mul(r.T, p.X, p.Y);
+		}
+
+		static void ToPniels(PnielsPoint& r, const ExtendedPoint& p, const FieldElement& ec2d) {
+			Sub(r.YSubX, p.Y, p.X);
+			Add(r.XAddY, p.Y, p.X);
+			r.Z = p.Z;
+			Mul(r.T2d, p.T, ec2d);
+		}
+
+		static void Double(CompletedPoint& r, const ExtendedPoint& p) {
+			FieldElement a, b, c;
+			Square(a, p.X);
+			Square(b, p.Y);
+			Square(c, p.Z);
+			Add(c, c, c);
+			Add(r.X, p.X, p.Y);
+			Square(r.X, r.X);
+			Add(r.Y, b, a);
+			Sub(r.Z, b, a);
+			Sub(r.X, r.X, r.Y);
+			Sub(r.T, c, r.Z);
+		}
+
+		static void PnielsAdd(CompletedPoint& r, const ExtendedPoint& p, const PnielsPoint& q, bool isNegative) {
+			FieldElement a, b, c;
+			Sub(a, p.Y, p.X);
+			Add(b, p.Y, p.X);
+			Mul(a, a, isNegative ? q.XAddY : q.YSubX);
+			Mul(r.X, b, isNegative ? q.YSubX : q.XAddY);
+			Add(r.Y, r.X, a);
+			Sub(r.X, r.X, a);
+			Mul(c, p.T, q.T2d);
+			Mul(r.T, p.Z, q.Z);
+			Add(r.T, r.T, r.T);
+			r.Z = r.T;
+			if (isNegative) {
+				Add(r.T, r.T, c);
+				Sub(r.Z, r.Z, c);
+			} else {
+				Add(r.Z, r.Z, c);
+				Sub(r.T, r.T, c);
+			}
+		}
+
+		static void PnielsAdd(PnielsPoint& r, const ExtendedPoint& p, const PnielsPoint& q, const FieldElement& ec2d) {
+			CompletedPoint sum;
+			PnielsAdd(sum, p, q, false);
+
+			ExtendedPoint point;
+			ToFull(point, sum);
+			ToPniels(r, point, ec2d);
+		}
+
+		// endregion
+
+		// region scalar multiplication
+
+		// table = { A, 2 * A, 3 * A, 4 * A, 5 * A, 6 * A, 7 * A, 8 * A }
+		static void PrecomputeTable(PnielsPoint (&table)[8], const ExtendedPoint& point, const FieldElement& ec2d) {
+			CompletedPoint completed;
+			ExtendedPoint point2, point4, point8;
+
+			ToPniels(table[0], point, ec2d);
+
+			Double(completed, point);
+			ToFull(point2, completed);
+			ToPniels(table[1], point2, ec2d);
+
+			PnielsAdd(table[2], point, table[1], ec2d);
+
+			Double(completed, point2);
+			ToFull(point4, completed);
+			ToPniels(table[3], point4, ec2d);
+
+			PnielsAdd(table[4], point, table[3], ec2d);
+			PnielsAdd(table[5], point, table[4], ec2d);
+			PnielsAdd(table[6], point, table[5], ec2d);
+
+			Double(completed, point4);
+			ToFull(point8, completed);
+			ToPniels(table[7], point8, ec2d);
+		}
+
+		// result = q * point, where q is the group order
+		static void ScalarMultGroupOrder(ExtendedPoint& result, const ExtendedPoint& point) {
+			// 2 * d
+			static const uint64_t Ec2d_Limbs[Num_Limbs] = {
+				0x2B2F159, 0x1A6E509, 0x22ADD7A, 0x0D4141D, 0x0038052, 0x0F3D130, 0x3407977, 0x19CE331, 0x1C56DFF, 0x0901B67
+			};
+
+			// group order q represented by radix 16
+			static const int8_t Group_Order_Digits[64] = {
+				-3, -1, 4, -3, 6, -1, -3, 6, -6, 2, 3, 6, 2, 1, -8, 6,
+				6, -3, -3, -6, -8, 0, 3, -6, -1, -2, -6, 0, -1, -2, 5, 1,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1
+			};
+
+			FieldElement ec2d;
+			SetConstant(ec2d, Ec2d_Limbs);
+
+			PnielsPoint table[8];
+			PrecomputeTable(table, point, ec2d);
+
+			// digits are the same for all lanes, so there is no need for constant time table lookups
+			CompletedPoint completed;
+			SetNeutral(result);
+			for (auto i = 63; 0 <= i; --i) {
+				auto digit = Group_Order_Digits[i];
+				if (0 != digit) {
+					auto isNegative = digit < 0;
+					PnielsAdd(completed, result, table[(isNegative ? -digit : digit) - 1], isNegative);
+					ToFull(result, completed);
+				}
+
+				if (0 != i) {
+					// only last doubling needs to calculate t, which is required by addition
+					for (auto j = 0u; j < 3; ++j) {
+						Double(completed, result);
+						ToPartial(result, completed);
+					}
+
+					Double(completed, result);
+					ToFull(result, completed);
+				}
+			}
+		}
+
+		// endregion
+	};
+}}}
@@ -0,0 +1,94 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiLaneCurveKernels.h"
+
+// this file is compiled with avx2 enabled (see CMakeLists.txt)
+#ifdef __AVX2__
+#include "MultiLaneCurve25519.h"
+#include <immintrin.h>
+
+namespace catapult { namespace crypto { namespace detail {
+
+	namespace {
+		struct Avx2Lanes {
+			using Vector = __m256i;
+
+			static constexpr size_t Count = 4;
+
+			static Vector Broadcast(uint64_t value) {
+				return _mm256_set1_epi64x(static_cast<long long>(value));
+			}
+
+			static Vector Load(const uint64_t* pValues) {
+				return _mm256_load_si256(reinterpret_cast<const __m256i*>(pValues));
+			}
+
+			static void Store(uint64_t* pValues, Vector vector) {
+				_mm256_store_si256(reinterpret_cast<__m256i*>(pValues), vector);
+			}
+
+			static Vector Add(Vector lhs, Vector rhs) {
+				return _mm256_add_epi64(lhs, rhs);
+			}
+
+			static Vector Sub(Vector lhs, Vector rhs) {
+				return _mm256_sub_epi64(lhs, rhs);
+			}
+
+			static Vector And(Vector lhs, Vector rhs) {
+				return _mm256_and_si256(lhs, rhs);
+			}
+
+			static Vector Mul(Vector lhs, Vector rhs) {
+				return _mm256_mul_epu32(lhs, rhs);
+			}
+
+			template<int Shift>
+			static Vector ShiftLeft(Vector vector) {
+				return _mm256_slli_epi64(vector, Shift);
+			}
+
+			template<int Shift>
+			static Vector ShiftRight(Vector vector) {
+				return _mm256_srli_epi64(vector, Shift);
+			}
+		};
+	}
+
+	bool IsAvx2KernelAvailable() {
+		return true;
+	}
+
+	void CheckMainSubgroupAvx2(const EncodedExtendedPoint* pPoints, size_t count, bool* pResults) {
+		MultiLaneCurve25519<Avx2Lanes>::CheckMainSubgroup(pPoints, count, pResults);
+	}
+}}}
+#else
+namespace catapult { namespace crypto { namespace detail {
+
+	bool IsAvx2KernelAvailable() {
+		return false;
+	}
+
+	void CheckMainSubgroupAvx2(const EncodedExtendedPoint*, size_t, bool*) {
+	}
+}}}
+#endif
@@ -0,0 +1,99 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiLaneCurveKernels.h"
+
+// this file is compiled with avx512 enabled (see CMakeLists.txt)
+#ifdef __AVX512F__
+#include "MultiLaneCurve25519.h"
+#include <immintrin.h>
+
+#if defined(__GNUC__) && !defined(__clang__)
+// gcc reports false positives for the self-initialized undefined vectors used by avx512 shift intrinsics
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+
+namespace catapult { namespace crypto { namespace detail {
+
+	namespace {
+		struct Avx512Lanes {
+			using Vector = __m512i;
+
+			static constexpr size_t Count = 8;
+
+			static Vector Broadcast(uint64_t value) {
+				return _mm512_set1_epi64(static_cast<long long>(value));
+			}
+
+			static Vector Load(const uint64_t* pValues) {
+				return _mm512_load_si512(pValues);
+			}
+
+			static void Store(uint64_t* pValues, Vector vector) {
+				_mm512_store_si512(pValues, vector);
+			}
+
+			static Vector Add(Vector lhs, Vector rhs) {
+				return _mm512_add_epi64(lhs, rhs);
+			}
+
+			static Vector Sub(Vector lhs, Vector rhs) {
+				return _mm512_sub_epi64(lhs, rhs);
+			}
+
+			static Vector And(Vector lhs, Vector rhs) {
+				return _mm512_and_si512(lhs, rhs);
+			}
+
+			static Vector Mul(Vector lhs, Vector rhs) {
+				return _mm512_mul_epu32(lhs, rhs);
+			}
+
+			template<int Shift>
+			static Vector ShiftLeft(Vector vector) {
+				return _mm512_slli_epi64(vector, Shift);
+			}
+
+			template<int Shift>
+			static Vector ShiftRight(Vector vector) {
+				return _mm512_srli_epi64(vector, Shift);
+			}
+		};
+	}
+
+	bool IsAvx512KernelAvailable() {
+		return true;
+	}
+
+	void CheckMainSubgroupAvx512(const EncodedExtendedPoint* pPoints, size_t count, bool* pResults) {
+		MultiLaneCurve25519<Avx512Lanes>::CheckMainSubgroup(pPoints, count, pResults);
+	}
+}}}
+#else
+namespace catapult { namespace crypto { namespace detail {
+
+	bool IsAvx512KernelAvailable() {
+		return false;
+	}
+
+	void CheckMainSubgroupAvx512(const EncodedExtendedPoint*, size_t, bool*) {
+	}
+}}}
+#endif
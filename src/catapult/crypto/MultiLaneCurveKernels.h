@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace crypto { namespace detail {
+
+	// this header is included by translation units compiled with extended instruction sets,
+	// so it must not contain any inline functions that could be shared with other translation units
+
+	/// Curve point in extended coordinates with canonically encoded coordinates.
+	struct EncodedExtendedPoint {
+		/// Encoded x coordinate.
+		uint8_t X[32];
+
+		/// Encoded y coordinate.
+		uint8_t Y[32];
+
+		/// Encoded z coordinate.
+		uint8_t Z[32];
+
+		/// Encoded t coordinate.
+		uint8_t T[32];
+	};
+
+	/// Returns \c true if the avx2 kernels are compiled in.
+	bool IsAvx2KernelAvailable();
+
+	/// Checks whether each of the \a count points pointed to by \a pPoints is in the main subgroup
+	/// using 4-way avx2 field arithmetic and stores the results in \a pResults.
+	void CheckMainSubgroupAvx2(const EncodedExtendedPoint* pPoints, size_t count, bool* pResults);
+
+	/// Returns \c true if the avx512 kernels are compiled in.
+	bool IsAvx512KernelAvailable();
+
+	/// Checks whether each of the \a count points pointed to by \a pPoints is in the main subgroup
+	/// using 8-way avx512 field arithmetic and stores the results in \a pResults.
+	void CheckMainSubgroupAvx512(const EncodedExtendedPoint* pPoints, size_t count, bool* pResults);
+}}}
@@ -0,0 +1,114 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "MultiLaneKeccakKernels.h"
+#include <utility>
+
+namespace catapult { namespace crypto { namespace detail {
+
+	// TLanes must provide:
+	// - Vector type and Count (number of lanes)
+	// - Broadcast, Load, Store
+	// - Xor, Xor3 (three-way xor), XorAndNot (a ^ (~b & c))
+	// - RotateLeft<N>
+	//
+	// all functions are static members of a class template instantiated with a lane type that is local to a single
+	// translation unit, so no code compiled with extended instruction sets can leak into other translation units
+
+	/// Multi-lane keccak-f[1600] permutation that processes TLanes::Count independent states at once.
+	template<typename TLanes>
+	class MultiLaneKeccak {
+	private:
+		using Vector = typename TLanes::Vector;
+
+		static constexpr size_t Num_Lanes = TLanes::Count;
+		static constexpr size_t Num_Rounds = 24;
+
+		static constexpr uint64_t Round_Constants[Num_Rounds] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		// rotation offsets indexed by x + 5 * y
+		static constexpr int Rho_Offsets[Keccak_State_Words] = {
+			0, 1, 62, 28, 27,
+			36, 44, 6, 55, 20,
+			3, 10, 43, 25, 39,
+			41, 45, 15, 21, 8,
+			18, 2, 61, 56, 14
+		};
+
+		// pi moves the word at (x, y) to (y, 2x + 3y)
+		static constexpr size_t PiDestination(size_t index) {
+			return (index / 5) + 5 * ((2 * (index % 5) + 3 * (index / 5)) % 5);
+		}
+
+	public:
+		/// Applies the permutation to the interleaved states pointed to by \a pStates.
+		static void Permute(uint64_t* pStates) {
+			Vector state[Keccak_State_Words];
+			for (auto i = 0u; i < Keccak_State_Words; ++i)
+				state[i] = TLanes::Load(pStates + i * Num_Lanes);
+
+			for (auto round = 0u; round < Num_Rounds; ++round)
+				Round(state, Round_Constants[round]);
+
+			for (auto i = 0u; i < Keccak_State_Words; ++i)
+				TLanes::Store(pStates + i * Num_Lanes, state[i]);
+		}
+
+	private:
+		static void Round(Vector* state, uint64_t roundConstant) {
+			// theta
+			Vector columns[5];
+			for (auto x = 0u; x < 5; ++x)
+				columns[x] = TLanes::Xor(TLanes::Xor3(state[x], state[x + 5], state[x + 10]), TLanes::Xor(state[x + 15], state[x + 20]));
+
+			for (auto x = 0u; x < 5; ++x) {
+				auto delta = TLanes::Xor(columns[(x + 4) % 5], TLanes::template RotateLeft<1>(columns[(x + 1) % 5]));
+				for (auto y = 0u; y < 25; y += 5)
+					state[x + y] = TLanes::Xor(state[x + y], delta);
+			}
+
+			// rho and pi
+			Vector permuted[Keccak_State_Words];
+			RhoPi(state, permuted, std::make_index_sequence<Keccak_State_Words>());
+
+			// chi
+			for (auto y = 0u; y < 25; y += 5) {
+				for (auto x = 0u; x < 5; ++x)
+					state[x + y] = TLanes::XorAndNot(permuted[x + y], permuted[(x + 1) % 5 + y], permuted[(x + 2) % 5 + y]);
+			}
+
+			// iota
+			state[0] = TLanes::Xor(state[0], TLanes::Broadcast(roundConstant));
+		}
+
+		template<size_t... Indexes>
+		static void RhoPi(const Vector* state, Vector* permuted, std::index_sequence<Indexes...>) {
+			((permuted[PiDestination(Indexes)] = TLanes::template RotateLeft<Rho_Offsets[Indexes]>(state[Indexes])), ...);
+		}
+	};
+}}}
@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiLaneKeccakKernels.h"
+
+// this file is compiled with avx2 enabled (see CMakeLists.txt)
+#ifdef __AVX2__
+#include "MultiLaneKeccak.h"
+#include <immintrin.h>
+
+namespace catapult { namespace crypto { namespace detail {
+
+	namespace {
+		struct Avx2Lanes {
+			using Vector = __m256i;
+
+			static constexpr size_t Count = 4;
+
+			static Vector Broadcast(uint64_t value) {
+				return _mm256_set1_epi64x(static_cast<long long>(value));
+			}
+
+			static Vector Load(const uint64_t* pValues) {
+				return _mm256_load_si256(reinterpret_cast<const __m256i*>(pValues));
+			}
+
+			static void Store(uint64_t* pValues, Vector vector) {
+				_mm256_store_si256(reinterpret_cast<__m256i*>(pValues), vector);
+			}
+
+			static Vector Xor(Vector lhs, Vector rhs) {
+				return _mm256_xor_si256(lhs, rhs);
+			}
+
+			static Vector Xor3(Vector a, Vector b, Vector c) {
+				return _mm256_xor_si256(_mm256_xor_si256(a, b), c);
+			}
+
+			static Vector XorAndNot(Vector a, Vector b, Vector c) {
+				return _mm256_xor_si256(a, _mm256_andnot_si256(b, c));
+			}
+
+			template<int Shift>
+			static Vector RotateLeft(Vector vector) {
+				if constexpr (0 == Shift)
+					return vector;
+				else
+					return _mm256_or_si256(_mm256_slli_epi64(vector, Shift), _mm256_srli_epi64(vector, 64 - Shift));
+			}
+		};
+	}
+
+	bool IsKeccakAvx2KernelAvailable() {
+		return true;
+	}
+
+	void KeccakF1600Avx2(uint64_t* pStates) {
+		MultiLaneKeccak<Avx2Lanes>::Permute(pStates);
+	}
+}}}
+#else
+namespace catapult { namespace crypto { namespace detail {
+
+	bool IsKeccakAvx2KernelAvailable() {
+		return false;
+	}
+
+	void KeccakF1600Avx2(uint64_t*) {
+	}
+}}}
+#endif
@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiLaneKeccakKernels.h"
+
+// this file is compiled with avx512 enabled (see CMakeLists.txt)
+#ifdef __AVX512F__
+#include "MultiLaneKeccak.h"
+#include <immintrin.h>
+
+#if defined(__GNUC__) && !defined(__clang__)
+// gcc reports false positives for the self-initialized undefined vectors used by avx512 rotate intrinsics
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+
+namespace catapult { namespace crypto { namespace detail {
+
+	namespace {
+		struct Avx512Lanes {
+			using Vector = __m512i;
+
+			static constexpr size_t Count = 8;
+
+			static Vector Broadcast(uint64_t value) {
+				return _mm512_set1_epi64(static_cast<long long>(value));
+			}
+
+			static Vector Load(const uint64_t* pValues) {
+				return _mm512_load_si512(pValues);
+			}
+
+			static void Store(uint64_t* pValues, Vector vector) {
+				_mm512_store_si512(pValues, vector);
+			}
+
+			static Vector Xor(Vector lhs, Vector rhs) {
+				return _mm512_xor_si512(lhs, rhs);
+			}
+
+			static Vector Xor3(Vector a, Vector b, Vector c) {
+				// truth table of a ^ b ^ c
+				return _mm512_ternarylogic_epi64(a, b, c, 0x96);
+			}
+
+			static Vector XorAndNot(Vector a, Vector b, Vector c) {
+				// truth table of a ^ (~b & c)
+				return _mm512_ternarylogic_epi64(a, b, c, 0xD2);
+			}
+
+			template<int Shift>
+			static Vector RotateLeft(Vector vector) {
+				if constexpr (0 == Shift)
+					return vector;
+				else
+					return _mm512_rol_epi64(vector, Shift);
+			}
+		};
+	}
+
+	bool IsKeccakAvx512KernelAvailable() {
+		return true;
+	}
+
+	void KeccakF1600Avx512(uint64_t* pStates) {
+		MultiLaneKeccak<Avx512Lanes>::Permute(pStates);
+	}
+}}}
+#else
+namespace catapult { namespace crypto { namespace detail {
+
+	bool IsKeccakAvx512KernelAvailable() {
+		return false;
+	}
+
+	void KeccakF1600Avx512(uint64_t*) {
+	}
+}}}
+#endif
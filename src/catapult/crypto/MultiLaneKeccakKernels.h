@@ -0,0 +1,46 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace crypto { namespace detail {
+
+	// this header is included by translation units compiled with extended instruction sets,
+	// so it must not contain any inline functions that could be shared with other translation units
+
+	/// Number of 64-bit words in a keccak-f[1600] state.
+	constexpr size_t Keccak_State_Words = 25;
+
+	/// Returns \c true if the avx2 keccak kernel is compiled in.
+	bool IsKeccakAvx2KernelAvailable();
+
+	/// Applies the keccak-f[1600] permutation to four interleaved states pointed to by \a pStates using avx2.
+	/// \note Word \c w of lane \c l is stored at <tt>pStates[w * 4 + l]</tt> and \a pStates must be 32-byte aligned.
+	void KeccakF1600Avx2(uint64_t* pStates);
+
+	/// Returns \c true if the avx512 keccak kernel is compiled in.
+	bool IsKeccakAvx512KernelAvailable();
+
+	/// Applies the keccak-f[1600] permutation to eight interleaved states pointed to by \a pStates using avx512.
+	/// \note Word \c w of lane \c l is stored at <tt>pStates[w * 8 + l]</tt> and \a pStates must be 64-byte aligned.
+	void KeccakF1600Avx512(uint64_t* pStates);
+}}}
@@ -20,10 +20,14 @@
 
 #include "Signer.h"
 #include "CryptoUtils.h"
+#include "CurveBackend.h"
 #include "Hashes.h"
 #include "SecureZero.h"
 #include "catapult/exceptions.h"
+#include <algorithm>
 #include <cstring>
+#include <limits>
+#include <memory>
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -172,50 +176,57 @@ namespace catapult { namespace crypto {
 
 	// region Verify
 
+	namespace {
+		template<typename TBuffers>
+		bool VerifyBuffers(const Key& publicKey, const TBuffers& buffers, const Signature& signature) {
+			const uint8_t *RESTRICT encodedR = signature.data();
+			const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
+
+			// reject if not canonical
+			if (!IsCanonicalS(encodedS))
+				return false;
+
+			// reject zero public key, which is known weak key
+			if (Key() == publicKey)
+				return false;
+
+			// h = H(encodedR || public || data)
+			Hash512 hash_h;
+			Sha512_Builder hasher_h;
+			hasher_h.update({ { encodedR, Encoded_Size }, publicKey });
+			for (const auto& buffer : buffers)
+				hasher_h.update(buffer);
+
+			hasher_h.final(hash_h);
+
+			bignum256modm h;
+			expand256_modm(h, hash_h.data(), 64);
+
+			// A = -pub
+			ge25519 ALIGN(16) A;
+			if (!UnpackNegativeAndCheckSubgroup(A, publicKey))
+				return false;
+
+			bignum256modm S;
+			expand256_modm(S, encodedS, 32);
+
+			// R = encodedS * B - h * A
+			ge25519 ALIGN(16) R;
+			ge25519_double_scalarmult_vartime(&R, &A, h, S);
+
+			// compare calculated R to given R
+			uint8_t checkr[Encoded_Size];
+			ge25519_pack(checkr, &R);
+			return 1 == ed25519_verify(encodedR, checkr, 32);
+		}
+	}
+
 	bool Verify(const Key& publicKey, const RawBuffer& dataBuffer, const Signature& signature) {
-		return Verify(publicKey, std::vector<RawBuffer>{ dataBuffer }, signature);
+		return VerifyBuffers(publicKey, SignatureInputBuffers{ dataBuffer }, signature);
 	}
 
 	bool Verify(const Key& publicKey, const std::vector<RawBuffer>& buffers, const Signature& signature) {
-		const uint8_t *RESTRICT encodedR = signature.data();
-		const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
-
-		// reject if not canonical
-		if (!IsCanonicalS(encodedS))
-			return false;
-
-		// reject zero public key, which is known weak key
-		if (Key() == publicKey)
-			return false;
-
-		// h = H(encodedR || public || data)
-		Hash512 hash_h;
-		Sha512_Builder hasher_h;
-		hasher_h.update({ { encodedR, Encoded_Size }, publicKey });
-		for (const auto& buffer : buffers)
-			hasher_h.update(buffer);
-
-		hasher_h.final(hash_h);
-
-		bignum256modm h;
-		expand256_modm(h, hash_h.data(), 64);
-
-		// A = -pub
-		ge25519 ALIGN(16) A;
-		if (!UnpackNegativeAndCheckSubgroup(A, publicKey))
-			return false;
-
-		bignum256modm S;
-		expand256_modm(S, encodedS, 32);
-
-		// R = encodedS * B - h * A
-		ge25519 ALIGN(16) R;
-		ge25519_double_scalarmult_vartime(&R, &A, h, S);
-
-		// compare calculated R to given R
-		uint8_t checkr[Encoded_Size];
-		ge25519_pack(checkr, &R);
-		return 1 == ed25519_verify(encodedR, checkr, 32);
+		return VerifyBuffers(publicKey, buffers, signature);
 	}
 
 	// endregion
@@ -240,69 +251,289 @@ namespace catapult { namespace crypto {
 		bool VerifySingle(const SignatureInput* pSignatureInputs, size_t offset, size_t count, std::vector<bool>& valid) {
 			bool aggregateResult = true;
 			for (auto i = 0u; i < count; ++i) {
-				valid[offset + i] = Verify(pSignatureInputs[i].PublicKey, pSignatureInputs[i].Buffers, pSignatureInputs[i].Signature);
+				const auto& signatureInput = pSignatureInputs[offset + i];
+				valid[offset + i] = VerifyBuffers(signatureInput.PublicKey, signatureInput.Buffers, signatureInput.Signature);
 				aggregateResult &= valid[offset + i];
 			}
 
 			return aggregateResult;
 		}
 
-		bool VerifyBatches(
+		// region PrepareBatch
+
+		// prepares the multi scalar multiplication sum(scalars[i] * points[i]) that is neutral when all signatures are valid:
+		// - scalars[0] = sum(r[i] * S[i]), points[0] = B
+		// - scalars[1..batchSize] = r[i] * H(R[i], A[i], m[i]), points[1..batchSize] = -A[i]
+		// - scalars[batchSize+1..2*batchSize] = r[i], points[batchSize+1..2*batchSize] = -R[i]
+		bool PrepareBatch(
+				CurveBackend backend,
 				const RandomFiller& randomFiller,
 				const SignatureInput* pSignatureInputs,
-				size_t count,
-				std::pair<std::vector<bool>, bool>& result,
-				const predicate<size_t, size_t>& fallback) {
-			size_t offset = 0;
-			batch_heap ALIGN(16) batch;
-			ge25519 ALIGN(16) p;
-			bignum256modm* r_scalars;
-			size_t batchSize;
-			auto& aggregateResult = result.second;
+				size_t batchSize,
+				uint8_t* randomBytes,
+				bignum256modm* scalars,
+				ge25519* points,
+				bool* isInMainSubgroup) {
+			// generate r (scalars[batchSize+1]..scalars[2*batchSize]
+			// compute scalars[0] = ((r1s1 + r2s2 + ...))
+			randomFiller(randomBytes, batchSize * 16);
+			auto* r_scalars = &scalars[batchSize + 1];
+			for (auto i = 0u; i < batchSize; ++i) {
+				expand256_modm(r_scalars[i], randomBytes + i * 16, 16);
+				expand256_modm(scalars[i], pSignatureInputs[i].Signature.data() + 32, 32);
+				mul256_modm(scalars[i], scalars[i], r_scalars[i]);
+				if (0u < i)
+					add256_modm(scalars[0], scalars[0], scalars[i]);
+			}
 
-			// because batch verification has some overhead like computing scalars, it is only faster when verifying more than 3 signatures
-			while (count > 3) {
-				batchSize = (count > max_batch_size) ? max_batch_size : count;
-
-				// generate r (scalars[batchSize+1]..scalars[2*batchSize]
-				// compute scalars[0] = ((r1s1 + r2s2 + ...))
-				randomFiller(reinterpret_cast<uint8_t*>(batch.r), batchSize * 16);
-				r_scalars = &batch.scalars[batchSize + 1];
-				for (auto i = 0u; i < batchSize; ++i) {
-					expand256_modm(r_scalars[i], batch.r[i], 16);
-					expand256_modm(batch.scalars[i], pSignatureInputs[offset + i].Signature.data() + 32, 32);
-					mul256_modm(batch.scalars[i], batch.scalars[i], r_scalars[i]);
-					if (0u < i)
-						add256_modm(batch.scalars[0], batch.scalars[0], batch.scalars[i]);
+			// compute scalars[1]..scalars[batchSize] as r[i]*H(R[i],A[i],m[i])
+			for (auto i = 0u; i < batchSize; ++i) {
+				Hash512 hash_h;
+				Sha512_Builder hasher_h;
+				const auto& signatureInput = pSignatureInputs[i];
+				hasher_h.update({ { signatureInput.Signature.data(), Encoded_Size }, signatureInput.PublicKey });
+				for (const auto& buffer : signatureInput.Buffers)
+					hasher_h.update(buffer);
+
+				hasher_h.final(hash_h);
+
+				expand256_modm(scalars[i + 1], hash_h.data(), 64);
+				mul256_modm(scalars[i + 1], scalars[i + 1], r_scalars[i]);
+			}
+
+			// compute points
+			points[0] = ge25519_basepoint;
+			for (auto i = 0u; i < batchSize; ++i) {
+				const auto& signatureInput = pSignatureInputs[i];
+				auto R = signatureInput.Signature.copyTo<Key>();
+				if (!UnpackNegative(points[i + 1], signatureInput.PublicKey) || !UnpackNegative(points[batchSize + i + 1], R))
+					return false;
+			}
+
+			// check that all public keys and R parts (but not the base point) are in the main subgroup
+			// (this is the most expensive part of the batch preparation and is independent for every point)
+			CheckMainSubgroup(backend, &points[1], batchSize * 2, isInMainSubgroup);
+			return std::all_of(isInMainSubgroup, isInMainSubgroup + batchSize * 2, [](auto result) { return result; });
+		}
+
+		// endregion
+
+		// region Pippenger
+
+		// bucket (Pippenger) multi scalar multiplication is faster than Bos-Coster (donna) for large batches
+		// because its cost per point decreases with the number of points while the latter's cost per point stays constant
+		constexpr size_t Pippenger_Threshold = 128;
+
+		// limits the memory used by a single multi scalar multiplication
+		constexpr size_t Max_Pippenger_Batch_Size = 4096;
+
+		// all scalars are reduced (less than 2^253), so signed digits need to cover 254 bits
+		constexpr uint32_t Num_Scalar_Bits = 254;
+
+		uint32_t CalculateNumWindows(uint32_t windowBits) {
+			return (Num_Scalar_Bits + windowBits - 1) / windowBits;
+		}
+
+		uint32_t ChooseWindowBits(size_t batchSize) {
+			// estimate number of point additions: nonzero digits of (batchSize + 1) full scalars and batchSize 128-bit scalars
+			// plus two additions per bucket per window
+			auto bestWindowBits = 0u;
+			auto bestCost = std::numeric_limits<uint64_t>::max();
+			for (auto windowBits = 4u; windowBits <= 16; ++windowBits) {
+				auto numWindows = CalculateNumWindows(windowBits);
+				auto numShortWindows = (128 + 1 + windowBits - 1) / windowBits;
+				auto cost = numWindows * (batchSize + 1 + (1ull << windowBits)) + numShortWindows * batchSize;
+				if (cost < bestCost) {
+					bestCost = cost;
+					bestWindowBits = windowBits;
+				}
+			}
+
+			return bestWindowBits;
+		}
+
+		// converts \a scalar into \a numWindows signed digits in [-2^(windowBits-1), 2^(windowBits-1)]
+		void ToSignedDigits(int32_t* digits, const bignum256modm scalar, uint32_t windowBits, uint32_t numWindows) {
+			uint8_t buffer[Encoded_Size + sizeof(uint64_t)]{};
+			contract256_modm(buffer, scalar);
+
+			auto windowMask = (1u << windowBits) - 1;
+			auto halfWindow = static_cast<int32_t>(1u << (windowBits - 1));
+			auto carry = 0;
+			for (auto i = 0u; i < numWindows; ++i) {
+				auto bitOffset = i * windowBits;
+				uint64_t word;
+				std::memcpy(&word, buffer + bitOffset / 8, sizeof(uint64_t));
+
+				auto digit = static_cast<int32_t>((word >> (bitOffset % 8)) & windowMask) + carry;
+				carry = digit > halfWindow ? 1 : 0;
+				digits[i] = digit - (carry << windowBits);
+			}
+		}
+
+		class BucketAccumulator {
+		public:
+			explicit BucketAccumulator(uint32_t windowBits)
+					: m_buckets(1u << (windowBits - 1))
+					, m_isBucketSet(m_buckets.size())
+			{}
+
+		public:
+			void reset() {
+				std::fill(m_isBucketSet.begin(), m_isBucketSet.end(), static_cast<uint8_t>(0));
+			}
+
+			void add(int32_t digit, const ge25519& point, const ge25519_pniels& pnielsPoint) {
+				auto isNegative = static_cast<unsigned char>(digit < 0 ? 1 : 0);
+				auto index = static_cast<size_t>(isNegative ? -digit : digit) - 1;
+				auto& bucket = m_buckets[index];
+				if (!m_isBucketSet[index]) {
+					bucket = point;
+					if (isNegative) {
+						curve25519_neg(bucket.x, bucket.x);
+						curve25519_neg(bucket.t, bucket.t);
+					}
+
+					m_isBucketSet[index] = 1;
+					return;
+				}
+
+				ge25519_p1p1 ALIGN(16) sum;
+				ge25519_pnielsadd_p1p1(&sum, &bucket, &pnielsPoint, isNegative);
+				ge25519_p1p1_to_full(&bucket, &sum);
+			}
+
+			// calculates sum((i + 1) * bucket[i]) and stores it in result; returns false if all buckets are empty
+			bool sum(ge25519& result) const {
+				ge25519 ALIGN(16) runningSum;
+				auto isRunningSumSet = false;
+				auto isResultSet = false;
+				for (auto i = m_buckets.size(); i > 0; --i) {
+					if (m_isBucketSet[i - 1]) {
+						if (isRunningSumSet)
+							ge25519_add(&runningSum, &runningSum, &m_buckets[i - 1]);
+						else
+							runningSum = m_buckets[i - 1];
+
+						isRunningSumSet = true;
+					}
+
+					if (!isRunningSumSet)
+						continue;
+
+					if (isResultSet)
+						ge25519_add(&result, &result, &runningSum);
+					else
+						result = runningSum;
+
+					isResultSet = true;
 				}
 
-				// compute scalars[1]..scalars[batchSize] as r[i]*H(R[i],A[i],m[i])
-				for (auto i = 0u; i < batchSize; ++i) {
-					Hash512 hash_h;
-					Sha512_Builder hasher_h;
-					const auto& signatureInput = pSignatureInputs[offset + i];
-					hasher_h.update({ { signatureInput.Signature.data(), Encoded_Size }, signatureInput.PublicKey });
-					for (const auto& buffer : signatureInput.Buffers)
-						hasher_h.update(buffer);
+				return isResultSet;
+			}
 
-					hasher_h.final(hash_h);
+		private:
+			std::vector<ge25519> m_buckets;
+			std::vector<uint8_t> m_isBucketSet;
+		};
+
+		bool IsNeutralPippenger(const bignum256modm* scalars, const ge25519* points, size_t batchSize) {
+			auto numPoints = batchSize * 2 + 1;
+			auto windowBits = ChooseWindowBits(batchSize);
+			auto numWindows = CalculateNumWindows(windowBits);
+
+			std::vector<int32_t> digits(numPoints * numWindows);
+			std::vector<ge25519_pniels> pnielsPoints(numPoints);
+			for (auto i = 0u; i < numPoints; ++i) {
+				ToSignedDigits(&digits[i * numWindows], scalars[i], windowBits, numWindows);
+				ge25519_full_to_pniels(&pnielsPoints[i], &points[i]);
+			}
 
-					expand256_modm(batch.scalars[i + 1], hash_h.data(), 64);
-					mul256_modm(batch.scalars[i + 1], batch.scalars[i + 1], r_scalars[i]);
+			// process windows starting with the most significant one
+			ge25519 ALIGN(16) result;
+			ge25519 ALIGN(16) windowSum;
+			auto isResultSet = false;
+			BucketAccumulator accumulator(windowBits);
+			for (auto window = numWindows; window > 0; --window) {
+				if (isResultSet) {
+					for (auto i = 1u; i < windowBits; ++i)
+						ge25519_double_partial(&result, &result);
+
+					ge25519_double(&result, &result);
 				}
 
-				// compute points
-				batch.points[0] = ge25519_basepoint;
-				bool success = true;
-				for (auto i = 0u; i < batchSize; ++i) {
-					const auto& signatureInput = pSignatureInputs[offset + i];
-					auto R = signatureInput.Signature.copyTo<Key>();
-					success &= UnpackNegativeAndCheckSubgroup(batch.points[i + 1], signatureInput.PublicKey);
-					success &= UnpackNegativeAndCheckSubgroup(batch.points[batchSize + i + 1], R);
-					if (!success)
-						break;
+				accumulator.reset();
+				for (auto i = 0u; i < numPoints; ++i) {
+					auto digit = digits[i * numWindows + window - 1];
+					if (0 != digit)
+						accumulator.add(digit, points[i], pnielsPoints[i]);
 				}
 
+				if (!accumulator.sum(windowSum))
+					continue;
+
+				if (isResultSet)
+					ge25519_add(&result, &result, &windowSum);
+				else
+					result = windowSum;
+
+				isResultSet = true;
+			}
+
+			return !isResultSet || ge25519_is_neutral_vartime(&result);
+		}
+
+		bool VerifyPippengerBatch(
+				CurveBackend backend,
+				const RandomFiller& randomFiller,
+				const SignatureInput* pSignatureInputs,
+				size_t batchSize) {
+			auto numPoints = batchSize * 2 + 1;
+			std::vector<uint8_t> randomBytes(batchSize * 16);
+			std::vector<bignum256modm> scalars(numPoints);
+			std::vector<ge25519> points(numPoints);
+			std::unique_ptr<bool[]> isInMainSubgroup(new bool[numPoints - 1]);
+
+			return PrepareBatch(
+					backend,
+					randomFiller,
+					pSignatureInputs,
+					batchSize,
+					randomBytes.data(),
+					scalars.data(),
+					points.data(),
+					isInMainSubgroup.get())
+					&& IsNeutralPippenger(scalars.data(), points.data(), batchSize);
+		}
+
+		// endregion
+
+		bool VerifyBosCosterBatches(
+				CurveBackend backend,
+				const RandomFiller& randomFiller,
+				const SignatureInput* pSignatureInputs,
+				size_t offset,
+				size_t count,
+				std::pair<std::vector<bool>, bool>& result,
+				const predicate<size_t, size_t>& fallback) {
+			batch_heap ALIGN(16) batch;
+			ge25519 ALIGN(16) p;
+			bool isInMainSubgroup[heap_batch_size - 1];
+			auto& aggregateResult = result.second;
+
+			// because batch verification has some overhead like computing scalars, it is only faster when verifying more than 3 signatures
+			while (count > 3) {
+				auto batchSize = (count > max_batch_size) ? max_batch_size : count;
+
+				auto success = PrepareBatch(
+						backend,
+						randomFiller,
+						pSignatureInputs + offset,
+						batchSize,
+						&batch.r[0][0],
+						batch.scalars,
+						batch.points,
+						isInMainSubgroup);
 				if (success) {
 					ge25519_multi_scalarmult_vartime(&p, &batch, (batchSize * 2) + 1);
 					success = ge25519_is_neutral_vartime(&p);
@@ -316,8 +547,33 @@ namespace catapult { namespace crypto {
 				offset += batchSize;
 			}
 
+			// only stop early when fallback requested short circuit, aggregate result is tracked in \a result
 			aggregateResult &= VerifySingle(pSignatureInputs, offset, count, result.first);
-			return aggregateResult;
+			return true;
+		}
+
+		bool VerifyBatches(
+				CurveBackend backend,
+				const RandomFiller& randomFiller,
+				const SignatureInput* pSignatureInputs,
+				size_t count,
+				std::pair<std::vector<bool>, bool>& result,
+				const predicate<size_t, size_t>& fallback) {
+			size_t offset = 0;
+			while (count >= Pippenger_Threshold) {
+				auto batchSize = std::min(count, Max_Pippenger_Batch_Size);
+
+				// when a large batch fails, narrow down the invalid signatures using smaller batches
+				if (!VerifyPippengerBatch(backend, randomFiller, pSignatureInputs + offset, batchSize)) {
+					if (!VerifyBosCosterBatches(backend, randomFiller, pSignatureInputs, offset, batchSize, result, fallback))
+						return false;
+				}
+
+				count -= batchSize;
+				offset += batchSize;
+			}
+
+			return VerifyBosCosterBatches(backend, randomFiller, pSignatureInputs, offset, count, result, fallback) && result.second;
 		}
 	}
 
@@ -325,17 +581,33 @@ namespace catapult { namespace crypto {
 			const RandomFiller& randomFiller,
 			const SignatureInput* pSignatureInputs,
 			size_t count) {
+		return VerifyMulti(GetDefaultCurveBackend(), randomFiller, pSignatureInputs, count);
+	}
+
+	bool VerifyMultiShortCircuit(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count) {
+		return VerifyMultiShortCircuit(GetDefaultCurveBackend(), randomFiller, pSignatureInputs, count);
+	}
+
+	std::pair<std::vector<bool>, bool> VerifyMulti(
+			CurveBackend backend,
+			const RandomFiller& randomFiller,
+			const SignatureInput* pSignatureInputs,
+			size_t count) {
 		auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
-		VerifyBatches(randomFiller, pSignatureInputs, count, result, [&pSignatureInputs, &result](auto offset, auto batchSize) {
+		VerifyBatches(backend, randomFiller, pSignatureInputs, count, result, [&pSignatureInputs, &result](auto offset, auto batchSize) {
 			result.second &= VerifySingle(pSignatureInputs, offset, batchSize, result.first);
 			return true;
 		});
 		return result;
 	}
 
-	bool VerifyMultiShortCircuit(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count) {
+	bool VerifyMultiShortCircuit(
+			CurveBackend backend,
+			const RandomFiller& randomFiller,
+			const SignatureInput* pSignatureInputs,
+			size_t count) {
 		auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
-		return result.second && VerifyBatches(randomFiller, pSignatureInputs, count, result, [](auto, auto) {
+		return result.second && VerifyBatches(backend, randomFiller, pSignatureInputs, count, result, [](auto, auto) {
 			return false;
 		});
 	}
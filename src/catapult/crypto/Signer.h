@@ -19,18 +19,77 @@
 **/
 
 #pragma once
+#include "CurveBackend.h"
 #include "KeyPair.h"
+#include "catapult/exceptions.h"
+#include <array>
 #include <vector>
 
 namespace catapult { namespace crypto {
 
+	/// Inline list of (at most two) buffers composing signed data.
+	/// \note Buffers are stored inline so that capturing signature inputs does not require any heap allocations.
+	class SignatureInputBuffers {
+	public:
+		/// Maximum number of buffers.
+		static constexpr size_t Max_Count = 2;
+
+	public:
+		/// Creates an empty list.
+		constexpr SignatureInputBuffers() : m_size(0)
+		{}
+
+		/// Creates a list around \a buffers.
+		SignatureInputBuffers(std::initializer_list<RawBuffer> buffers) : m_size(0) {
+			if (buffers.size() > Max_Count)
+				CATAPULT_THROW_INVALID_ARGUMENT_1("too many signature input buffers", buffers.size());
+
+			for (const auto& buffer : buffers)
+				m_buffers[m_size++] = buffer;
+		}
+
+	public:
+		/// Gets the number of buffers.
+		size_t size() const {
+			return m_size;
+		}
+
+		/// Gets a const iterator to the first buffer.
+		const RawBuffer* begin() const {
+			return m_buffers.data();
+		}
+
+		/// Gets a const iterator to one past the last buffer.
+		const RawBuffer* end() const {
+			return m_buffers.data() + m_size;
+		}
+
+		/// Gets the buffer at \a index.
+		const RawBuffer& operator[](size_t index) const {
+			return m_buffers[index];
+		}
+
+	public:
+		/// Appends \a buffer to the list.
+		void push_back(const RawBuffer& buffer) {
+			if (Max_Count == m_size)
+				CATAPULT_THROW_OUT_OF_RANGE("signature input buffers are full");
+
+			m_buffers[m_size++] = buffer;
+		}
+
+	private:
+		std::array<RawBuffer, Max_Count> m_buffers;
+		size_t m_size;
+	};
+
 	/// Signature input.
 	struct SignatureInput {
 		/// Public key.
 		const Key& PublicKey;
 
 		/// Buffers.
-		std::vector<RawBuffer> Buffers;
+		SignatureInputBuffers Buffers;
 
 		/// Signature.
 		const catapult::Signature& Signature;
@@ -65,4 +124,23 @@ namespace catapult { namespace crypto {
 	/// \a randomFiller is used to generate random bytes.
 	/// Collates and returns an aggregate result that is \c true when all signatures are valid.
 	bool VerifyMultiShortCircuit(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count);
+
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid using curve \a backend.
+	/// \a randomFiller is used to generate random bytes.
+	/// Collates and returns a pair consisting of an aggregate result that is \c true when all signatures are valid
+	/// and a vector of bools that indicates the verification result for each individual signature.
+	std::pair<std::vector<bool>, bool> VerifyMulti(
+			CurveBackend backend,
+			const RandomFiller& randomFiller,
+			const SignatureInput* pSignatureInputs,
+			size_t count);
+
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid using curve \a backend.
+	/// \a randomFiller is used to generate random bytes.
+	/// Collates and returns an aggregate result that is \c true when all signatures are valid.
+	bool VerifyMultiShortCircuit(
+			CurveBackend backend,
+			const RandomFiller& randomFiller,
+			const SignatureInput* pSignatureInputs,
+			size_t count);
 }}
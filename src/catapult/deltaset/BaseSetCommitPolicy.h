@@ -21,6 +21,7 @@
 #pragma once
 #include "DeltaElements.h"
 #include "catapult/exceptions.h"
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -43,6 +44,12 @@ namespace catapult { namespace deltaset {
 			elements.erase(TKeyTraits::ToKey(element));
 	}
 
+	/// Prefetches elements identified by \a keys from \a elements.
+	/// \note This is a no-op for memory-based sets.
+	template<typename TStorageSet, typename TKey>
+	void PrefetchBaseSet(const TStorageSet&, const std::vector<TKey>&)
+	{}
+
 	/// Default policy for committing changes to a base set.
 	template<typename TSetTraits>
 	struct BaseSetCommitPolicy {
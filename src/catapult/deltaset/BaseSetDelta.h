@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "BaseSetCommitPolicy.h"
 #include "BaseSetDefaultTraits.h"
 #include "BaseSetFindIterator.h"
 #include "DeltaElements.h"
@@ -181,6 +182,20 @@ namespace catapult { namespace deltaset {
 			return !Contains(m_removedElements, key) && (Contains(m_addedElements, key) || Contains(m_originalElements, key));
 		}
 
+		/// Prefetches elements identified by \a keys from the original set so that subsequent finds avoid slow lookups.
+		/// \note Keys with pending modifications are skipped because their elements are already in memory.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			std::vector<KeyType> originalKeys;
+			originalKeys.reserve(keys.size());
+			for (const auto& key : keys) {
+				if (!Contains(m_addedElements, key) && !Contains(m_removedElements, key) && !Contains(m_copiedElements, key))
+					originalKeys.push_back(key);
+			}
+
+			if (!originalKeys.empty())
+				PrefetchBaseSet(m_originalElements, originalKeys);
+		}
+
 	private:
 		template<typename TSet> // SetType or MemorySetType
 		static constexpr bool Contains(const TSet& set, const KeyType& key) {
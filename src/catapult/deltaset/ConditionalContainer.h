@@ -154,6 +154,12 @@ namespace catapult { namespace deltaset {
 					: ConditionalIterator(m_pContainer2->find(key), MemoryFlag());
 		}
 
+		/// Prefetches elements identified by \a keys when this set is storage-based.
+		void prefetch(const std::vector<typename TKeyTraits::KeyType>& keys) const {
+			if (m_pContainer1)
+				PrefetchBaseSet(*m_pContainer1, keys);
+		}
+
 	public:
 		/// Applies all changes in \a deltas to the underlying container.
 		void update(const DeltaElements<MemorySetType>& deltas) {
@@ -209,6 +215,15 @@ namespace catapult { namespace deltaset {
 		container.update(deltas);
 	}
 
+	/// Prefetches elements identified by \a keys from \a container.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
+	void PrefetchBaseSet(
+			const ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container,
+			const std::vector<typename TKeyTraits::KeyType>& keys) {
+		container.prefetch(keys);
+	}
+
 	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
 	/// \note Specialization for ConditionalContainer.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TPruningBoundary>
@@ -22,6 +22,7 @@
 #include "ConsumerEntry.h"
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/Functional.h"
+#include <limits>
 #include <thread>
 
 namespace catapult { namespace disruptor {
@@ -34,6 +35,19 @@ namespace catapult { namespace disruptor {
 			return options;
 		}
 
+		const DisruptorConsumerLevels& CheckConsumerLevels(const DisruptorConsumerLevels& consumerLevels) {
+			for (const auto& consumers : consumerLevels) {
+				if (consumers.empty())
+					CATAPULT_THROW_INVALID_ARGUMENT("consumer dispatcher level must contain at least one consumer");
+			}
+
+			// the single consumer in the last level completes each element, which requires exclusive access to it
+			if (!consumerLevels.empty() && 1 != consumerLevels.back().size())
+				CATAPULT_THROW_INVALID_ARGUMENT("consumer dispatcher last level must contain a single consumer");
+
+			return consumerLevels;
+		}
+
 		void LogCompletion(const DisruptorElement& element, const DisruptorBarriers& barriers, size_t elementTraceInterval) {
 			if (!IsIntervalElementId(element.id(), elementTraceInterval))
 				return;
@@ -54,38 +68,55 @@ namespace catapult { namespace disruptor {
 			const ConsumerDispatcherOptions& options,
 			const std::vector<DisruptorConsumer>& consumers,
 			const DisruptorInspector& inspector)
+			: ConsumerDispatcher(options, ToSequentialConsumerLevels(consumers), inspector)
+	{}
+
+	ConsumerDispatcher::ConsumerDispatcher(
+			const ConsumerDispatcherOptions& options,
+			const DisruptorConsumerLevels& consumerLevels,
+			const DisruptorInspector& inspector)
 			: NamedObjectMixin(CheckOptions(options).DispatcherName)
 			, m_elementTraceInterval(options.ElementTraceInterval)
 			, m_shouldThrowIfFull(options.ShouldThrowWhenFull)
 			, m_keepRunning(true)
-			, m_barriers(consumers.size() + 1)
+			, m_barriers(CheckConsumerLevels(consumerLevels).size() + 1)
 			, m_disruptor(options.DisruptorSize, options.ElementTraceInterval)
 			, m_inspector(inspector)
 			, m_numActiveElements(0) {
-		auto currentLevel = 0u;
-		for (const auto& consumer : consumers) {
-			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
-				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
-				while (pThis->m_keepRunning) {
-					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
-					if (!pDisruptorElement) {
-						std::this_thread::sleep_for(std::chrono::milliseconds(10));
-						continue;
-					}
-
-					auto result = consumer(pDisruptorElement->input());
-					if (CompletionStatus::Aborted == result.CompletionStatus)
-						pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
-
-					pThis->advance(consumerEntry);
-				}
-			});
+		// create all entries before starting any thread because consumers read positions of other consumers in the same level
+		for (auto level = 0u; level < consumerLevels.size(); ++level) {
+			m_consumerEntries.emplace_back();
+			for (auto i = 0u; i < consumerLevels[level].size(); ++i)
+				m_consumerEntries.back().push_back(std::make_unique<ConsumerEntry>(level));
+		}
+
+		for (auto level = 0u; level < consumerLevels.size(); ++level) {
+			for (auto i = 0u; i < consumerLevels[level].size(); ++i)
+				spawnConsumerThread(*m_consumerEntries[level][i], consumerLevels[level][i]);
 		}
 
 		CATAPULT_LOG(info) << options.DispatcherName << " ConsumerDispatcher spawned " << m_threads.size() << " workers";
 	}
 
+	void ConsumerDispatcher::spawnConsumerThread(ConsumerEntry& consumerEntry, const DisruptorConsumer& consumer) {
+		m_threads.create_thread([pThis = this, &consumerEntry, consumer]() {
+			thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+			while (pThis->m_keepRunning) {
+				auto* pDisruptorElement = pThis->tryNext(consumerEntry);
+				if (!pDisruptorElement) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(10));
+					continue;
+				}
+
+				auto result = consumer(pDisruptorElement->input());
+				if (CompletionStatus::Aborted == result.CompletionStatus)
+					pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
+
+				pThis->advance(consumerEntry);
+			}
+		});
+	}
+
 	ConsumerDispatcher::~ConsumerDispatcher() {
 		shutdown();
 	}
@@ -128,7 +159,7 @@ namespace catapult { namespace disruptor {
 	void ConsumerDispatcher::advance(ConsumerEntry& consumerEntry) {
 		auto consumerPosition = consumerEntry.position();
 		consumerEntry.advance();
-		m_barriers[consumerEntry.level() + 1].advance();
+		advanceLevelBarrier(consumerEntry.level());
 
 		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer
 		if (consumerEntry.level() + 1 != m_barriers.size() - 1)
@@ -140,17 +171,19 @@ namespace catapult { namespace disruptor {
 		element.markProcessingComplete();
 	}
 
-	bool ConsumerDispatcher::canProcessNextElement() const {
-		auto minPosition = m_barriers[m_barriers.size() - 1].position();
-		auto maxPosition = m_barriers[0].position();
-		auto requiredCapacity = maxPosition - minPosition + 1 + 1; // check for space for *next* element
-		auto totalCapacity = m_disruptor.capacity();
-
-		if (requiredCapacity < totalCapacity)
-			return true;
-
-		CATAPULT_LOG(warning) << "disruptor is full (minPosition = " << minPosition << ", maxPosition = " << maxPosition << ")";
-		return requiredCapacity == totalCapacity;
+	void ConsumerDispatcher::advanceLevelBarrier(size_t level) {
+		// next barrier can advance past an element once all consumers in the level have processed it
+		auto levelPosition = std::numeric_limits<PositionType>::max();
+		for (const auto& pConsumerEntry : m_consumerEntries[level])
+			levelPosition = std::min(levelPosition, pConsumerEntry->position());
+
+		// each consumer in the level can observe the new minimum, so advance cooperatively
+		auto& barrier = m_barriers[level + 1];
+		auto barrierPosition = barrier.position();
+		while (barrierPosition < levelPosition) {
+			if (barrier.tryAdvance(barrierPosition))
+				++barrierPosition;
+		}
 	}
 
 	ProcessingCompleteFunc ConsumerDispatcher::wrap(const ProcessingCompleteFunc& processingComplete) {
@@ -166,9 +199,9 @@ namespace catapult { namespace disruptor {
 			return 0;
 		}
 
-		// need to atomically check spare capacity AND add element
-		utils::SpinLockGuard guard(m_addSpinLock);
-		if (!canProcessNextElement()) {
+		// producers are not serialized: each one atomically claims a position with spare capacity, fills it and publishes it
+		PositionType position;
+		if (!m_disruptor.tryClaim(m_barriers[m_barriers.size() - 1].position(), position)) {
 			if (m_shouldThrowIfFull)
 				CATAPULT_THROW_RUNTIME_ERROR("consumer is too far behind");
 
@@ -176,8 +209,8 @@ namespace catapult { namespace disruptor {
 		}
 
 		++m_numActiveElements;
-		auto id = m_disruptor.add(std::move(input), wrap(processingComplete));
-		m_barriers[0].advance();
+		auto id = m_disruptor.set(position, std::move(input), wrap(processingComplete));
+		m_disruptor.publish(position, m_barriers[0]);
 		return id;
 	}
 
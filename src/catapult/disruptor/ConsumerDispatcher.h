@@ -42,6 +42,15 @@ namespace catapult { namespace disruptor {
 				const std::vector<DisruptorConsumer>& consumers,
 				const DisruptorInspector& inspector);
 
+		/// Creates a dispatcher of consumers grouped into levels (\a consumerLevels) configured with \a options.
+		/// Inspector (\a inspector) is a special consumer that is always run (independent of skip) and as a last one.
+		/// Inspector runs within a thread of the last consumer.
+		/// \note Consumers sharing a level must be independent. The last level must contain a single consumer.
+		ConsumerDispatcher(
+				const ConsumerDispatcherOptions& options,
+				const DisruptorConsumerLevels& consumerLevels,
+				const DisruptorInspector& inspector);
+
 		/// Creates a dispatcher of \a consumers configured with \a options.
 		ConsumerDispatcher(const ConsumerDispatcherOptions& options, const std::vector<DisruptorConsumer>& consumers);
 
@@ -71,11 +80,13 @@ namespace catapult { namespace disruptor {
 		size_t numActiveElements() const;
 
 	private:
+		void spawnConsumerThread(ConsumerEntry& consumerEntry, const DisruptorConsumer& consumer);
+
 		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
 
 		void advance(ConsumerEntry& consumerEntry);
 
-		bool canProcessNextElement() const;
+		void advanceLevelBarrier(size_t level);
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete);
 
@@ -84,11 +95,10 @@ namespace catapult { namespace disruptor {
 		bool m_shouldThrowIfFull;
 		std::atomic_bool m_keepRunning;
 		DisruptorBarriers m_barriers;
+		std::vector<std::vector<std::unique_ptr<ConsumerEntry>>> m_consumerEntries; // consumer entries grouped by level
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
 		boost::thread_group m_threads;
 		std::atomic<size_t> m_numActiveElements;
-
-		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
 	};
 }}
@@ -20,11 +20,14 @@
 
 #pragma once
 #include "DisruptorBarrier.h"
+#include "catapult/utils/NonCopyable.h"
+#include <atomic>
 
 namespace catapult { namespace disruptor {
 
 	/// Holds information about a consumer.
-	class ConsumerEntry {
+	/// \note Position is only advanced by the consumer thread but can be read by other threads.
+	class ConsumerEntry : utils::NonCopyable {
 	public:
 		/// Creates an entry with \a level and \a position.
 		explicit ConsumerEntry(size_t level)
@@ -50,6 +53,6 @@ namespace catapult { namespace disruptor {
 
 	private:
 		const size_t m_level;
-		PositionType m_position;
+		std::atomic<PositionType> m_position;
 	};
 }}
@@ -27,22 +27,61 @@ namespace catapult { namespace disruptor {
 
 	// short rationale for lack of locks:
 	//  1. m_container is initialized with size, so most operations here don't require locks
-	//  2. add is guarded by a lock inside ConsumerDispatcher, which checks if the Disruptor is full
-	//  3. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
+	//  2. producers claim positions with a CAS on m_allElementsCount, which fails when the Disruptor is full,
+	//     so each claimed slot is written by exactly one producer
+	//  3. consumers only read slots below the first barrier, which publish advances past consecutive published slots
+	//  4. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
 
 	Disruptor::Disruptor(size_t disruptorSize, size_t elementTraceInterval)
 			: m_elementTraceInterval(elementTraceInterval)
 			, m_container(disruptorSize)
+			, m_publishedPositions(disruptorSize)
 			, m_allElementsCount(0)
 	{}
 
 	DisruptorElementId Disruptor::add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
-		auto element = DisruptorElement(std::move(input), ++m_allElementsCount, processingComplete);
+		return set(m_allElementsCount++, std::move(input), processingComplete);
+	}
+
+	bool Disruptor::tryClaim(PositionType minPosition, PositionType& position) {
+		// minPosition can only increase, so a stale value can only cause a spurious failure
+		auto claimedPosition = m_allElementsCount.load();
+		do {
+			auto requiredCapacity = claimedPosition - minPosition + 1 + 1; // check for space for *next* element
+			auto totalCapacity = capacity();
+			if (requiredCapacity >= totalCapacity) {
+				CATAPULT_LOG(warning)
+						<< "disruptor is full (minPosition = " << minPosition
+						<< ", maxPosition = " << claimedPosition << ")";
+				if (requiredCapacity > totalCapacity)
+					return false;
+			}
+		} while (!m_allElementsCount.compare_exchange_weak(claimedPosition, claimedPosition + 1));
+
+		position = claimedPosition;
+		return true;
+	}
+
+	DisruptorElementId Disruptor::set(PositionType position, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
+		auto element = DisruptorElement(std::move(input), position + 1, processingComplete);
 		if (IsIntervalElementId(element.id(), m_elementTraceInterval))
 			CATAPULT_LOG(debug) << "disruptor queuing " << element;
 
-		m_container.push_back(std::move(element));
-		return element.id();
+		auto id = element.id();
+		m_container[position] = std::move(element);
+		return id;
+	}
+
+	void Disruptor::publish(PositionType position, DisruptorBarrier& barrier) {
+		m_publishedPositions[position % capacity()] = position + 1;
+
+		// advance the barrier past all consecutive published elements; when an earlier element has not been published yet,
+		// the producer publishing it will advance the barrier past this element
+		auto barrierPosition = barrier.position();
+		while (barrierPosition + 1 == m_publishedPositions[barrierPosition % capacity()]) {
+			if (barrier.tryAdvance(barrierPosition))
+				++barrierPosition;
+		}
 	}
 
 	void Disruptor::markSkipped(PositionType position, const ConsumerResult& result) {
@@ -26,6 +26,7 @@
 #include "catapult/model/EntityRange.h"
 #include "catapult/utils/CircularBuffer.h"
 #include "catapult/utils/NonCopyable.h"
+#include <algorithm>
 #include <vector>
 
 namespace catapult { namespace disruptor {
@@ -40,8 +41,21 @@ namespace catapult { namespace disruptor {
 	public:
 		/// Adds \a input to the underlying container and returns the assigned disruptor element id.
 		/// Once the processing of the input is complete, \a processingComplete will be called.
+		/// \note This function does not check capacity and does not publish the element, so it is only suitable for a single producer.
 		DisruptorElementId add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
 
+		/// Claims the next free position given the position of the slowest consumer (\a minPosition) and stores it in \a position.
+		/// Returns \c false if the disruptor does not have space for another element.
+		bool tryClaim(PositionType minPosition, PositionType& position);
+
+		/// Sets \a input at a previously claimed \a position and returns the assigned disruptor element id.
+		/// Once the processing of the input is complete, \a processingComplete will be called.
+		DisruptorElementId set(PositionType position, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
+
+		/// Publishes the element at a previously claimed and set \a position and advances \a barrier
+		/// past all consecutive published elements.
+		void publish(PositionType position, DisruptorBarrier& barrier);
+
 		/// Sets the skip flag on the element at \a position with \a result.
 		void markSkipped(PositionType position, const ConsumerResult& result);
 
@@ -55,7 +69,7 @@ namespace catapult { namespace disruptor {
 
 		/// Gets the size of the disruptor.
 		inline size_t size() const {
-			return m_container.size();
+			return std::min<size_t>(m_allElementsCount, m_container.capacity());
 		}
 
 		/// Gets the capacity of the disruptor.
@@ -63,7 +77,7 @@ namespace catapult { namespace disruptor {
 			return m_container.capacity();
 		}
 
-		/// Gets the number of total elements added to the disruptor.
+		/// Gets the number of total elements added (or claimed) in the disruptor.
 		inline uint64_t added() const {
 			return m_allElementsCount;
 		}
@@ -71,6 +85,7 @@ namespace catapult { namespace disruptor {
 	private:
 		size_t m_elementTraceInterval;
 		utils::CircularBuffer<DisruptorElement> m_container;
+		std::vector<std::atomic<PositionType>> m_publishedPositions; // (position + 1) of the element last published in each slot
 		std::atomic<uint64_t> m_allElementsCount;
 	};
 }}
@@ -42,6 +42,12 @@ namespace catapult { namespace disruptor {
 			++m_position;
 		}
 
+		/// Advances the barrier if it is at \a expectedPosition.
+		/// Returns \c false and updates \a expectedPosition with the current position if the barrier is at a different position.
+		inline bool tryAdvance(PositionType& expectedPosition) {
+			return m_position.compare_exchange_strong(expectedPosition, expectedPosition + 1);
+		}
+
 		/// Gets the level of the barrier.
 		inline size_t level() const {
 			return m_level;
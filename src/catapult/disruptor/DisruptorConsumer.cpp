@@ -53,4 +53,12 @@ namespace catapult { namespace disruptor {
 			return transactionConsumer(input.transactions());
 		});
 	}
+
+	DisruptorConsumerLevels ToSequentialConsumerLevels(const std::vector<DisruptorConsumer>& consumers) {
+		DisruptorConsumerLevels consumerLevels;
+		for (const auto& consumer : consumers)
+			consumerLevels.push_back({ consumer });
+
+		return consumerLevels;
+	}
 }}
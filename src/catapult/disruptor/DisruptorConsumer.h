@@ -31,6 +31,10 @@ namespace catapult { namespace disruptor {
 	/// Disruptor consumer function.
 	using DisruptorConsumer = DisruptorConsumerT<ConsumerInput>;
 
+	/// Disruptor consumers grouped into levels.
+	/// All consumers in a level process an element concurrently after all consumers in the previous level have processed it.
+	using DisruptorConsumerLevels = std::vector<std::vector<DisruptorConsumer>>;
+
 	/// Const disruptor consumer function.
 	using ConstDisruptorConsumer = DisruptorConsumerT<const ConsumerInput>;
 
@@ -52,4 +56,7 @@ namespace catapult { namespace disruptor {
 	/// Maps \a transactionConsumers to disruptor consumers so that they can be used to create a ConsumerDispatcher.
 	std::vector<DisruptorConsumer> DisruptorConsumersFromTransactionConsumers(
 			const std::vector<TransactionConsumer>& transactionConsumers);
+
+	/// Maps \a consumers to levels containing a single consumer each so that they process every element sequentially.
+	DisruptorConsumerLevels ToSequentialConsumerLevels(const std::vector<DisruptorConsumer>& consumers);
 }}
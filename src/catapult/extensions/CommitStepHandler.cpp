@@ -19,13 +19,21 @@
 **/
 
 #include "CommitStepHandler.h"
+#include "catapult/cache_db/RocksWriteQueue.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/io/IndexFile.h"
+#include "catapult/plugins/PluginManager.h"
 
 namespace catapult { namespace extensions {
 
 	consumers::BlockChainSyncHandlers::CommitStepFunc CreateCommitStepHandler(const config::CatapultDataDirectory& dataDirectory) {
-		return [dataDirectory](auto step) {
+		return CreateCommitStepHandler(dataDirectory, [](const auto& action) { action(); });
+	}
+
+	consumers::BlockChainSyncHandlers::CommitStepFunc CreateCommitStepHandler(
+			const config::CatapultDataDirectory& dataDirectory,
+			const StateDurabilityBarrier& stateDurabilityBarrier) {
+		return [dataDirectory, stateDurabilityBarrier](auto step) {
 			io::IndexFile(dataDirectory.rootDir().file("commit_step.dat")).set(utils::to_underlying_type(step));
 
 			if (consumers::CommitOperationStep::All_Updated != step)
@@ -36,7 +44,21 @@ namespace catapult { namespace extensions {
 			if (!syncIndexWriterFile.exists())
 				return;
 
-			io::IndexFile(stateChangeDirectory.file("index.dat")).set(syncIndexWriterFile.get());
+			// state changes up to the current index must not be marked as applied before the committed state is durable,
+			// otherwise recovery would not replay them
+			auto syncIndex = syncIndexWriterFile.get();
+			stateDurabilityBarrier([stateChangeDirectory, syncIndex]() {
+				io::IndexFile(stateChangeDirectory.file("index.dat")).set(syncIndex);
+			});
 		};
 	}
+
+	StateDurabilityBarrier CreateStateDurabilityBarrier(const plugins::PluginManager& pluginManager) {
+		auto* pWriteQueue = pluginManager.cacheDatabaseWriteQueue();
+		if (!pWriteQueue)
+			return [](const auto& action) { action(); };
+
+		// write queue executes operations in order, so the action is executed after all previously queued batches are written
+		return [pWriteQueue](const auto& action) { pWriteQueue->push(action); };
+	}
 }}
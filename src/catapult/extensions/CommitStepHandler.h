@@ -21,10 +21,25 @@
 #pragma once
 #include "catapult/consumers/BlockChainSyncHandlers.h"
 
-namespace catapult { namespace config { class CatapultDataDirectory; } }
+namespace catapult {
+	namespace config { class CatapultDataDirectory; }
+	namespace plugins { class PluginManager; }
+}
 
 namespace catapult { namespace extensions {
 
+	/// Barrier that invokes an action once all previously committed cache state is durable.
+	using StateDurabilityBarrier = consumer<const action&>;
+
 	/// Creates a commit step handler around \a dataDirectory.
 	consumers::BlockChainSyncHandlers::CommitStepFunc CreateCommitStepHandler(const config::CatapultDataDirectory& dataDirectory);
+
+	/// Creates a commit step handler around \a dataDirectory that uses \a stateDurabilityBarrier to delay marking
+	/// state changes as applied until the committed cache state is durable.
+	consumers::BlockChainSyncHandlers::CommitStepFunc CreateCommitStepHandler(
+			const config::CatapultDataDirectory& dataDirectory,
+			const StateDurabilityBarrier& stateDurabilityBarrier);
+
+	/// Creates a state durability barrier for the cache databases created by \a pluginManager.
+	StateDurabilityBarrier CreateStateDurabilityBarrier(const plugins::PluginManager& pluginManager);
 }}
@@ -27,11 +27,33 @@
 
 namespace catapult { namespace extensions {
 
+	namespace {
+		cache::RocksColumnSettings ToColumnSettings(const config::NodeConfiguration::CacheDatabaseColumnSubConfiguration& columnConfig) {
+			cache::RocksColumnSettings columnSettings;
+			columnSettings.WriteBufferSize = columnConfig.WriteBufferSize;
+			columnSettings.BloomFilterBitsPerKey = columnConfig.BloomFilterBitsPerKey;
+			columnSettings.EnablePartitionedIndexFilters = columnConfig.EnablePartitionedIndexFilters;
+			columnSettings.CompressionPerLevel = columnConfig.CompressionPerLevel;
+			return columnSettings;
+		}
+	}
+
 	plugins::StorageConfiguration CreateStorageConfiguration(const config::CatapultConfiguration& config) {
 		plugins::StorageConfiguration storageConfig;
 		storageConfig.PreferCacheDatabase = config.Node.EnableCacheDatabaseStorage;
 		storageConfig.CacheDatabaseDirectory = (boost::filesystem::path(config.User.DataDirectory) / "statedb").generic_string();
 		storageConfig.MaxCacheDatabaseWriteBatchSize = config.Node.MaxCacheDatabaseWriteBatchSize;
+		storageConfig.MaxCachedPatriciaTreeNodes = config.Node.MaxCachedPatriciaTreeNodes;
+
+		const auto& cacheDatabaseConfig = config.Node.CacheDatabase;
+		storageConfig.CacheDatabaseBlockCacheSize = cacheDatabaseConfig.BlockCacheSize;
+		storageConfig.EnableCacheDatabaseStatistics = cacheDatabaseConfig.EnableStatistics;
+		storageConfig.MaxPendingCacheDatabaseWriteBatches = cacheDatabaseConfig.MaxPendingWriteBatches;
+		storageConfig.CacheDatabaseTuning.MaxBackgroundJobs = cacheDatabaseConfig.MaxBackgroundJobs;
+		storageConfig.CacheDatabaseTuning.DefaultColumnSettings = ToColumnSettings(cacheDatabaseConfig);
+		for (const auto& pair : cacheDatabaseConfig.Columns)
+			storageConfig.CacheDatabaseTuning.ColumnSettings.emplace(pair.first, ToColumnSettings(pair.second));
+
 		return storageConfig;
 	}
 
@@ -33,6 +33,20 @@ namespace catapult { namespace extensions {
 	}
 #endif
 
+	namespace {
+		plugins::StorageConfiguration CreateProcessStorageConfiguration(
+				const config::CatapultConfiguration& config,
+				ProcessDisposition disposition) {
+			auto storageConfig = CreateStorageConfiguration(config);
+
+			// recovery advances spool indexes as it applies state changes, so cache database writes must be synchronous
+			if (ProcessDisposition::Recovery == disposition)
+				storageConfig.MaxPendingCacheDatabaseWriteBatches = 0;
+
+			return storageConfig;
+		}
+	}
+
 	ProcessBootstrapper::ProcessBootstrapper(
 			const config::CatapultConfiguration& config,
 			const std::string& resourcesPath,
@@ -48,7 +62,11 @@ namespace catapult { namespace extensions {
 							? thread::MultiServicePool::IsolatedPoolMode::Disabled
 							: thread::MultiServicePool::IsolatedPoolMode::Enabled))
 			, m_subscriptionManager(config)
-			, m_pluginManager(m_config.BlockChain, CreateStorageConfiguration(config), m_config.User, m_config.Inflation) {
+			, m_pluginManager(
+					m_config.BlockChain,
+					CreateProcessStorageConfiguration(config, disposition),
+					m_config.User,
+					m_config.Inflation) {
 #ifdef STRICT_SYMBOL_VISIBILITY
 			// need to forcibly inject typeinfos into containing exe so that they are properly resolved across modules
 			ForceSymbolInjection<model::EmbeddedTransactionPlugin>();
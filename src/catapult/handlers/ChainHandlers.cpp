@@ -137,17 +137,13 @@ namespace catapult { namespace handlers {
 				auto numBlocks = ClampNumBlocks(info, config);
 				auto numResponseBytes = ClampNumResponseBytes(info, config);
 
-				uint32_t payloadSize = 0;
+				// always return at least one block
+				auto blockElements = storageView.loadBlockElements(info.pRequest->Height, numBlocks, numResponseBytes);
+
 				std::vector<std::shared_ptr<const model::Block>> blocks;
-				for (auto i = 0u; i < numBlocks; ++i) {
-					// always return at least one block
-					auto pBlock = storageView.loadBlock(info.pRequest->Height + Height(i));
-					if (!blocks.empty() && payloadSize + pBlock->Size > numResponseBytes)
-						break;
-
-					payloadSize += pBlock->Size;
-					blocks.push_back(std::move(pBlock));
-				}
+				blocks.reserve(blockElements.size());
+				for (const auto& pBlockElement : blockElements)
+					blocks.push_back(std::shared_ptr<const model::Block>(pBlockElement, &pBlockElement->Block));
 
 				auto payload = ionet::PacketPayloadFactory::FromEntities(RequestType::Packet_Type, blocks);
 				context.response(std::move(payload));
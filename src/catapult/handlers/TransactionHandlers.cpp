@@ -65,9 +65,7 @@ namespace catapult { namespace handlers {
 				return PullTransactionsInfo();
 
 			const auto* pShortHash = reinterpret_cast<const utils::ShortHash*>(pShortHashDataStart);
-			info.ShortHashes.reserve(numShortHashes);
-			for (auto i = 0u; i < numShortHashes; ++i, ++pShortHash)
-				info.ShortHashes.insert(*pShortHash);
+			info.ShortHashes = utils::ShortHashesSet(std::vector<utils::ShortHash>(pShortHash, pShortHash + numShortHashes));
 
 			info.IsValid = true;
 			return info;
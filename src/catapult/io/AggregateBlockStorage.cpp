@@ -69,6 +69,13 @@ namespace catapult { namespace io {
 				return m_pStorage->loadBlockElement(height);
 			}
 
+			std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(
+					Height height,
+					size_t maxBlocks,
+					size_t maxBytes) const override {
+				return m_pStorage->loadBlockElements(height, maxBlocks, maxBytes);
+			}
+
 			std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override {
 				return m_pStorage->loadBlockStatementData(height);
 			}
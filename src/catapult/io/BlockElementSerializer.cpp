@@ -80,10 +80,6 @@ namespace catapult { namespace io {
 			auto pBlockElementRaw = new (pData.get()) model::BlockElement(*reinterpret_cast<model::Block*>(pBlockData));
 			auto pBlockElement = std::shared_ptr<model::BlockElement>(pBlockElementRaw);
 			pData.release();
-
-			// read metadata
-			inputStream.read(pBlockElement->EntityHash);
-			inputStream.read(pBlockElement->GenerationHash);
 			return pBlockElement;
 		}
 
@@ -109,10 +105,16 @@ namespace catapult { namespace io {
 
 	std::shared_ptr<model::BlockElement> ReadBlockElement(InputStream& inputStream) {
 		auto pBlockElement = ReadBlockElementImpl(inputStream);
-		ReadTransactionHashes(inputStream, *pBlockElement);
-		ReadSubCacheMerkleRoots(inputStream, pBlockElement->SubCacheMerkleRoots);
+		ReadBlockElementMetadata(inputStream, *pBlockElement);
 		return pBlockElement;
 	}
 
+	void ReadBlockElementMetadata(InputStream& inputStream, model::BlockElement& blockElement) {
+		inputStream.read(blockElement.EntityHash);
+		inputStream.read(blockElement.GenerationHash);
+		ReadTransactionHashes(inputStream, blockElement);
+		ReadSubCacheMerkleRoots(inputStream, blockElement.SubCacheMerkleRoots);
+	}
+
 	// endregion
 }}
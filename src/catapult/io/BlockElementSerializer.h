@@ -37,4 +37,8 @@ namespace catapult { namespace io {
 	/// Reads block element from \a inputStream into an allocated block element.
 	/// \note Shared pointer is returned for memory management reasons.
 	std::shared_ptr<model::BlockElement> ReadBlockElement(InputStream& inputStream);
+
+	/// Reads block element metadata (everything written after the block) from \a inputStream into \a blockElement.
+	/// \note \a blockElement is expected to reference an already loaded block.
+	void ReadBlockElementMetadata(InputStream& inputStream, model::BlockElement& blockElement);
 }}
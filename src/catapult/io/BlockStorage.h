@@ -23,7 +23,9 @@
 #include "catapult/model/EntityInfo.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/NonCopyable.h"
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace io {
 
@@ -58,6 +60,13 @@ namespace catapult { namespace io {
 		/// Gets the block element (owning a block) at \a height.
 		virtual std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const = 0;
 
+		/// Gets at most \a maxBlocks consecutive block elements starting at \a height with a total block size of at most \a maxBytes.
+		/// \note The block element at \a height is always returned when it is available, even if it is larger than \a maxBytes.
+		virtual std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(
+				Height height,
+				size_t maxBlocks,
+				size_t maxBytes) const = 0;
+
 		/// Gets the optional block statement data at \a height.
 		virtual std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const = 0;
 	};
@@ -68,4 +77,36 @@ namespace catapult { namespace io {
 		/// Purges all blocks from storage.
 		virtual void purge() = 0;
 	};
+
+	/// Gets at most \a maxBlocks consecutive block elements starting at \a height with a total block size of at most \a maxBytes
+	/// by calling \a loadBlockElement for each height that is not greater than \a chainHeight.
+	template<typename TLoadBlockElement>
+	std::vector<std::shared_ptr<const model::BlockElement>> LoadBlockElements(
+			Height chainHeight,
+			Height height,
+			size_t maxBlocks,
+			size_t maxBytes,
+			TLoadBlockElement loadBlockElement) {
+		std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
+		if (Height(0) == height || chainHeight < height)
+			return blockElements;
+
+		auto numAvailableBlocks = (chainHeight - height).unwrap() + 1;
+		auto numBlocks = static_cast<size_t>(std::min<uint64_t>(maxBlocks, numAvailableBlocks));
+		blockElements.reserve(numBlocks);
+
+		size_t numBytes = 0;
+		for (auto i = 0u; i < numBlocks; ++i) {
+			auto pBlockElement = loadBlockElement(height + Height(i));
+			numBytes += pBlockElement->Block.Size;
+
+			// always return at least one block element
+			if (!blockElements.empty() && numBytes > maxBytes)
+				break;
+
+			blockElements.push_back(std::move(pBlockElement));
+		}
+
+		return blockElements;
+	}
 }}
@@ -21,7 +21,11 @@
 #include "BlockStorageCache.h"
 #include "MoveBlockFiles.h"
 #include "catapult/model/Elements.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/SpinLock.h"
+#include <list>
+#include <unordered_map>
 
 namespace catapult { namespace io {
 
@@ -34,6 +38,16 @@ namespace catapult { namespace io {
 	// region CachedData
 
 	struct CachedData {
+	public:
+		using BlockStatementData = std::pair<std::vector<uint8_t>, bool>;
+
+	public:
+		explicit CachedData(size_t maxBlockElements)
+				: m_maxBlockElements(maxBlockElements)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
+
 	public:
 		Height height() const {
 			return m_pBlockElement ? m_pBlockElement->Block.Height : Height(0);
@@ -61,8 +75,109 @@ namespace catapult { namespace io {
 			m_pBlockElement.reset();
 		}
 
+	public:
+		bool isRecentCacheEnabled() const {
+			return 0 != m_maxBlockElements;
+		}
+
+		std::shared_ptr<const model::BlockElement> tryGetRecentBlockElement(Height height) const {
+			utils::SpinLockGuard guard(m_recentLock);
+			auto* pEntry = find(height);
+			if (!pEntry || !pEntry->pBlockElement) {
+				++m_numMisses;
+				return nullptr;
+			}
+
+			++m_numHits;
+			return pEntry->pBlockElement;
+		}
+
+		bool tryGetRecentBlockStatementData(Height height, BlockStatementData& blockStatementData) const {
+			utils::SpinLockGuard guard(m_recentLock);
+			auto* pEntry = find(height);
+			if (!pEntry || !pEntry->pBlockStatementData) {
+				++m_numMisses;
+				return false;
+			}
+
+			++m_numHits;
+			blockStatementData = *pEntry->pBlockStatementData;
+			return true;
+		}
+
+		void addRecentBlockElement(const std::shared_ptr<const model::BlockElement>& pBlockElement) const {
+			utils::SpinLockGuard guard(m_recentLock);
+			findOrInsert(pBlockElement->Block.Height).pBlockElement = pBlockElement;
+		}
+
+		void addRecentBlockStatementData(Height height, const BlockStatementData& blockStatementData) const {
+			utils::SpinLockGuard guard(m_recentLock);
+			findOrInsert(height).pBlockStatementData = std::make_shared<const BlockStatementData>(blockStatementData);
+		}
+
+		void dropRecentAfter(Height height) {
+			utils::SpinLockGuard guard(m_recentLock);
+			for (auto iter = m_recentEntries.begin(); m_recentEntries.end() != iter;) {
+				if (iter->Height <= height) {
+					++iter;
+					continue;
+				}
+
+				m_recentEntryIndex.erase(iter->Height);
+				iter = m_recentEntries.erase(iter);
+			}
+		}
+
+		BlockStorageCacheStatistics statistics() const {
+			utils::SpinLockGuard guard(m_recentLock);
+			return { m_numHits, m_numMisses, m_recentEntries.size() };
+		}
+
+	private:
+		struct RecentEntry {
+			catapult::Height Height;
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			std::shared_ptr<const BlockStatementData> pBlockStatementData;
+		};
+
+		using RecentEntries = std::list<RecentEntry>;
+
+	private:
+		RecentEntry* find(Height height) const {
+			auto indexIter = m_recentEntryIndex.find(height);
+			if (m_recentEntryIndex.cend() == indexIter)
+				return nullptr;
+
+			// move the entry to the front of the list, which contains the most recently used entries
+			m_recentEntries.splice(m_recentEntries.begin(), m_recentEntries, indexIter->second);
+			return &*indexIter->second;
+		}
+
+		RecentEntry& findOrInsert(Height height) const {
+			auto* pEntry = find(height);
+			if (pEntry)
+				return *pEntry;
+
+			if (m_maxBlockElements == m_recentEntries.size()) {
+				m_recentEntryIndex.erase(m_recentEntries.back().Height);
+				m_recentEntries.pop_back();
+			}
+
+			m_recentEntries.push_front(RecentEntry{ height, nullptr, nullptr });
+			m_recentEntryIndex.emplace(height, m_recentEntries.begin());
+			return m_recentEntries.front();
+		}
+
 	private:
 		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+
+		// recent entries are modified by (concurrent) readers, so they need to be synchronized separately
+		size_t m_maxBlockElements;
+		mutable RecentEntries m_recentEntries;
+		mutable std::unordered_map<Height, RecentEntries::iterator, utils::BaseValueHasher<Height>> m_recentEntryIndex;
+		mutable uint64_t m_numHits;
+		mutable uint64_t m_numMisses;
+		mutable utils::SpinLock m_recentLock;
 	};
 
 	// endregion
@@ -95,7 +210,11 @@ namespace catapult { namespace io {
 		if (m_cachedData.contains(height))
 			return m_cachedData.block(height);
 
-		return m_storage.loadBlock(height);
+		if (!m_cachedData.isRecentCacheEnabled())
+			return m_storage.loadBlock(height);
+
+		// load (and cache) the entire block element so that subsequent loads of any kind can be served from memory
+		return BlockElementAsSharedBlock(loadRecentBlockElement(height));
 	}
 
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
@@ -103,12 +222,48 @@ namespace catapult { namespace io {
 		if (m_cachedData.contains(height))
 			return m_cachedData.blockElement(height);
 
-		return m_storage.loadBlockElement(height);
+		if (!m_cachedData.isRecentCacheEnabled())
+			return m_storage.loadBlockElement(height);
+
+		return loadRecentBlockElement(height);
+	}
+
+	std::vector<std::shared_ptr<const model::BlockElement>> BlockStorageView::loadBlockElements(
+			Height height,
+			size_t maxBlocks,
+			size_t maxBytes) const {
+		if (!m_cachedData.isRecentCacheEnabled())
+			return m_storage.loadBlockElements(height, maxBlocks, maxBytes);
+
+		return LoadBlockElements(chainHeight(), height, maxBlocks, maxBytes, [this](auto blockElementHeight) {
+			return m_cachedData.contains(blockElementHeight)
+					? m_cachedData.blockElement(blockElementHeight)
+					: loadRecentBlockElement(blockElementHeight);
+		});
 	}
 
 	std::pair<std::vector<uint8_t>, bool> BlockStorageView::loadBlockStatementData(Height height) const {
 		requireHeight(height, "block statement data");
-		return m_storage.loadBlockStatementData(height);
+		if (!m_cachedData.isRecentCacheEnabled())
+			return m_storage.loadBlockStatementData(height);
+
+		std::pair<std::vector<uint8_t>, bool> blockStatementData;
+		if (m_cachedData.tryGetRecentBlockStatementData(height, blockStatementData))
+			return blockStatementData;
+
+		blockStatementData = m_storage.loadBlockStatementData(height);
+		m_cachedData.addRecentBlockStatementData(height, blockStatementData);
+		return blockStatementData;
+	}
+
+	std::shared_ptr<const model::BlockElement> BlockStorageView::loadRecentBlockElement(Height height) const {
+		auto pBlockElement = m_cachedData.tryGetRecentBlockElement(height);
+		if (pBlockElement)
+			return pBlockElement;
+
+		pBlockElement = m_storage.loadBlockElement(height);
+		m_cachedData.addRecentBlockElement(pBlockElement);
+		return pBlockElement;
 	}
 
 	void BlockStorageView::requireHeight(Height height, const char* description) const {
@@ -149,6 +304,9 @@ namespace catapult { namespace io {
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
 		m_stagingStorage.dropBlocksAfter(height);
 		m_saveStartHeight = height;
+
+		// readers are blocked until commit completes, so cached blocks can be dropped eagerly
+		m_cachedData.dropRecentAfter(height);
 	}
 
 	void BlockStorageModifier::commit() {
@@ -167,10 +325,13 @@ namespace catapult { namespace io {
 
 	// region BlockStorageCache
 
-	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage)
+	BlockStorageCache::BlockStorageCache(
+			std::unique_ptr<BlockStorage>&& pStorage,
+			std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+			size_t maxCachedBlockElements)
 			: m_pStorage(std::move(pStorage))
 			, m_pStagingStorage(std::move(pStagingStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(maxCachedBlockElements)) {
 		m_pCachedData->update(m_pStorage->loadBlockElement(m_pStorage->chainHeight()));
 	}
 
@@ -186,5 +347,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, std::move(writeLock), *m_pCachedData);
 	}
 
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pCachedData->statistics();
+	}
+
 	// endregion
 }}
@@ -26,6 +26,18 @@ namespace catapult { namespace io { struct CachedData; } }
 
 namespace catapult { namespace io {
 
+	/// Statistics about the recently loaded block elements cached by a block storage cache.
+	struct BlockStorageCacheStatistics {
+		/// Number of loads served by cached block elements.
+		uint64_t NumHits;
+
+		/// Number of loads served by the underlying storage.
+		uint64_t NumMisses;
+
+		/// Number of cached block elements.
+		size_t Size;
+	};
+
 	/// Read only view on top of block storage.
 	class BlockStorageView : utils::MoveOnly {
 	public:
@@ -51,10 +63,14 @@ namespace catapult { namespace io {
 		/// Gets the block element (owning a block) at \a height.
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const;
 
+		/// Gets at most \a maxBlocks consecutive block elements starting at \a height with a total block size of at most \a maxBytes.
+		std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(Height height, size_t maxBlocks, size_t maxBytes) const;
+
 		/// Gets the optional block statement data at \a height.
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const;
 
 	private:
+		std::shared_ptr<const model::BlockElement> loadRecentBlockElement(Height height) const;
 		void requireHeight(Height height, const char* description) const;
 
 	private:
@@ -95,11 +111,15 @@ namespace catapult { namespace io {
 	};
 
 	/// Cache around a BlockStorage.
-	/// \note Currently this "cache" provides synchronization and support for two-phase commit.
+	/// \note This cache provides synchronization, support for two-phase commit and caching of recently loaded block elements.
 	class BlockStorageCache {
 	public:
 		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit.
-		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage);
+		/// At most \a maxCachedBlockElements recently loaded block elements (and block statements) are kept in memory.
+		BlockStorageCache(
+				std::unique_ptr<BlockStorage>&& pStorage,
+				std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+				size_t maxCachedBlockElements = 0);
 
 		/// Destroys the cache.
 		~BlockStorageCache();
@@ -111,6 +131,9 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets statistics about cached block elements.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<PrunableBlockStorage> m_pStagingStorage;
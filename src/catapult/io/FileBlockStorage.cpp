@@ -19,8 +19,10 @@
 **/
 
 #include "FileBlockStorage.h"
+#include "PackFileBlockStorage.h"
 #include "BlockElementSerializer.h"
 #include "BlockStatementSerializer.h"
+#include "BufferInputStreamAdapter.h"
 #include "BufferedFileStream.h"
 #include "FilesystemUtils.h"
 #include "PodIoUtils.h"
@@ -105,13 +107,16 @@ namespace catapult { namespace io {
 	{}
 
 	namespace {
+		void CheckHashFileSize(Height height, uint64_t size) {
+			// check that first hash file has at least two hashes inside.
+			if (height.unwrap() < Files_Per_Directory && Hash256::Size * 2 > size)
+				CATAPULT_THROW_RUNTIME_ERROR_1("hashes.dat has invalid size", size);
+		}
+
 		std::unique_ptr<RawFile> OpenHashFile(const std::string& baseDirectory, Height height, OpenMode openMode) {
 			auto hashFilePath = GetHashFilePath(baseDirectory, height);
 			auto pHashFile = std::make_unique<RawFile>(hashFilePath.generic_string().c_str(), openMode, LockMode::None);
-			// check that first hash file has at least two hashes inside.
-			if (height.unwrap() < Files_Per_Directory && Hash256::Size * 2 > pHashFile->size())
-				CATAPULT_THROW_RUNTIME_ERROR_1("hashes.dat has invalid size", pHashFile->size());
-
+			CheckHashFileSize(height, pHashFile->size());
 			return pHashFile;
 		}
 
@@ -122,17 +127,16 @@ namespace catapult { namespace io {
 	}
 
 	model::HashRange FileBlockStorage::HashFile::loadHashesFrom(Height height, size_t numHashes) const {
+		// hashes are copied out of the mapping because they can be overwritten in place by a rollback
 		uint8_t* pData = nullptr;
 		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
 
 		while (numHashes) {
-			auto pHashFile = OpenHashFile(m_dataDirectory, height, OpenMode::Read_Only);
-			SeekHashFile(*pHashFile, height);
+			auto index = static_cast<size_t>(height.unwrap() % Files_Per_Directory);
+			auto count = std::min<size_t>(numHashes, Files_Per_Directory - index);
 
-			auto count = Files_Per_Directory - (height.unwrap() % Files_Per_Directory);
-			count = std::min<size_t>(numHashes, count);
-
-			pHashFile->read(MutableRawBuffer(pData, count * Hash256::Size));
+			auto pMappedHashFile = mappedHashFile(height, index + count);
+			std::memcpy(pData, pMappedHashFile->data() + index * Hash256::Size, count * Hash256::Size);
 
 			pData += count * Hash256::Size;
 			numHashes -= count;
@@ -156,6 +160,28 @@ namespace catapult { namespace io {
 	void FileBlockStorage::HashFile::reset() {
 		m_cachedDirectoryId = Unset_Directory_Id;
 		m_pCachedHashFile.reset();
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		m_mappedHashFiles.clear();
+	}
+
+	std::shared_ptr<const MemoryMappedFile> FileBlockStorage::HashFile::mappedHashFile(Height height, size_t minNumHashes) const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto& pMappedHashFile = m_mappedHashFiles[height.unwrap() / Files_Per_Directory];
+
+		// hashes.dat only needs to be remapped when it has grown past the end of the existing mapping
+		// (hashes overwritten in place are visible through the existing mapping)
+		if (!pMappedHashFile || pMappedHashFile->size() < minNumHashes * Hash256::Size) {
+			auto hashFilePath = GetHashFilePath(m_dataDirectory, height);
+			auto pNewMappedHashFile = std::make_shared<const MemoryMappedFile>(hashFilePath.generic_string());
+			CheckHashFileSize(height, pNewMappedHashFile->size());
+			if (pNewMappedHashFile->size() < minNumHashes * Hash256::Size)
+				CATAPULT_THROW_RUNTIME_ERROR_1("hashes.dat does not contain hash at height", height);
+
+			pMappedHashFile = std::move(pNewMappedHashFile);
+		}
+
+		return pMappedHashFile;
 	}
 
 	// endregion
@@ -256,24 +282,6 @@ namespace catapult { namespace io {
 	// region BlockStorage
 
 	namespace {
-		class RawFileInputStreamAdapter : public InputStream {
-		public:
-			explicit RawFileInputStreamAdapter(RawFile& rawFile) : m_rawFile(rawFile)
-			{}
-
-		public:
-			bool eof() const override {
-				CATAPULT_THROW_INVALID_ARGUMENT("eof not supported");
-			}
-
-			void read(const MutableRawBuffer& buffer) override {
-				m_rawFile.read(buffer);
-			}
-
-		private:
-			RawFile& m_rawFile;
-		};
-
 		std::shared_ptr<model::Block> ReadBlock(RawFile& blockFile) {
 			auto size = Read32(blockFile);
 			blockFile.seek(0);
@@ -282,6 +290,21 @@ namespace catapult { namespace io {
 			blockFile.read({ reinterpret_cast<uint8_t*>(pBlock.get()), size });
 			return pBlock;
 		}
+
+		std::shared_ptr<const model::BlockElement> ReadBlockElement(const std::string& baseDirectory, Height height) {
+			// read the entire file at once, so that deserialization does not require a separate read per field
+			auto pBlockFile = OpenBlockFile(baseDirectory, height);
+			std::vector<uint8_t> buffer(pBlockFile->size());
+			pBlockFile->read(buffer);
+
+			BufferInputStreamAdapter<std::vector<uint8_t>> streamAdapter(buffer);
+			auto pBlockElement = io::ReadBlockElement(streamAdapter);
+
+			if (!streamAdapter.eof())
+				CATAPULT_THROW_RUNTIME_ERROR_1("additional data after block at height", height);
+
+			return PORTABLE_MOVE(pBlockElement);
+		}
 	}
 
 	std::shared_ptr<const model::Block> FileBlockStorage::loadBlock(Height height) const {
@@ -292,14 +315,18 @@ namespace catapult { namespace io {
 
 	std::shared_ptr<const model::BlockElement> FileBlockStorage::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
-		auto pBlockFile = OpenBlockFile(m_dataDirectory, height);
-		RawFileInputStreamAdapter streamAdapter(*pBlockFile);
-		auto pBlockElement = ReadBlockElement(streamAdapter);
-
-		if (pBlockFile->position() != pBlockFile->size())
-			CATAPULT_THROW_RUNTIME_ERROR_1("additional data after block at height", height);
+		return ReadBlockElement(m_dataDirectory, height);
+	}
 
-		return PORTABLE_MOVE(pBlockElement);
+	std::vector<std::shared_ptr<const model::BlockElement>> FileBlockStorage::loadBlockElements(
+			Height height,
+			size_t maxBlocks,
+			size_t maxBytes) const {
+		// chain height only needs to be read once for the entire range
+		const auto& dataDirectory = m_dataDirectory;
+		return LoadBlockElements(chainHeight(), height, maxBlocks, maxBytes, [&dataDirectory](auto blockElementHeight) {
+			return ReadBlockElement(dataDirectory, blockElementHeight);
+		});
 	}
 
 	std::pair<std::vector<uint8_t>, bool> FileBlockStorage::loadBlockStatementData(Height height) const {
@@ -340,4 +367,18 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region CreateFileBlockStorage
+
+	std::unique_ptr<PrunableBlockStorage> CreateFileBlockStorage(
+			const std::string& dataDirectory,
+			FileBlockStorageLayout layout,
+			FileBlockStorageMode mode) {
+		if (FileBlockStorageLayout::Pack == layout)
+			return std::make_unique<PackFileBlockStorage>(dataDirectory, mode);
+
+		return std::make_unique<FileBlockStorage>(dataDirectory, mode);
+	}
+
+	// endregion
 }}
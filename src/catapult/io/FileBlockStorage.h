@@ -21,7 +21,10 @@
 #pragma once
 #include "BlockStorage.h"
 #include "IndexFile.h"
+#include "MemoryMappedFile.h"
 #include "RawFile.h"
+#include <map>
+#include <mutex>
 #include <string>
 
 namespace catapult { namespace io {
@@ -35,6 +38,15 @@ namespace catapult { namespace io {
 		None
 	};
 
+	/// File block storage layouts.
+	enum class FileBlockStorageLayout {
+		/// Store every block in a separate file.
+		File_Per_Block,
+
+		/// Append blocks to memory mapped segment pack files.
+		Pack
+	};
+
 	/// File-based block storage.
 	class FileBlockStorage final : public PrunableBlockStorage {
 	public:
@@ -53,6 +65,10 @@ namespace catapult { namespace io {
 		// BlockStorage
 		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+		std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(
+				Height height,
+				size_t maxBlocks,
+				size_t maxBytes) const override;
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
 
 		// PrunableBlockStorage
@@ -70,12 +86,19 @@ namespace catapult { namespace io {
 			void save(Height height, const Hash256& hash);
 			void reset();
 
+		private:
+			std::shared_ptr<const MemoryMappedFile> mappedHashFile(Height height, size_t minNumHashes) const;
+
 		private:
 			const std::string& m_dataDirectory;
 
 			// used for caching inside save()
 			uint64_t m_cachedDirectoryId;
 			std::unique_ptr<RawFile> m_pCachedHashFile;
+
+			// used for caching inside loadHashesFrom()
+			mutable std::mutex m_mutex;
+			mutable std::map<uint64_t, std::shared_ptr<const MemoryMappedFile>> m_mappedHashFiles;
 		};
 
 		std::string m_dataDirectory;
@@ -84,4 +107,11 @@ namespace catapult { namespace io {
 		HashFile m_hashFile;
 		IndexFile m_indexFile;
 	};
+
+	/// Creates a file-based block storage with specified \a layout, where blocks will be stored inside \a dataDirectory
+	/// with specified storage \a mode.
+	std::unique_ptr<PrunableBlockStorage> CreateFileBlockStorage(
+			const std::string& dataDirectory,
+			FileBlockStorageLayout layout,
+			FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
 }}
@@ -0,0 +1,67 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryMappedFile.h"
+#include "catapult/exceptions.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace catapult { namespace io {
+
+	class MemoryMappedFile::Impl {
+	public:
+		explicit Impl(const std::string& pathname)
+				: m_mapping(pathname.c_str(), boost::interprocess::read_only)
+				, m_region(m_mapping, boost::interprocess::read_only)
+		{}
+
+	public:
+		size_t size() const {
+			return m_region.get_size();
+		}
+
+		const uint8_t* data() const {
+			return static_cast<const uint8_t*>(m_region.get_address());
+		}
+
+	private:
+		boost::interprocess::file_mapping m_mapping;
+		boost::interprocess::mapped_region m_region;
+	};
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& pathname) {
+		try {
+			m_pImpl = std::make_unique<Impl>(pathname);
+		} catch (const boost::interprocess::interprocess_exception& ex) {
+			CATAPULT_LOG(warning) << "unable to map '" << pathname << "': " << ex.what();
+			CATAPULT_THROW_FILE_IO_ERROR("couldn't map the file");
+		}
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() = default;
+
+	size_t MemoryMappedFile::size() const {
+		return m_pImpl->size();
+	}
+
+	const uint8_t* MemoryMappedFile::data() const {
+		return m_pImpl->data();
+	}
+}}
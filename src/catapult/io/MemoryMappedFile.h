@@ -0,0 +1,50 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/types.h"
+#include <memory>
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Read-only memory mapping of a file.
+	/// \note Data appended to the file after the mapping has been created is not visible through the mapping.
+	class MemoryMappedFile final : public utils::NonCopyable {
+	public:
+		/// Maps the (non-empty) file at \a pathname into memory.
+		explicit MemoryMappedFile(const std::string& pathname);
+
+		/// Destroys the mapping.
+		~MemoryMappedFile();
+
+	public:
+		/// Gets the number of mapped bytes.
+		size_t size() const;
+
+		/// Gets a const pointer to the mapped bytes.
+		const uint8_t* data() const;
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}}
@@ -25,15 +25,14 @@
 
 namespace catapult { namespace io {
 
-	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
+	void CopyBlockFiles(const BlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight, Height endHeight) {
 		if (startHeight < Height(1))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid height passed", startHeight);
 
 		if (startHeight <= destinationStorage.chainHeight())
 			destinationStorage.dropBlocksAfter(startHeight - Height(1));
 
-		auto sourceHeight = sourceStorage.chainHeight();
-		for (auto height = startHeight; height <= sourceHeight; height = height + Height(1)) {
+		for (auto height = startHeight; height <= endHeight; height = height + Height(1)) {
 			auto pBlockElement = sourceStorage.loadBlockElement(height);
 			auto blockStatementPair = sourceStorage.loadBlockStatementData(height);
 
@@ -46,7 +45,10 @@ namespace catapult { namespace io {
 
 			destinationStorage.saveBlock(*pBlockElement);
 		}
+	}
 
+	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
+		CopyBlockFiles(sourceStorage, destinationStorage, startHeight, sourceStorage.chainHeight());
 		sourceStorage.purge();
 	}
 }}
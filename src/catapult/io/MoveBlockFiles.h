@@ -30,6 +30,10 @@ namespace catapult {
 
 namespace catapult { namespace io {
 
+	/// Copies block files with heights in the inclusive range [\a startHeight, \a endHeight] from \a sourceStorage
+	/// to \a destinationStorage.
+	void CopyBlockFiles(const BlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight, Height endHeight);
+
 	/// Moves block files starting at \a startHeight from \a sourceStorage to \a destinationStorage.
 	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight);
 }}
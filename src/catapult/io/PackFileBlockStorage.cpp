@@ -0,0 +1,404 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PackFileBlockStorage.h"
+#include "BlockElementSerializer.h"
+#include "BlockStatementSerializer.h"
+#include "BufferInputStreamAdapter.h"
+#include "FilesystemUtils.h"
+#include "MemoryMappedFile.h"
+#include "StringOutputStream.h"
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <inttypes.h>
+
+namespace catapult { namespace io {
+
+	namespace {
+		static constexpr uint64_t Unset_Segment_Id = std::numeric_limits<uint64_t>::max();
+		static constexpr auto Pack_File_Extension = ".pack";
+		static constexpr auto Pack_Index_File_Extension = ".index";
+
+#pragma pack(push, 1)
+
+		// location of a block element (and optional block statement) inside of a segment pack file
+		struct PackIndexEntry {
+			Hash256 EntityHash;
+			uint64_t Offset;
+			uint32_t BlockElementSize;
+			uint32_t BlockStatementSize;
+		};
+
+#pragma pack(pop)
+
+		constexpr auto Pack_Index_File_Size = PackFileBlockStorage::Blocks_Per_Segment * sizeof(PackIndexEntry);
+
+		// region path utils
+
+#ifdef _MSC_VER
+#define SPRINTF sprintf_s
+#else
+#define SPRINTF sprintf
+#endif
+
+		uint64_t GetSegmentId(Height height) {
+			return height.unwrap() / PackFileBlockStorage::Blocks_Per_Segment;
+		}
+
+		size_t GetSegmentIndex(Height height) {
+			return height.unwrap() % PackFileBlockStorage::Blocks_Per_Segment;
+		}
+
+		std::string GetSegmentPath(const std::string& baseDirectory, uint64_t segmentId, const char* extension) {
+			char filename[32];
+			SPRINTF(filename, "%05" PRIu64, segmentId);
+			boost::filesystem::path path = baseDirectory;
+			path /= filename;
+			path += extension;
+			return path.generic_string();
+		}
+
+		// endregion
+
+		// region MappedBlockElement
+
+		// block element referencing a block inside of a (shared) pack file mapping
+		struct MappedBlockElement {
+		public:
+			MappedBlockElement(const std::shared_ptr<const MemoryMappedFile>& pPackMapping, const model::Block& block)
+					: pPackMapping(pPackMapping)
+					, BlockElement(block)
+			{}
+
+		public:
+			std::shared_ptr<const MemoryMappedFile> pPackMapping;
+			model::BlockElement BlockElement;
+		};
+
+		// endregion
+	}
+
+	// region PackFileBlockStorage::Segment
+
+	class PackFileBlockStorage::Segment {
+	public:
+		Segment(const std::string& dataDirectory, uint64_t segmentId)
+				: m_packFilename(GetSegmentPath(dataDirectory, segmentId, Pack_File_Extension))
+				, m_indexFilename(GetSegmentPath(dataDirectory, segmentId, Pack_Index_File_Extension))
+		{}
+
+	public:
+		bool tryGetEntry(Height height, PackIndexEntry& entry) {
+			if (!m_pIndexMapping) {
+				if (!boost::filesystem::is_regular_file(m_indexFilename))
+					return false;
+
+				// index file has a fixed size, so it only needs to be mapped once
+				m_pIndexMapping = std::make_unique<MemoryMappedFile>(m_indexFilename);
+				if (Pack_Index_File_Size != m_pIndexMapping->size()) {
+					auto indexSize = m_pIndexMapping->size();
+					m_pIndexMapping.reset();
+					CATAPULT_THROW_RUNTIME_ERROR_1("pack index file has invalid size", indexSize);
+				}
+			}
+
+			const auto* pEntries = reinterpret_cast<const PackIndexEntry*>(m_pIndexMapping->data());
+			entry = pEntries[GetSegmentIndex(height)];
+			return 0 != entry.BlockElementSize;
+		}
+
+		std::shared_ptr<const MemoryMappedFile> packMapping(uint64_t minSize) {
+			// pack file only grows, so it needs to be remapped when data appended after the last mapping is requested
+			// (outstanding block elements keep previous mappings alive)
+			if (!m_pPackMapping || m_pPackMapping->size() < minSize) {
+				m_pPackMapping = std::make_shared<MemoryMappedFile>(m_packFilename);
+				if (m_pPackMapping->size() < minSize)
+					CATAPULT_THROW_RUNTIME_ERROR_1("pack file is truncated", m_pPackMapping->size());
+			}
+
+			return m_pPackMapping;
+		}
+
+	private:
+		std::string m_packFilename;
+		std::string m_indexFilename;
+		std::unique_ptr<MemoryMappedFile> m_pIndexMapping;
+		std::shared_ptr<const MemoryMappedFile> m_pPackMapping;
+	};
+
+	// endregion
+
+	// region PackFileBlockStorage::BlockLocation
+
+	struct PackFileBlockStorage::BlockLocation {
+	public:
+		std::shared_ptr<const MemoryMappedFile> pPackMapping;
+		uint64_t Offset;
+		uint32_t BlockElementSize;
+		uint32_t BlockStatementSize;
+
+	public:
+		const uint8_t* blockElementData() const {
+			return pPackMapping->data() + Offset;
+		}
+
+		const uint8_t* blockStatementData() const {
+			return blockElementData() + BlockElementSize;
+		}
+	};
+
+	// endregion
+
+	// region ctor
+
+	PackFileBlockStorage::PackFileBlockStorage(const std::string& dataDirectory, FileBlockStorageMode mode)
+			: m_dataDirectory(dataDirectory)
+			, m_mode(mode)
+			, m_indexFile((boost::filesystem::path(m_dataDirectory) / "index.dat").generic_string())
+			, m_writerSegmentId(Unset_Segment_Id) {
+		// nemesis block is always stored in the first segment, so a chain without it uses the one file per block layout
+		auto firstIndexFilename = GetSegmentPath(m_dataDirectory, 0, Pack_Index_File_Extension);
+		if (Height(0) != chainHeight() && !boost::filesystem::is_regular_file(firstIndexFilename))
+			CATAPULT_THROW_RUNTIME_ERROR_1("data directory contains unpacked blocks, migrate it with blockpacker", m_dataDirectory);
+	}
+
+	PackFileBlockStorage::~PackFileBlockStorage() = default;
+
+	// endregion
+
+	// region LightBlockStorage
+
+	Height PackFileBlockStorage::chainHeight() const {
+		return m_indexFile.exists() ? Height(m_indexFile.get()) : Height(0);
+	}
+
+	Height PackFileBlockStorage::finalizedChainHeight() const {
+		return chainHeight() > Height(0) ? Height(1) : Height(0);
+	}
+
+	model::HashRange PackFileBlockStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		if (FileBlockStorageMode::Hash_Index != m_mode)
+			CATAPULT_THROW_INVALID_ARGUMENT("loadHashesFrom is not supported when Hash_Index mode is disabled");
+
+		auto currentHeight = chainHeight();
+		if (Height(0) == height || currentHeight < height)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((currentHeight - height).unwrap() + 1);
+		auto numHashes = std::min(maxHashes, numAvailableHashes);
+
+		uint8_t* pData = nullptr;
+		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		for (auto i = 0u; i < numHashes; ++i) {
+			PackIndexEntry entry;
+			if (!segment(height).tryGetEntry(height, entry))
+				CATAPULT_THROW_RUNTIME_ERROR_1("pack file block storage does not contain hash at height", height);
+
+			std::memcpy(pData, entry.EntityHash.data(), Hash256::Size);
+			pData += Hash256::Size;
+			height = height + Height(1);
+		}
+
+		return range;
+	}
+
+	void PackFileBlockStorage::saveBlock(const model::BlockElement& blockElement) {
+		auto currentHeight = chainHeight();
+		auto height = blockElement.Block.Height;
+
+		if (height != currentHeight + Height(1)) {
+			std::ostringstream out;
+			out << "cannot save block with height " << height << " when storage height is " << currentHeight;
+			CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+		}
+
+		// serialize element and statements so that they can be appended with a single write
+		StringOutputStream outputStream(blockElement.Block.Size);
+		WriteBlockElement(blockElement, outputStream);
+		auto blockElementSize = outputStream.str().size();
+
+		if (blockElement.OptionalStatement)
+			WriteBlockStatement(*blockElement.OptionalStatement, outputStream);
+
+		PackIndexEntry entry;
+		entry.EntityHash = blockElement.EntityHash;
+		entry.BlockElementSize = static_cast<uint32_t>(blockElementSize);
+		entry.BlockStatementSize = static_cast<uint32_t>(outputStream.str().size() - blockElementSize);
+
+		// always append, so that data referenced by outstanding mappings (e.g. of dropped blocks) is never overwritten
+		prepareWriters(height);
+		entry.Offset = m_pPackWriter->size();
+		m_pPackWriter->seek(entry.Offset);
+		m_pPackWriter->write({ reinterpret_cast<const uint8_t*>(outputStream.str().data()), outputStream.str().size() });
+
+		m_pIndexWriter->seek(GetSegmentIndex(height) * sizeof(PackIndexEntry));
+		m_pIndexWriter->write({ reinterpret_cast<const uint8_t*>(&entry), sizeof(PackIndexEntry) });
+
+		if (height > currentHeight)
+			m_indexFile.set(height.unwrap());
+	}
+
+	void PackFileBlockStorage::dropBlocksAfter(Height height) {
+		m_indexFile.set(height.unwrap());
+	}
+
+	// endregion
+
+	// region BlockStorage
+
+	namespace {
+		const model::Block& GetBlock(const uint8_t* pBlockElementData, uint32_t blockElementSize, Height height) {
+			const auto& block = reinterpret_cast<const model::Block&>(*pBlockElementData);
+			if (blockElementSize < sizeof(model::BlockHeader) || block.Size > blockElementSize)
+				CATAPULT_THROW_RUNTIME_ERROR_1("pack file block storage contains corrupt block at height", height);
+
+			return block;
+		}
+	}
+
+	std::shared_ptr<const model::Block> PackFileBlockStorage::loadBlock(Height height) const {
+		requireHeight(height, "block");
+		auto location = locate(height);
+		const auto& block = GetBlock(location.blockElementData(), location.BlockElementSize, height);
+		return std::shared_ptr<const model::Block>(location.pPackMapping, &block);
+	}
+
+	std::shared_ptr<const model::BlockElement> PackFileBlockStorage::loadBlockElement(Height height) const {
+		requireHeight(height, "block element");
+		return readBlockElement(height);
+	}
+
+	std::vector<std::shared_ptr<const model::BlockElement>> PackFileBlockStorage::loadBlockElements(
+			Height height,
+			size_t maxBlocks,
+			size_t maxBytes) const {
+		return LoadBlockElements(chainHeight(), height, maxBlocks, maxBytes, [this](auto blockElementHeight) {
+			return readBlockElement(blockElementHeight);
+		});
+	}
+
+	std::pair<std::vector<uint8_t>, bool> PackFileBlockStorage::loadBlockStatementData(Height height) const {
+		requireHeight(height, "block statement data");
+		auto location = locate(height);
+		if (0 == location.BlockStatementSize)
+			return std::make_pair(std::vector<uint8_t>(), false);
+
+		const auto* pBlockStatementData = location.blockStatementData();
+		std::vector<uint8_t> blockStatement(pBlockStatementData, pBlockStatementData + location.BlockStatementSize);
+		return std::make_pair(std::move(blockStatement), true);
+	}
+
+	// endregion
+
+	// region PrunableBlockStorage
+
+	void PackFileBlockStorage::purge() {
+		// remove everything under the directory
+		m_writerSegmentId = Unset_Segment_Id;
+		m_pPackWriter.reset();
+		m_pIndexWriter.reset();
+
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_segments.clear();
+		}
+
+		PurgeDirectory(m_dataDirectory);
+	}
+
+	// endregion
+
+	// region helpers
+
+	std::shared_ptr<const model::BlockElement> PackFileBlockStorage::readBlockElement(Height height) const {
+		auto location = locate(height);
+		const auto& block = GetBlock(location.blockElementData(), location.BlockElementSize, height);
+		auto pMappedBlockElement = std::make_shared<MappedBlockElement>(location.pPackMapping, block);
+
+		// only the metadata following the block needs to be deserialized because the block is referenced in place
+		auto metadataBuffer = RawBuffer(location.blockElementData() + block.Size, location.BlockElementSize - block.Size);
+		BufferInputStreamAdapter<RawBuffer> metadataStream(metadataBuffer);
+		ReadBlockElementMetadata(metadataStream, pMappedBlockElement->BlockElement);
+
+		if (!metadataStream.eof())
+			CATAPULT_THROW_RUNTIME_ERROR_1("additional data after block at height", height);
+
+		return std::shared_ptr<const model::BlockElement>(pMappedBlockElement, &pMappedBlockElement->BlockElement);
+	}
+
+	PackFileBlockStorage::BlockLocation PackFileBlockStorage::locate(Height height) const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto& segment = this->segment(height);
+
+		PackIndexEntry entry;
+		if (!segment.tryGetEntry(height, entry))
+			CATAPULT_THROW_RUNTIME_ERROR_1("pack file block storage does not contain block at height", height);
+
+		auto pPackMapping = segment.packMapping(entry.Offset + entry.BlockElementSize + entry.BlockStatementSize);
+		return { pPackMapping, entry.Offset, entry.BlockElementSize, entry.BlockStatementSize };
+	}
+
+	PackFileBlockStorage::Segment& PackFileBlockStorage::segment(Height height) const {
+		auto segmentId = GetSegmentId(height);
+		auto iter = m_segments.find(segmentId);
+		if (m_segments.cend() == iter)
+			iter = m_segments.emplace(segmentId, std::make_unique<Segment>(m_dataDirectory, segmentId)).first;
+
+		return *iter->second;
+	}
+
+	void PackFileBlockStorage::prepareWriters(Height height) {
+		auto segmentId = GetSegmentId(height);
+		if (m_writerSegmentId == segmentId)
+			return;
+
+		m_pPackWriter = std::make_unique<RawFile>(
+				GetSegmentPath(m_dataDirectory, segmentId, Pack_File_Extension),
+				OpenMode::Read_Append,
+				LockMode::None);
+		m_pIndexWriter = std::make_unique<RawFile>(
+				GetSegmentPath(m_dataDirectory, segmentId, Pack_Index_File_Extension),
+				OpenMode::Read_Append,
+				LockMode::None);
+
+		// preallocate the (fixed size) index file so that readers can map it once
+		auto indexSize = m_pIndexWriter->size();
+		if (indexSize < Pack_Index_File_Size) {
+			m_pIndexWriter->seek(indexSize);
+			m_pIndexWriter->write(std::vector<uint8_t>(Pack_Index_File_Size - indexSize));
+		}
+
+		m_writerSegmentId = segmentId;
+	}
+
+	void PackFileBlockStorage::requireHeight(Height height, const char* description) const {
+		auto chainHeight = this->chainHeight();
+		if (height <= chainHeight)
+			return;
+
+		std::ostringstream out;
+		out << "cannot load " << description << " at height (" << height << ") greater than chain height (" << chainHeight << ")";
+		CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+	}
+
+	// endregion
+}}
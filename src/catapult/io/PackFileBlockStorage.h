@@ -0,0 +1,91 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BlockStorage.h"
+#include "FileBlockStorage.h"
+#include "IndexFile.h"
+#include "RawFile.h"
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// File-based block storage that appends blocks and block statements to memory mapped segment pack files.
+	/// \note Each segment pack file is accompanied by a fixed size index that maps heights to offsets.
+	class PackFileBlockStorage final : public PrunableBlockStorage {
+	public:
+		/// Number of blocks stored in a single segment.
+		static constexpr uint32_t Blocks_Per_Segment = 65536u;
+
+	public:
+		/// Creates a pack file block storage, where blocks will be stored inside \a dataDirectory
+		/// with specified storage \a mode.
+		/// \note Throws when \a dataDirectory contains blocks that have not been migrated to pack files.
+		explicit PackFileBlockStorage(const std::string& dataDirectory, FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
+
+		/// Destroys the storage.
+		~PackFileBlockStorage() override;
+
+	public:
+		// LightBlockStorage
+		Height chainHeight() const override;
+		Height finalizedChainHeight() const override;
+		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
+		void saveBlock(const model::BlockElement& blockElement) override;
+		void dropBlocksAfter(Height height) override;
+
+		// BlockStorage
+		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+		std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(
+				Height height,
+				size_t maxBlocks,
+				size_t maxBytes) const override;
+		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
+
+		// PrunableBlockStorage
+		void purge() override;
+
+	private:
+		class Segment;
+		struct BlockLocation;
+
+		std::shared_ptr<const model::BlockElement> readBlockElement(Height height) const;
+		BlockLocation locate(Height height) const;
+		Segment& segment(Height height) const;
+		void prepareWriters(Height height);
+		void requireHeight(Height height, const char* description) const;
+
+	private:
+		std::string m_dataDirectory;
+		FileBlockStorageMode m_mode;
+		IndexFile m_indexFile;
+
+		mutable std::mutex m_mutex;
+		mutable std::map<uint64_t, std::unique_ptr<Segment>> m_segments;
+
+		// used for caching inside saveBlock()
+		uint64_t m_writerSegmentId;
+		std::unique_ptr<RawFile> m_pPackWriter;
+		std::unique_ptr<RawFile> m_pIndexWriter;
+	};
+}}
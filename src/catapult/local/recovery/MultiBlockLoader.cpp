@@ -107,6 +107,9 @@ namespace catapult { namespace local {
 	private:
 		using NotifyProgressFunc = consumer<Height, Height>;
 
+		static constexpr size_t Max_Blocks_Per_Load = 100;
+		static constexpr size_t Max_Bytes_Per_Load = 50 * 1024 * 1024;
+
 	public:
 		BlockChainLoader(
 				const BlockDependentNotificationObserverFactory& observerFactory,
@@ -130,14 +133,17 @@ namespace catapult { namespace local {
 			Hash256 stateHash;
 			auto chainHeight = storage.chainHeight();
 			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
-				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
+				// load blocks in batches to amortize storage access
+				auto blockElements = storage.loadBlockElements(height, Max_Blocks_Per_Load, Max_Bytes_Per_Load);
+				for (auto& pBlockElement : blockElements) {
+					score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
 
-				stateHash = execute(*pBlockElement);
-				notifyProgress(height, chainHeight);
+					stateHash = execute(*pBlockElement);
+					notifyProgress(height, chainHeight);
 
-				pParentBlockElement = std::move(pBlockElement);
-				height = height + Height(1);
+					pParentBlockElement = std::move(pBlockElement);
+					height = height + Height(1);
+				}
 			}
 
 			if (chainHeight >= m_startHeight) {
@@ -58,6 +58,13 @@ namespace catapult { namespace local {
 				return m_storage.loadBlockElement(height);
 			}
 
+			std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(
+					Height height,
+					size_t maxBlocks,
+					size_t maxBytes) const override {
+				return m_storage.loadBlockElements(height, maxBlocks, maxBytes);
+			}
+
 			std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override {
 				return m_storage.loadBlockStatementData(height);
 			}
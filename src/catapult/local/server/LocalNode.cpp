@@ -25,6 +25,8 @@
 #include "NodeContainerSubscriberAdapter.h"
 #include "NodeUtils.h"
 #include "StaticNodeRefreshService.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "catapult/cache_db/RocksWriteQueue.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/CommitStepHandler.h"
 #include "catapult/extensions/ConfigurationUtils.h"
@@ -38,7 +40,9 @@
 #include "catapult/io/FileQueue.h"
 #include "catapult/ionet/NodeContainer.h"
 #include "catapult/local/HostUtils.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/range/irange.hpp>
 
 namespace catapult { namespace local {
 
@@ -81,6 +85,107 @@ namespace catapult { namespace local {
 			});
 		}
 
+		void AddBlockStorageCounters(std::vector<utils::DiagnosticCounter>& counters, const io::BlockStorageCache& storage) {
+			counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE HIT"), [&storage]() {
+				return storage.statistics().NumHits;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE MISS"), [&storage]() {
+				return storage.statistics().NumMisses;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE SIZE"), [&storage]() {
+				return storage.statistics().Size;
+			});
+		}
+
+		void AddDurationHistogramCounters(
+				std::vector<utils::DiagnosticCounter>& counters,
+				const std::string& prefix,
+				const utils::DurationHistogram& histogram) {
+			static constexpr std::array<const char*, utils::DurationHistogram::Num_Buckets> Bucket_Names{{
+				"LT TEN MS", "LT HUN MS", "LT ONE S", "GE ONE S"
+			}};
+
+			for (auto i = 0u; i < Bucket_Names.size(); ++i) {
+				counters.emplace_back(utils::DiagnosticCounterId(prefix + " " + Bucket_Names[i]), [&histogram, i]() {
+					return histogram.bucket(i);
+				});
+			}
+
+			counters.emplace_back(utils::DiagnosticCounterId(prefix + " MAX MS"), [&histogram]() {
+				return histogram.maxMillis();
+			});
+		}
+
+		void AddCacheCommitCounters(std::vector<utils::DiagnosticCounter>& counters, const cache::CatapultCache& catapultCache) {
+			AddDurationHistogramCounters(counters, "CMT", catapultCache.commitDurations());
+			AddDurationHistogramCounters(counters, "LCK", catapultCache.commitLockDurations());
+		}
+
+		utils::ParallelRunner CreateParallelRunner(thread::IoThreadPool& pool) {
+			return [&pool](auto count, const auto& callback) {
+				auto indexes = boost::irange<size_t>(0, count);
+				auto indexCallback = [&callback](auto index, auto) {
+					callback(index);
+					return true;
+				};
+
+				// runner is never invoked from its own pool, so it is safe to block
+				thread::ParallelFor(pool.ioContext(), indexes, pool.numWorkerThreads(), indexCallback).get();
+			};
+		}
+
+		void AddPatriciaTreeNodeCacheCounters(
+				std::vector<utils::DiagnosticCounter>& counters,
+				const cache::PatriciaTreeNodeCache* pNodeCache) {
+			if (!pNodeCache)
+				return;
+
+			counters.emplace_back(utils::DiagnosticCounterId("PTREE HIT"), [pNodeCache]() {
+				return pNodeCache->statistics().NumHits;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("PTREE MISS"), [pNodeCache]() {
+				return pNodeCache->statistics().NumMisses;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("PTREE SIZE"), [pNodeCache]() {
+				return pNodeCache->statistics().Size;
+			});
+		}
+
+		void AddCacheDatabaseCounters(std::vector<utils::DiagnosticCounter>& counters, const cache::RocksSharedResources* pResources) {
+			if (!pResources)
+				return;
+
+			counters.emplace_back(utils::DiagnosticCounterId("RDB CACHE HIT"), [pResources]() {
+				return pResources->collectStatistics().NumBlockCacheHits;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("RDB CACHE MIS"), [pResources]() {
+				return pResources->collectStatistics().NumBlockCacheMisses;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("RDB CACHE KB"), [pResources]() {
+				return pResources->collectStatistics().BlockCacheUsage / 1024;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("RDB STALL MS"), [pResources]() {
+				return pResources->collectStatistics().StallMicros / 1000;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("RDB READ KB"), [pResources]() {
+				return pResources->collectStatistics().NumBytesRead / 1024;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("RDB CMPCT KB"), [pResources]() {
+				return pResources->collectStatistics().NumCompactionBytesWritten / 1024;
+			});
+		}
+
+		void AddCacheDatabaseWriteQueueCounters(
+				std::vector<utils::DiagnosticCounter>& counters,
+				const cache::RocksWriteQueue* pWriteQueue) {
+			if (!pWriteQueue)
+				return;
+
+			counters.emplace_back(utils::DiagnosticCounterId("RDB WRITE Q"), [pWriteQueue]() {
+				return pWriteQueue->numPendingOperations();
+			});
+		}
+
 		class DefaultLocalNode final : public LocalNode {
 		public:
 			DefaultLocalNode(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper, const config::CatapultKeys& keys)
@@ -96,7 +201,8 @@ namespace catapult { namespace local {
 					, m_catapultCache({}) // note that sub caches are added in boot
 					, m_storage(
 							m_pBootstrapper->subscriptionManager().createBlockStorage(m_pBlockChangeSubscriber),
-							CreateStagingBlockStorage(m_dataDirectory))
+							CreateStagingBlockStorage(m_dataDirectory),
+							m_config.Node.MaxCachedBlockElements)
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(extensions::GetUtCacheOptions(m_config.Node)))
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pStateChangeSubscriber(CreateStateChangeSubscriber(
@@ -125,6 +231,11 @@ namespace catapult { namespace local {
 
 				CATAPULT_LOG(debug) << "initializing cache";
 				m_catapultCache = m_pluginManager.createCache();
+				// sub cache work blocks on subtree work, so each needs its own pool to prevent deadlocks
+				auto subCacheRunner = CreateParallelRunner(*m_pBootstrapper->pool().pushIsolatedPool("cache"));
+				auto subtreeRunner = CreateParallelRunner(*m_pBootstrapper->pool().pushIsolatedPool("cache subtree"));
+				m_catapultCache.setCommitRunner(subCacheRunner);
+				m_catapultCache.setStateHashRunners({ subCacheRunner, subtreeRunner });
 
 				CATAPULT_LOG(debug) << "registering counters";
 				registerCounters();
@@ -133,6 +244,9 @@ namespace catapult { namespace local {
 				auto isFirstBoot = executeAndNotifyNemesis();
 				loadStateFromDisk();
 
+				if (m_config.Node.EnablePatriciaTreeWarmStart)
+					warmStartPatriciaTrees(subCacheRunner);
+
 				CATAPULT_LOG(debug) << "booting extension services";
 				auto& extensionManager = m_pBootstrapper->extensionManager();
 				extensionManager.addServiceRegistrar(CreateStaticNodeRefreshServiceRegistrar(m_pBootstrapper->staticNodes()));
@@ -179,6 +293,11 @@ namespace catapult { namespace local {
 				});
 
 				AddNodeCounters(m_counters, m_nodes);
+				AddBlockStorageCounters(m_counters, m_storage);
+				AddPatriciaTreeNodeCacheCounters(m_counters, m_pluginManager.patriciaTreeNodeCache());
+				AddCacheDatabaseCounters(m_counters, m_pluginManager.cacheDatabaseResources());
+				AddCacheDatabaseWriteQueueCounters(m_counters, m_pluginManager.cacheDatabaseWriteQueue());
+				AddCacheCommitCounters(m_counters, m_catapultCache);
 			}
 
 			bool executeAndNotifyNemesis() {
@@ -194,7 +313,9 @@ namespace catapult { namespace local {
 				notifier.raise(*m_pStateChangeSubscriber);
 
 				// indicate the nemesis block is fully updated so that it can be processed downstream immediately
-				auto commitStep = extensions::CreateCommitStepHandler(m_dataDirectory);
+				auto commitStep = extensions::CreateCommitStepHandler(
+						m_dataDirectory,
+						extensions::CreateStateDurabilityBarrier(m_pluginManager));
 				commitStep(consumers::CommitOperationStep::All_Updated);
 
 				// skip next *two* messages because subscriber creates two files during raise (score change and state change)
@@ -204,6 +325,16 @@ namespace catapult { namespace local {
 				return true;
 			}
 
+			void warmStartPatriciaTrees(const utils::ParallelRunner& runner) {
+				auto* pNodeCache = m_pluginManager.patriciaTreeNodeCache();
+				if (!pNodeCache)
+					return;
+
+				utils::StackLogger stackLogger("warming up patricia trees", utils::LogLevel::Info);
+				auto numLoadedNodes = pNodeCache->warmStart(runner);
+				CATAPULT_LOG(info) << "loaded " << numLoadedNodes << " patricia tree nodes into memory";
+			}
+
 			void loadStateFromDisk() {
 				auto heights = extensions::LoadStateFromDirectory(m_dataDirectory.dir("state"), stateRef(), m_pluginManager);
 
@@ -41,7 +41,14 @@ namespace catapult { namespace model {
 	// region hashes
 
 	void CalculateBlockTransactionsHash(const std::vector<const TransactionInfo*>& transactionInfos, Hash256& blockTransactionsHash) {
-		crypto::MerkleHashBuilder builder;
+		CalculateBlockTransactionsHash(transactionInfos, utils::PartitionRunner(), blockTransactionsHash);
+	}
+
+	void CalculateBlockTransactionsHash(
+			const std::vector<const TransactionInfo*>& transactionInfos,
+			const utils::PartitionRunner& partitionRunner,
+			Hash256& blockTransactionsHash) {
+		crypto::MerkleHashBuilder builder(transactionInfos.size(), partitionRunner);
 		for (const auto* pTransactionInfo : transactionInfos)
 			builder.update(pTransactionInfo->MerkleComponentHash);
 
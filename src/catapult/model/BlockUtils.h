@@ -22,6 +22,7 @@
 #include "Block.h"
 #include "Elements.h"
 #include "EntityInfo.h"
+#include "catapult/crypto/MerkleHashBuilder.h"
 
 namespace catapult { namespace crypto { class KeyPair; } }
 
@@ -32,6 +33,13 @@ namespace catapult { namespace model {
 	/// Calculates the block transactions hash of \a transactionInfos into \a blockTransactionsHash.
 	void CalculateBlockTransactionsHash(const std::vector<const TransactionInfo*>& transactionInfos, Hash256& blockTransactionsHash);
 
+	/// Calculates the block transactions hash of \a transactionInfos into \a blockTransactionsHash
+	/// using \a partitionRunner to hash large merkle tree levels.
+	void CalculateBlockTransactionsHash(
+			const std::vector<const TransactionInfo*>& transactionInfos,
+			const utils::PartitionRunner& partitionRunner,
+			Hash256& blockTransactionsHash);
+
 	/// Calculates the generation hash from \a gamma.
 	GenerationHash CalculateGenerationHash(const crypto::ProofGamma& gamma);
 
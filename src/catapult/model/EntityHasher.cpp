@@ -106,4 +106,42 @@ namespace catapult { namespace model {
 				transactionElement.EntityHash,
 				transactionRegistry);
 	}
+
+	TransactionHashesBuilder::TransactionHashesBuilder(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed)
+			: m_transactionRegistry(transactionRegistry)
+			, m_generationHashSeed(generationHashSeed)
+	{}
+
+	void TransactionHashesBuilder::update(TransactionElement& transactionElement) {
+		const auto& transaction = transactionElement.Transaction;
+		const auto& plugin = *m_transactionRegistry.findPlugin(transaction.Type);
+
+		// add full signature and public key (this is different than Sign/Verify)
+		m_entityHashesBuilder.add(
+				{ transaction.Signature, transaction.SignerPublicKey, m_generationHashSeed, plugin.dataBuffer(transaction) },
+				transactionElement.EntityHash);
+		m_pendingElements.push_back({ &transactionElement, plugin.merkleSupplementaryBuffers(transaction) });
+	}
+
+	void TransactionHashesBuilder::final() {
+		m_entityHashesBuilder.final();
+
+		// merkle component hashes depend on entity hashes, so they need to be calculated in a second pass
+		for (const auto& pendingElement : m_pendingElements) {
+			auto& transactionElement = *pendingElement.pTransactionElement;
+			if (pendingElement.SupplementaryBuffers.empty()) {
+				transactionElement.MerkleComponentHash = transactionElement.EntityHash;
+				continue;
+			}
+
+			m_merkleComponentHashesBuilder.add({ transactionElement.EntityHash }, transactionElement.MerkleComponentHash);
+			for (const auto& supplementaryBuffer : pendingElement.SupplementaryBuffers)
+				m_merkleComponentHashesBuilder.append(supplementaryBuffer);
+		}
+
+		m_merkleComponentHashesBuilder.final();
+		m_pendingElements.clear();
+	}
 }}
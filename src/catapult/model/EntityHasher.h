@@ -20,6 +20,7 @@
 
 #pragma once
 #include "Block.h"
+#include "catapult/crypto/MultiBufferHashes.h"
 
 namespace catapult {
 	namespace model {
@@ -56,4 +57,33 @@ namespace catapult { namespace model {
 				const TransactionRegistry& transactionRegistry,
 				const GenerationHashSeed& generationHashSeed,
 				TransactionElement& transactionElement);
+
+	/// Builder for calculating the hashes of multiple transaction elements together.
+	class TransactionHashesBuilder {
+	public:
+		/// Creates a builder for the network with the specified generation hash seed (\a generationHashSeed)
+		/// using transaction information from \a transactionRegistry.
+		TransactionHashesBuilder(const TransactionRegistry& transactionRegistry, const GenerationHashSeed& generationHashSeed);
+
+	public:
+		/// Adds \a transactionElement, whose hashes will be calculated in place when the builder is finalized.
+		/// \note \a transactionElement must remain valid until final is called.
+		void update(TransactionElement& transactionElement);
+
+		/// Calculates the hashes of all added transaction elements (equivalent to calling UpdateHashes for each one).
+		void final();
+
+	private:
+		struct PendingElement {
+			TransactionElement* pTransactionElement;
+			std::vector<RawBuffer> SupplementaryBuffers;
+		};
+
+	private:
+		const TransactionRegistry& m_transactionRegistry;
+		GenerationHashSeed m_generationHashSeed;
+		std::vector<PendingElement> m_pendingElements;
+		crypto::Sha3_256_MultiBuilder m_entityHashesBuilder;
+		crypto::Sha3_256_MultiBuilder m_merkleComponentHashesBuilder;
+	};
 }}
@@ -19,10 +19,31 @@
 **/
 
 #include "PluginManager.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "catapult/cache_db/RocksWriteQueue.h"
 #include <boost/filesystem/path.hpp>
 
 namespace catapult { namespace plugins {
 
+	namespace {
+		std::shared_ptr<const cache::RocksTuningSettings> CreateCacheDatabaseTuning(const StorageConfiguration& storageConfig) {
+			auto pTuning = std::make_shared<cache::RocksTuningSettings>(storageConfig.CacheDatabaseTuning);
+			if (!storageConfig.PreferCacheDatabase)
+				return pTuning;
+
+			if (0 != storageConfig.CacheDatabaseBlockCacheSize.bytes() || storageConfig.EnableCacheDatabaseStatistics) {
+				pTuning->pSharedResources = std::make_shared<cache::RocksSharedResources>(
+						storageConfig.CacheDatabaseBlockCacheSize,
+						storageConfig.EnableCacheDatabaseStatistics);
+			}
+
+			if (0 != storageConfig.MaxPendingCacheDatabaseWriteBatches)
+				pTuning->pWriteQueue = std::make_shared<cache::RocksWriteQueue>(storageConfig.MaxPendingCacheDatabaseWriteBatches);
+
+			return pTuning;
+		}
+	}
+
 	PluginManager::PluginManager(
 			const model::BlockChainConfiguration& config,
 			const StorageConfiguration& storageConfig,
@@ -32,6 +53,13 @@ namespace catapult { namespace plugins {
 			, m_storageConfig(storageConfig)
 			, m_userConfig(userConfig)
 			, m_inflationConfig(inflationConfig)
+			, m_pPatriciaTreeNodeCache(
+					m_storageConfig.PreferCacheDatabase
+							&& m_config.EnableVerifiableState
+							&& 0 != m_storageConfig.MaxCachedPatriciaTreeNodes
+							? std::make_shared<cache::PatriciaTreeNodeCache>(m_storageConfig.MaxCachedPatriciaTreeNodes)
+							: nullptr)
+			, m_pCacheDatabaseTuning(CreateCacheDatabaseTuning(m_storageConfig))
 	{}
 
 	// region config
@@ -56,10 +84,29 @@ namespace catapult { namespace plugins {
 		if (!m_storageConfig.PreferCacheDatabase)
 			return cache::CacheConfiguration();
 
-		return cache::CacheConfiguration(
+		auto cacheConfig = cache::CacheConfiguration(
 				(boost::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
 				m_storageConfig.MaxCacheDatabaseWriteBatchSize,
 				m_config.EnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled);
+		cacheConfig.pPatriciaTreeNodeCache = m_pPatriciaTreeNodeCache;
+		cacheConfig.pDatabaseTuning = m_pCacheDatabaseTuning;
+		return cacheConfig;
+	}
+
+	const cache::PatriciaTreeNodeCache* PluginManager::patriciaTreeNodeCache() const {
+		return m_pPatriciaTreeNodeCache.get();
+	}
+
+	cache::PatriciaTreeNodeCache* PluginManager::patriciaTreeNodeCache() {
+		return m_pPatriciaTreeNodeCache.get();
+	}
+
+	const cache::RocksSharedResources* PluginManager::cacheDatabaseResources() const {
+		return m_pCacheDatabaseTuning->pSharedResources.get();
+	}
+
+	cache::RocksWriteQueue* PluginManager::cacheDatabaseWriteQueue() const {
+		return m_pCacheDatabaseTuning->pWriteQueue.get();
 	}
 
 	// endregion
@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/cache/CacheConfiguration.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/cache_db/RocksTuning.h"
 #include "catapult/config/InflationConfiguration.h"
 #include "catapult/config/UserConfiguration.h"
 #include "catapult/ionet/PacketHandlers.h"
@@ -46,6 +47,23 @@ namespace catapult { namespace plugins {
 
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
+
+		/// Maximum number of recently used patricia tree nodes to cache in memory.
+		size_t MaxCachedPatriciaTreeNodes = 0;
+
+		/// Size of the block cache shared by all cache databases (\c 0 to use a private default block cache per column).
+		utils::FileSize CacheDatabaseBlockCacheSize;
+
+		/// \c true if statistics should be collected for all cache databases.
+		bool EnableCacheDatabaseStatistics = false;
+
+		/// Maximum number of flushed cache database batches that are queued for writing in the background
+		/// (\c 0 to write batches synchronously).
+		size_t MaxPendingCacheDatabaseWriteBatches = 0;
+
+		/// Cache database tuning settings.
+		/// \note Shared resources are created by the plugin manager.
+		cache::RocksTuningSettings CacheDatabaseTuning;
 	};
 
 	/// Manager for registering plugins.
@@ -99,6 +117,19 @@ namespace catapult { namespace plugins {
 		/// Gets the cache configuration for cache with \a name.
 		cache::CacheConfiguration cacheConfig(const std::string& name) const;
 
+		/// Gets the patricia tree node cache shared by all caches or \c nullptr if patricia tree nodes are not cached.
+		const cache::PatriciaTreeNodeCache* patriciaTreeNodeCache() const;
+
+		/// Gets the patricia tree node cache shared by all caches or \c nullptr if patricia tree nodes are not cached.
+		cache::PatriciaTreeNodeCache* patriciaTreeNodeCache();
+
+		/// Gets the resources shared by all cache databases or \c nullptr if there are none.
+		const cache::RocksSharedResources* cacheDatabaseResources() const;
+
+		/// Gets the queue used by all cache databases to write batches in the background
+		/// or \c nullptr if batches are written synchronously.
+		cache::RocksWriteQueue* cacheDatabaseWriteQueue() const;
+
 		// endregion
 
 		// region transactions
@@ -216,6 +247,8 @@ namespace catapult { namespace plugins {
 		StorageConfiguration m_storageConfig;
 		config::UserConfiguration m_userConfig;
 		config::InflationConfiguration m_inflationConfig;
+		std::shared_ptr<cache::PatriciaTreeNodeCache> m_pPatriciaTreeNodeCache;
+		std::shared_ptr<const cache::RocksTuningSettings> m_pCacheDatabaseTuning;
 		model::TransactionRegistry m_transactionRegistry;
 		cache::CatapultCacheBuilder m_cacheBuilder;
 
@@ -34,7 +34,11 @@ namespace catapult { namespace subscribers {
 
 	SubscriptionManager::SubscriptionManager(const config::CatapultConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBlockStorage>(m_config.User.DataDirectory)) {
+			, m_pStorage(io::CreateFileBlockStorage(
+					m_config.User.DataDirectory,
+					m_config.Node.EnablePackedBlockStorage
+							? io::FileBlockStorageLayout::Pack
+							: io::FileBlockStorageLayout::File_Per_Block)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
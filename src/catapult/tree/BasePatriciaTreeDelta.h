@@ -71,12 +71,24 @@ namespace catapult { namespace tree {
 			return m_tree.set(key, value);
 		}
 
+		/// Sets the values associated with keys in the tree for all key value pairs pointed to by \a pairPointers.
+		template<typename TPairPointers>
+		void setAll(const TPairPointers& pairPointers) {
+			m_tree.setAll(pairPointers);
+		}
+
 		/// Removes the value associated with \a key from the tree.
 		bool unset(const KeyType& key) {
 			return m_tree.unset(key);
 		}
 
 	public:
+		/// Calculates the hashes of all modified nodes by using \a runner to hash disjoint subtrees.
+		template<typename TRunner>
+		void hashAll(const TRunner& runner) {
+			m_tree.hashAll(runner);
+		}
+
 		/// Marks all nodes reachable at this point.
 		void setCheckpoint() {
 			m_tree.saveAll();
@@ -20,6 +20,8 @@
 
 #pragma once
 #include "TreeNode.h"
+#include <algorithm>
+#include <vector>
 
 namespace catapult { namespace tree {
 
@@ -151,6 +153,185 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region setAll
+
+	public:
+		/// Sets the values associated with keys in the tree for all key value pairs pointed to by \a pairPointers.
+		/// \note This is equivalent to calling set for each pair, but each modified branch node is only copied once
+		///        and each new leaf node is only hashed once, irrespective of the number of pairs below it.
+		template<typename TPairPointers>
+		void setAll(const TPairPointers& pairPointers) {
+			std::vector<PathValuePair> pairs;
+			pairs.reserve(pairPointers.size());
+			for (const auto* pPair : pairPointers)
+				pairs.push_back({ TreeNodePath(TEncoder::EncodeKey(pPair->first)), TEncoder::EncodeValue(pPair->second) });
+
+			if (pairs.empty())
+				return;
+
+			// sort pairs by path so that all pairs below any node form a contiguous range; when a key is set multiple times,
+			// the stable sort preserves the original order, so the last value is the one that needs to be kept
+			std::stable_sort(pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) {
+				return ComparePaths(lhs.Path, rhs.Path) < 0;
+			});
+
+			auto lastUniqueIter = pairs.begin();
+			for (auto iter = pairs.begin() + 1; pairs.end() != iter; ++iter) {
+				if (lastUniqueIter->Path != iter->Path)
+					++lastUniqueIter;
+
+				if (lastUniqueIter != iter)
+					*lastUniqueIter = std::move(*iter);
+			}
+
+			pairs.erase(lastUniqueIter + 1, pairs.end());
+			m_rootNode = setAll(m_rootNode, { pairs.cbegin(), pairs.cend(), 0 });
+		}
+
+	private:
+		struct PathValuePair {
+			TreeNodePath Path;
+			Hash256 Value;
+		};
+
+		// sorted range of pairs that share the first Offset nibbles
+		struct PathValuePairRange {
+			typename std::vector<PathValuePair>::const_iterator Begin;
+			typename std::vector<PathValuePair>::const_iterator End;
+			size_t Offset;
+		};
+
+	private:
+		static int ComparePaths(const TreeNodePath& lhs, const TreeNodePath& rhs) {
+			auto size = std::min(lhs.size(), rhs.size());
+			for (auto i = 0u; i < size; ++i) {
+				if (lhs.nibbleAt(i) != rhs.nibbleAt(i))
+					return lhs.nibbleAt(i) < rhs.nibbleAt(i) ? -1 : 1;
+			}
+
+			return lhs.size() == rhs.size() ? 0 : (lhs.size() < rhs.size() ? -1 : 1);
+		}
+
+		// gets the number of nibbles shared by all pairs in a sorted range after its offset
+		static size_t FindSharedPathSize(const PathValuePairRange& range) {
+			const auto& firstPath = range.Begin->Path;
+			const auto& lastPath = (range.End - 1)->Path;
+			auto size = std::min(firstPath.size(), lastPath.size());
+
+			auto i = range.Offset;
+			while (i < size && firstPath.nibbleAt(i) == lastPath.nibbleAt(i))
+				++i;
+
+			return i - range.Offset;
+		}
+
+		// gets the number of nibbles shared by \a path and all pairs in a sorted range after its offset
+		static size_t FindSharedPathSize(const TreeNodePath& path, const PathValuePairRange& range) {
+			// in a sorted range, the pairs sharing the fewest nibbles with any path are the first and the last
+			auto findSharedPathSize = [&path, offset = range.Offset](const auto& pairPath) {
+				auto i = 0u;
+				while (i < path.size() && offset + i < pairPath.size() && path.nibbleAt(i) == pairPath.nibbleAt(offset + i))
+					++i;
+
+				return i;
+			};
+
+			return std::min(findSharedPathSize(range.Begin->Path), findSharedPathSize((range.End - 1)->Path));
+		}
+
+		// calls \a action for each subrange of pairs with the same nibble at \a index
+		template<typename TAction>
+		static void ForEachNibbleRange(const PathValuePairRange& range, size_t index, TAction action) {
+			auto begin = range.Begin;
+			while (range.End != begin) {
+				auto nibble = begin->Path.nibbleAt(index);
+				auto end = std::find_if(begin, range.End, [index, nibble](const auto& pair) {
+					return nibble != pair.Path.nibbleAt(index);
+				});
+				action(nibble, PathValuePairRange{ begin, end, index + 1 });
+				begin = end;
+			}
+		}
+
+		TreeNode setAll(const TreeNode& node, const PathValuePairRange& range) {
+			if (1 == std::distance(range.Begin, range.End))
+				return set(node, { range.Begin->Path.subpath(range.Offset), range.Begin->Value });
+
+			if (node.empty())
+				return createSubtree(range);
+
+			if (node.isLeaf())
+				return setAll(node.asLeafNode(), range);
+
+			const auto& branchNode = node.asBranchNode();
+			const auto& branchPath = branchNode.path();
+			auto sharedPathSize = FindSharedPathSize(branchPath, range);
+			auto nibbleIndex = range.Offset + sharedPathSize;
+
+			// if the branch path is shared by all pairs, update all affected links of the (single) branch copy
+			if (sharedPathSize == branchPath.size()) {
+				auto updatedBranchNode = BranchTreeNode(branchNode);
+				ForEachNibbleRange(range, nibbleIndex, [this, &updatedBranchNode](auto nibble, const auto& nibbleRange) {
+					auto pNextNode = getLinkedNode(updatedBranchNode, nibble);
+					if (!pNextNode)
+						pNextNode = std::make_unique<TreeNode>();
+
+					setLink(updatedBranchNode, setAll(*pNextNode, nibbleRange), nibble);
+				});
+
+				return TreeNode(updatedBranchNode);
+			}
+
+			// otherwise, the branch needs to be split at the first difference
+			auto truncatedBranchNode = BranchTreeNode(branchNode);
+			auto branchLinkIndex = branchPath.nibbleAt(sharedPathSize);
+			truncatedBranchNode.setPath(branchPath.subpath(sharedPathSize + 1));
+
+			auto newBranchNode = BranchTreeNode(branchPath.subpath(0, sharedPathSize));
+			setLink(newBranchNode, truncatedBranchNode, branchLinkIndex);
+			ForEachNibbleRange(range, nibbleIndex, [this, &newBranchNode, &truncatedBranchNode, branchLinkIndex](
+					auto nibble,
+					const auto& nibbleRange) {
+				auto updatedNextNode = branchLinkIndex == nibble
+						? setAll(TreeNode(truncatedBranchNode), nibbleRange)
+						: createSubtree(nibbleRange);
+				setLink(newBranchNode, updatedNextNode, nibble);
+			});
+
+			return TreeNode(newBranchNode);
+		}
+
+		TreeNode setAll(const LeafTreeNode& leafNode, const PathValuePairRange& range) {
+			// merge the leaf into the pairs unless it is being replaced
+			auto leafPath = TreeNodePath::Join(range.Begin->Path.subpath(0, range.Offset), leafNode.path());
+			auto lowerBoundIter = std::lower_bound(range.Begin, range.End, leafPath, [](const auto& pair, const auto& path) {
+				return ComparePaths(pair.Path, path) < 0;
+			});
+
+			if (range.End != lowerBoundIter && lowerBoundIter->Path == leafPath)
+				return createSubtree(range);
+
+			std::vector<PathValuePair> pairs(range.Begin, lowerBoundIter);
+			pairs.push_back({ leafPath, leafNode.value() });
+			pairs.insert(pairs.end(), lowerBoundIter, range.End);
+			return createSubtree({ pairs.cbegin(), pairs.cend(), range.Offset });
+		}
+
+		TreeNode createSubtree(const PathValuePairRange& range) {
+			if (1 == std::distance(range.Begin, range.End))
+				return TreeNode(LeafTreeNode(range.Begin->Path.subpath(range.Offset), range.Begin->Value));
+
+			auto sharedPathSize = FindSharedPathSize(range);
+			auto branchNode = BranchTreeNode(range.Begin->Path.subpath(range.Offset, sharedPathSize));
+			ForEachNibbleRange(range, range.Offset + sharedPathSize, [this, &branchNode](auto nibble, const auto& nibbleRange) {
+				setLink(branchNode, createSubtree(nibbleRange), nibble);
+			});
+
+			return TreeNode(branchNode);
+		}
+
+		// endregion
+
 		// region unset
 
 	public:
@@ -279,6 +460,49 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region hashAll
+
+	public:
+		/// Number of levels below the root at which disjoint subtrees are hashed independently by hashAll.
+		/// \note This yields at most 256 subtrees.
+		static constexpr size_t Num_Parallel_Hash_Levels = 2;
+
+		/// Calculates the hashes of all in-memory tree nodes by using \a runner to hash disjoint subtrees.
+		/// \note \a runner is passed the number of subtrees and a callback that hashes the subtree at the passed index;
+		///       it can execute the callbacks concurrently because the subtrees do not share any nodes.
+		template<typename TRunner>
+		void hashAll(const TRunner& runner) {
+			std::vector<const TreeNode*> subtreeRoots;
+			CollectSubtreeRoots(m_rootNode, Num_Parallel_Hash_Levels, subtreeRoots);
+			if (subtreeRoots.size() > 1)
+				runner(subtreeRoots.size(), [&subtreeRoots](auto index) { subtreeRoots[index]->hash(); });
+
+			// all dirty subtrees have been hashed, so only the top levels remain
+			m_rootNode.hash();
+		}
+
+	private:
+		static void CollectSubtreeRoots(const TreeNode& node, size_t numLevels, std::vector<const TreeNode*>& subtreeRoots) {
+			// leaf hashes are calculated eagerly, so only branches need to be hashed
+			if (!node.isBranch())
+				return;
+
+			if (0 == numLevels) {
+				subtreeRoots.push_back(&node);
+				return;
+			}
+
+			// only in-memory nodes can be dirty; nodes loaded on demand from the data source are already hashed
+			const auto& branchNode = node.asBranchNode();
+			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+				const auto* pLinkedNode = branchNode.linkedNodePointer(i);
+				if (pLinkedNode)
+					CollectSubtreeRoots(*pLinkedNode, numLevels - 1, subtreeRoots);
+			}
+		}
+
+		// endregion
+
 		// region saveAll
 
 	public:
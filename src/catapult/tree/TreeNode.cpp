@@ -109,6 +109,10 @@ namespace catapult { namespace tree {
 		return pLinkedNode ? std::make_unique<TreeNode>(pLinkedNode->copy()) : nullptr;
 	}
 
+	const TreeNode* BranchTreeNode::linkedNodePointer(size_t index) const {
+		return m_linkedNodes[index].get();
+	}
+
 	uint8_t BranchTreeNode::highestLinkIndex() const {
 		return static_cast<uint8_t>(utils::Log2(m_linkSet.to_ulong()));
 	}
@@ -82,6 +82,10 @@ namespace catapult { namespace tree {
 		/// Gets a copy of the linked node at \a index or \c nullptr if no linked node is present.
 		std::unique_ptr<const TreeNode> linkedNode(size_t index) const;
 
+		/// Gets a pointer to the (shared) linked node at \a index or \c nullptr if no linked node is present.
+		/// \note Unlike linkedNode, this does not copy the linked node.
+		const TreeNode* linkedNodePointer(size_t index) const;
+
 		/// Gets the index of the highest set link.
 		uint8_t highestLinkIndex() const;
 
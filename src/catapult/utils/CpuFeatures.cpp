@@ -0,0 +1,81 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CpuFeatures.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace catapult { namespace utils {
+
+	namespace {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		bool IsSupported(CpuFeature feature) {
+			int registers[4];
+			__cpuid(registers, 0);
+			if (registers[0] < 7)
+				return false;
+
+			// check that the operating system saves the extended registers (osxsave + xgetbv)
+			__cpuid(registers, 1);
+			if (0 == (registers[2] & (1 << 27)))
+				return false;
+
+			auto xcr0 = _xgetbv(0);
+			__cpuidex(registers, 7, 0);
+			switch (feature) {
+			case CpuFeature::Avx2:
+				return 0x06 == (xcr0 & 0x06) && 0 != (registers[1] & (1 << 5));
+
+			case CpuFeature::Avx512:
+				return 0xE6 == (xcr0 & 0xE6) && 0 != (registers[1] & (1 << 16));
+			}
+
+			return false;
+		}
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+		bool IsSupported(CpuFeature feature) {
+			// __builtin_cpu_supports checks both cpuid and xgetbv
+			__builtin_cpu_init();
+			switch (feature) {
+			case CpuFeature::Avx2:
+				return __builtin_cpu_supports("avx2");
+
+			case CpuFeature::Avx512:
+				return __builtin_cpu_supports("avx512f");
+			}
+
+			return false;
+		}
+#else
+		bool IsSupported(CpuFeature) {
+			return false;
+		}
+#endif
+	}
+
+	bool IsCpuFeatureSupported(CpuFeature feature) {
+		static const bool Is_Avx2_Supported = IsSupported(CpuFeature::Avx2);
+		static const bool Is_Avx512_Supported = IsSupported(CpuFeature::Avx512);
+		return CpuFeature::Avx2 == feature ? Is_Avx2_Supported : Is_Avx512_Supported;
+	}
+}}
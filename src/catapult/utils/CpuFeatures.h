@@ -0,0 +1,36 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+
+namespace catapult { namespace utils {
+
+	/// Instruction set extensions that can be detected at runtime.
+	enum class CpuFeature {
+		/// Advanced vector extensions 2 (256-bit integer vectors).
+		Avx2,
+
+		/// Advanced vector extensions 512 foundation (512-bit integer vectors).
+		Avx512
+	};
+
+	/// Returns \c true if \a feature is supported by both the current cpu and operating system.
+	bool IsCpuFeatureSupported(CpuFeature feature);
+}}
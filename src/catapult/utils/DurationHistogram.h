@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Thread safe histogram of durations (in milliseconds) with power of ten bucket boundaries.
+	class DurationHistogram {
+	public:
+		/// Number of buckets.
+		static constexpr size_t Num_Buckets = 4;
+
+		/// Exclusive upper bounds (in milliseconds) of all buckets except the last one, which is unbounded.
+		static constexpr std::array<uint64_t, Num_Buckets - 1> Bucket_Upper_Bounds{{ 10, 100, 1000 }};
+
+	public:
+		/// Creates an empty histogram.
+		DurationHistogram() : m_buckets(), m_maxMillis(0)
+		{}
+
+	public:
+		/// Gets the number of durations that were added to bucket \a index.
+		uint64_t bucket(size_t index) const {
+			return m_buckets[index];
+		}
+
+		/// Gets the total number of added durations.
+		uint64_t count() const {
+			uint64_t count = 0;
+			for (const auto& bucket : m_buckets)
+				count += bucket;
+
+			return count;
+		}
+
+		/// Gets the longest added duration.
+		uint64_t maxMillis() const {
+			return m_maxMillis;
+		}
+
+	public:
+		/// Adds a duration of \a millis milliseconds.
+		void add(uint64_t millis) {
+			size_t index = 0;
+			while (index < Bucket_Upper_Bounds.size() && millis >= Bucket_Upper_Bounds[index])
+				++index;
+
+			++m_buckets[index];
+
+			// on failure, compare_exchange_weak reloads the current max, so the loop ends once max is at least millis
+			auto maxMillis = m_maxMillis.load();
+			while (maxMillis < millis) {
+				if (m_maxMillis.compare_exchange_weak(maxMillis, millis))
+					break;
+			}
+		}
+
+	private:
+		std::array<std::atomic<uint64_t>, Num_Buckets> m_buckets;
+		std::atomic<uint64_t> m_maxMillis;
+	};
+}}
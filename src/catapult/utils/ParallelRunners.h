@@ -0,0 +1,33 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/functions.h"
+#include <stddef.h>
+
+namespace catapult { namespace utils {
+
+	/// Runner that invokes a callback once for each index in [0, count), possibly concurrently, and returns after all calls complete.
+	using ParallelRunner = consumer<size_t, const consumer<size_t>&>;
+
+	/// Runner that calls a work callback for (start index, count) partitions covering the first \a count work items (possibly in parallel)
+	/// and returns after all partitions have been processed.
+	using PartitionRunner = consumer<size_t, const consumer<size_t, size_t>&>;
+}}
@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ShortHash.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		void SortUnique(std::vector<ShortHash>& shortHashes) {
+			std::sort(shortHashes.begin(), shortHashes.end());
+			shortHashes.erase(std::unique(shortHashes.begin(), shortHashes.end()), shortHashes.end());
+		}
+	}
+
+	ShortHashesSet::ShortHashesSet(std::initializer_list<ShortHash> shortHashes) : ShortHashesSet(std::vector<ShortHash>(shortHashes))
+	{}
+
+	ShortHashesSet::ShortHashesSet(std::vector<ShortHash>&& shortHashes) : m_shortHashes(std::move(shortHashes)) {
+		SortUnique(m_shortHashes);
+	}
+
+	size_t ShortHashesSet::size() const {
+		return m_shortHashes.size();
+	}
+
+	bool ShortHashesSet::empty() const {
+		return m_shortHashes.empty();
+	}
+
+	std::vector<ShortHash>::const_iterator ShortHashesSet::begin() const {
+		return m_shortHashes.cbegin();
+	}
+
+	std::vector<ShortHash>::const_iterator ShortHashesSet::end() const {
+		return m_shortHashes.cend();
+	}
+
+	size_t ShortHashesSet::find(ShortHash shortHash) const {
+		if (m_shortHashes.empty())
+			return Npos;
+
+		// branchless binary search: the loop count only depends on the set size and the comparison result
+		// only selects the next base, so probes are not penalized by mispredicted branches on random short hashes
+		const auto* pBase = m_shortHashes.data();
+		auto count = m_shortHashes.size();
+		while (count > 1) {
+			auto half = count / 2;
+			pBase = pBase[half] <= shortHash ? pBase + half : pBase;
+			count -= half;
+		}
+
+		return *pBase == shortHash ? static_cast<size_t>(pBase - m_shortHashes.data()) : Npos;
+	}
+
+	bool ShortHashesSet::contains(ShortHash shortHash) const {
+		return Npos != find(shortHash);
+	}
+
+	bool ShortHashesSet::operator==(const ShortHashesSet& rhs) const {
+		return m_shortHashes == rhs.m_shortHashes;
+	}
+
+	bool ShortHashesSet::operator!=(const ShortHashesSet& rhs) const {
+		return !(*this == rhs);
+	}
+}}
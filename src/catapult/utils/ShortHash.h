@@ -21,7 +21,9 @@
 #pragma once
 #include "BaseValue.h"
 #include "catapult/types.h"
-#include <unordered_set>
+#include <initializer_list>
+#include <limits>
+#include <vector>
 
 namespace catapult { namespace utils {
 
@@ -35,8 +37,53 @@ namespace catapult { namespace utils {
 		}
 	};
 
-	/// Unordered set of short hashes.
-	using ShortHashesSet = std::unordered_set<ShortHash, ShortHashHasher>;
+	/// Immutable set of short hashes stored in a sorted contiguous array.
+	/// \note This is optimized for probing a single (peer provided) set with many short hashes.
+	class ShortHashesSet {
+	public:
+		/// Position returned when a short hash is not contained in the set.
+		static constexpr size_t Npos = std::numeric_limits<size_t>::max();
+
+	public:
+		/// Creates an empty set.
+		ShortHashesSet() = default;
+
+		/// Creates a set around \a shortHashes.
+		ShortHashesSet(std::initializer_list<ShortHash> shortHashes);
+
+		/// Creates a set around \a shortHashes.
+		explicit ShortHashesSet(std::vector<ShortHash>&& shortHashes);
+
+	public:
+		/// Gets the number of short hashes in the set.
+		size_t size() const;
+
+		/// Returns \c true if the set is empty.
+		bool empty() const;
+
+		/// Gets a const iterator to the first (smallest) short hash.
+		std::vector<ShortHash>::const_iterator begin() const;
+
+		/// Gets a const iterator to one past the last (largest) short hash.
+		std::vector<ShortHash>::const_iterator end() const;
+
+	public:
+		/// Gets the position of \a shortHash in sorted order or Npos if it is not contained in the set.
+		size_t find(ShortHash shortHash) const;
+
+		/// Returns \c true if \a shortHash is contained in the set.
+		bool contains(ShortHash shortHash) const;
+
+	public:
+		/// Returns \c true if this set is equal to \a rhs.
+		bool operator==(const ShortHashesSet& rhs) const;
+
+		/// Returns \c true if this set is not equal to \a rhs.
+		bool operator!=(const ShortHashesSet& rhs) const;
+
+	private:
+		std::vector<ShortHash> m_shortHashes;
+	};
 
 	/// Gets the short hash corresponding to \a hash.
 	inline ShortHash ToShortHash(const Hash256& hash) {
@@ -0,0 +1,225 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/TransactionDataContainer.h"
+#include "catapult/utils/Hashers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		// region transaction infos
+
+		std::vector<model::TransactionInfo> CreateTransactionInfos(size_t count) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			transactionInfos.reserve(count);
+			for (auto i = 0u; i < count; ++i) {
+				auto pTransaction = std::make_shared<model::Transaction>();
+				pTransaction->Size = sizeof(model::Transaction);
+				pTransaction->MaxFee = Amount(bench::Random() % 1'000'000);
+
+				auto transactionInfo = model::TransactionInfo(pTransaction);
+				bench::FillWithRandomData(transactionInfo.EntityHash);
+				transactionInfos.push_back(std::move(transactionInfo));
+			}
+
+			return transactionInfos;
+		}
+
+		const std::vector<model::TransactionInfo>& GetTransactionInfos(size_t count) {
+			static std::map<size_t, std::vector<model::TransactionInfo>> transactionInfosMap;
+			auto iter = transactionInfosMap.find(count);
+			if (transactionInfosMap.cend() == iter)
+				iter = transactionInfosMap.emplace(count, CreateTransactionInfos(count)).first;
+
+			return iter->second;
+		}
+
+		// endregion
+
+		// region traits
+
+		struct FlatTraits {
+			struct CacheType {
+				size_t IdSequence = 0;
+				cache::TransactionDataContainer TransactionDataContainer;
+			};
+
+			static void AddAll(CacheType& cache, const std::vector<model::TransactionInfo>& transactionInfos) {
+				for (const auto& transactionInfo : transactionInfos)
+					cache.TransactionDataContainer.insert(transactionInfo, ++cache.IdSequence);
+			}
+
+			static void RemoveAll(CacheType& cache, const std::vector<model::TransactionInfo>& transactionInfos) {
+				for (const auto& transactionInfo : transactionInfos)
+					cache.TransactionDataContainer.remove(transactionInfo.EntityHash);
+			}
+
+			static uint64_t Iterate(const CacheType& cache) {
+				uint64_t totalSize = 0;
+				cache.TransactionDataContainer.forEach([&totalSize](const auto& data) {
+					totalSize += data.pEntity->Size + data.EntityHash[0];
+					return true;
+				});
+				return totalSize;
+			}
+		};
+
+		// node based layout used by MemoryUtCache before flat storage:
+		// id ordered set with a separate max fee multiplier index and hash to id lookup
+		struct NodeBasedTraits {
+			struct NodeData : public TransactionData {
+				using TransactionData::TransactionData;
+
+				bool operator<(const NodeData& rhs) const {
+					return Id < rhs.Id;
+				}
+			};
+
+			struct MaxFeeMultiplierComparer {
+				bool operator()(const NodeData* pLhs, const NodeData* pRhs) const {
+					return pLhs->MaxFeeMultiplier != pRhs->MaxFeeMultiplier
+							? pLhs->MaxFeeMultiplier > pRhs->MaxFeeMultiplier
+							: pLhs->Id < pRhs->Id;
+				}
+			};
+
+			struct CacheType {
+				size_t IdSequence = 0;
+				std::set<NodeData> TransactionDataContainer;
+				std::set<const NodeData*, MaxFeeMultiplierComparer> MaxFeeMultiplierIndex;
+				std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
+			};
+
+			static void AddAll(CacheType& cache, const std::vector<model::TransactionInfo>& transactionInfos) {
+				for (const auto& transactionInfo : transactionInfos) {
+					if (!cache.IdLookup.emplace(transactionInfo.EntityHash, ++cache.IdSequence).second)
+						continue;
+
+					auto dataIter = cache.TransactionDataContainer.emplace(transactionInfo, cache.IdSequence).first;
+					cache.MaxFeeMultiplierIndex.insert(&*dataIter);
+				}
+			}
+
+			static void RemoveAll(CacheType& cache, const std::vector<model::TransactionInfo>& transactionInfos) {
+				for (const auto& transactionInfo : transactionInfos) {
+					auto iter = cache.IdLookup.find(transactionInfo.EntityHash);
+					if (cache.IdLookup.cend() == iter)
+						continue;
+
+					auto dataIter = cache.TransactionDataContainer.find(NodeData(transactionInfo, iter->second));
+					cache.MaxFeeMultiplierIndex.erase(&*dataIter);
+					cache.TransactionDataContainer.erase(dataIter);
+					cache.IdLookup.erase(iter);
+				}
+			}
+
+			static uint64_t Iterate(const CacheType& cache) {
+				uint64_t totalSize = 0;
+				for (const auto& data : cache.TransactionDataContainer)
+					totalSize += data.pEntity->Size + data.EntityHash[0];
+
+				return totalSize;
+			}
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TTraits>
+		void BenchmarkInsert(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			const auto& transactionInfos = GetTransactionInfos(count);
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto pCache = std::make_unique<typename TTraits::CacheType>();
+				state.ResumeTiming();
+
+				TTraits::AddAll(*pCache, transactionInfos);
+
+				state.PauseTiming();
+				pCache.reset();
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+		}
+
+		// removes transactions from oldest to newest, like a UT cache that is pruned as blocks confirm its transactions
+		template<typename TTraits>
+		void BenchmarkRemove(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			const auto& transactionInfos = GetTransactionInfos(count);
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto pCache = std::make_unique<typename TTraits::CacheType>();
+				TTraits::AddAll(*pCache, transactionInfos);
+				state.ResumeTiming();
+
+				TTraits::RemoveAll(*pCache, transactionInfos);
+
+				state.PauseTiming();
+				pCache.reset();
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+		}
+
+		template<typename TTraits>
+		void BenchmarkIterate(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			auto pCache = std::make_unique<typename TTraits::CacheType>();
+			TTraits::AddAll(*pCache, GetTransactionInfos(count));
+			for (auto _ : state)
+				benchmark::DoNotOptimize(TTraits::Iterate(*pCache));
+
+			state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 100'000, 1'000'000 })
+				benchmark.Unit(benchmark::kMillisecond)->Arg(arg);
+		}
+
+		// endregion
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME, TRAITS_NAME) \
+	catapult::cache::AddDefaultArguments(*benchmark::RegisterBenchmark( \
+			#BENCH_NAME "<" #TRAITS_NAME ">", \
+			catapult::cache::BENCH_NAME<catapult::cache::TRAITS_NAME>))
+
+#define REGISTER_BENCHMARKS(BENCH_NAME) \
+	REGISTER_BENCHMARK(BENCH_NAME, FlatTraits); \
+	REGISTER_BENCHMARK(BENCH_NAME, NodeBasedTraits)
+
+void RegisterTests();
+void RegisterTests() {
+	REGISTER_BENCHMARKS(BenchmarkInsert);
+	REGISTER_BENCHMARKS(BenchmarkRemove);
+	REGISTER_BENCHMARKS(BenchmarkIterate);
+}
@@ -19,6 +19,8 @@
 **/
 
 #include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/MultiBufferHashes.h"
+#include "catapult/functions.h"
 #include "tests/bench/nodeps/Random.h"
 #include <benchmark/benchmark.h>
 
@@ -73,6 +75,51 @@ namespace catapult { namespace crypto {
 			for (auto arg : { 256, 1024, 4096, 16384})
 				benchmark.UseRealTime()->Arg(arg);
 		}
+
+		// region batched
+
+		constexpr size_t Batch_Size = 1024;
+
+		using BatchHasher = consumer<const std::vector<RawBuffer>&, std::vector<Hash256>&>;
+
+		void BenchmarkSha3_256Batch(benchmark::State& state, const BatchHasher& hashAll) {
+			std::vector<std::vector<uint8_t>> buffers(Batch_Size, std::vector<uint8_t>(static_cast<size_t>(state.range(0))));
+			std::vector<RawBuffer> rawBuffers(buffers.cbegin(), buffers.cend());
+			std::vector<Hash256> hashes(Batch_Size);
+			for (auto _ : state) {
+				state.PauseTiming();
+				for (auto& buffer : buffers)
+					bench::FillWithRandomData(buffer);
+
+				state.ResumeTiming();
+
+				hashAll(rawBuffers, hashes);
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(Batch_Size * static_cast<size_t>(state.range(0)) * state.iterations()));
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void BenchmarkSha3_256Sequential(benchmark::State& state) {
+			BenchmarkSha3_256Batch(state, [](const auto& buffers, auto& hashes) {
+				for (auto i = 0u; i < buffers.size(); ++i)
+					Sha3_256(buffers[i], hashes[i]);
+			});
+		}
+
+		void BenchmarkSha3_256Multi(benchmark::State& state, MultiBufferHashBackend backend) {
+			BenchmarkSha3_256Batch(state, [backend](const auto& buffers, auto& hashes) {
+				Sha3_256_Multi(backend, buffers.data(), buffers.size(), hashes.data());
+			});
+		}
+
+		void AddBatchArguments(benchmark::internal::Benchmark& benchmark) {
+			// 64 bytes matches merkle tree nodes, larger sizes match typical transactions
+			for (auto arg : { 64, 256, 1024 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+		// endregion
 	}
 }}
 
@@ -88,4 +135,21 @@ void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha256Double_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha512_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha3_256_Traits);
+
+	catapult::crypto::AddBatchArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkSha3_256Sequential));
+
+	using catapult::crypto::MultiBufferHashBackend;
+	for (const auto& pair : std::initializer_list<std::pair<const char*, MultiBufferHashBackend>>{
+		{ "BenchmarkSha3_256Multi/Scalar", MultiBufferHashBackend::Scalar },
+		{ "BenchmarkSha3_256Multi/Avx2", MultiBufferHashBackend::Avx2 },
+		{ "BenchmarkSha3_256Multi/Avx512", MultiBufferHashBackend::Avx512 }
+	}) {
+		if (!catapult::crypto::IsMultiBufferHashBackendSupported(pair.second))
+			continue;
+
+		catapult::crypto::AddBatchArguments(*benchmark::RegisterBenchmark(
+				pair.first,
+				catapult::crypto::BenchmarkSha3_256Multi,
+				pair.second));
+	}
 }
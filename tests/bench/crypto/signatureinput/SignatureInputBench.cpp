@@ -0,0 +1,149 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/Signer.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	std::atomic<uint64_t> Num_Allocations(0);
+}
+
+// count all heap allocations made by the benchmarked code
+void* operator new(size_t size) {
+	++Num_Allocations;
+	if (auto* pMemory = std::malloc(size ? size : 1))
+		return pMemory;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pMemory) noexcept {
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, size_t) noexcept {
+	std::free(pMemory);
+}
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		constexpr auto Data_Size = 279;
+
+		struct CapturedSignature {
+			Key PublicKey;
+			std::vector<uint8_t> Data;
+			catapult::Signature Signature;
+		};
+
+		std::vector<CapturedSignature> CreateCapturedSignatures(size_t count) {
+			std::vector<CapturedSignature> signatures(count);
+			for (auto& signature : signatures) {
+				bench::FillWithRandomData(signature.PublicKey);
+				signature.Data.resize(Data_Size);
+				bench::FillWithRandomData(signature.Data);
+				bench::FillWithRandomData(signature.Signature);
+			}
+
+			return signatures;
+		}
+
+		// region traits
+
+		// mirrors the original capture path: a heap allocated buffer list per signature and an unsized input vector
+		struct LegacyCaptureTraits {
+			struct SignatureInput {
+				const Key& PublicKey;
+				std::vector<RawBuffer> Buffers;
+				const catapult::Signature& Signature;
+			};
+
+			static auto Capture(const GenerationHashSeed& generationHashSeed, const std::vector<CapturedSignature>& signatures) {
+				std::vector<SignatureInput> inputs;
+				for (const auto& signature : signatures) {
+					std::vector<RawBuffer> buffers;
+					buffers.push_back(generationHashSeed);
+					buffers.push_back(signature.Data);
+					inputs.push_back({ signature.PublicKey, buffers, signature.Signature });
+				}
+
+				return inputs;
+			}
+		};
+
+		// mirrors the current capture path: inline buffer lists and a presized input vector
+		struct InlineCaptureTraits {
+			static auto Capture(const GenerationHashSeed& generationHashSeed, const std::vector<CapturedSignature>& signatures) {
+				std::vector<crypto::SignatureInput> inputs;
+				inputs.reserve(signatures.size());
+				for (const auto& signature : signatures) {
+					SignatureInputBuffers buffers;
+					buffers.push_back(generationHashSeed);
+					buffers.push_back(signature.Data);
+					inputs.push_back({ signature.PublicKey, buffers, signature.Signature });
+				}
+
+				return inputs;
+			}
+		};
+
+		// endregion
+
+		template<typename TTraits>
+		void BenchmarkCaptureSignatureInputs(benchmark::State& state) {
+			GenerationHashSeed generationHashSeed;
+			bench::FillWithRandomData(generationHashSeed);
+			auto signatures = CreateCapturedSignatures(static_cast<size_t>(state.range(0)));
+
+			uint64_t numAllocations = 0;
+			for (auto _ : state) {
+				auto numAllocationsBefore = Num_Allocations.load();
+				auto inputs = TTraits::Capture(generationHashSeed, signatures);
+				numAllocations += Num_Allocations.load() - numAllocationsBefore;
+
+				benchmark::DoNotOptimize(inputs.data());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(signatures.size() * state.iterations()));
+			state.counters["allocations"] = benchmark::Counter(static_cast<double>(numAllocations), benchmark::Counter::kAvgIterations);
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 100, 1000, 10000, 100000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+#define CATAPULT_REGISTER_CAPTURE_BENCHMARK(TRAITS_NAME) \
+	catapult::crypto::AddDefaultArguments( \
+			*REGISTER_BENCHMARK(catapult::crypto::BenchmarkCaptureSignatureInputs<catapult::crypto::TRAITS_NAME>))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_CAPTURE_BENCHMARK(LegacyCaptureTraits);
+	CATAPULT_REGISTER_CAPTURE_BENCHMARK(InlineCaptureTraits);
+}
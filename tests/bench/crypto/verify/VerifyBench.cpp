@@ -60,18 +60,17 @@ namespace catapult { namespace crypto {
 				CATAPULT_LOG(warning) << numFailures << " calls to Verify failed";
 		}
 
-		void BenchmarkVerifyMulti(benchmark::State& state) {
+		void BenchmarkVerifyMulti(benchmark::State& state, CurveBackend backend, size_t batchSize) {
 			auto numFailures = 0u;
-			constexpr auto Batch_Size = 100;
-			std::vector<Signature> signatures(Batch_Size);
-			std::vector<std::vector<uint8_t>> buffers(Batch_Size);
+			std::vector<Signature> signatures(batchSize);
+			std::vector<std::vector<uint8_t>> buffers(batchSize);
 
 			for (auto _ : state) {
 				state.PauseTiming();
 				std::vector<KeyPair> keyPairs;
 				std::vector<SignatureInput> signatureInputs;
-				keyPairs.reserve(Batch_Size);
-				for (auto i = 0u; i < Batch_Size; ++i) {
+				keyPairs.reserve(batchSize);
+				for (auto i = 0u; i < batchSize; ++i) {
 					keyPairs.push_back(CreateRandomKeyPair());
 					buffers[i].resize(Data_Size);
 					bench::FillWithRandomData(buffers[i]);
@@ -81,14 +80,23 @@ namespace catapult { namespace crypto {
 
 				state.ResumeTiming();
 
-				if (!crypto::VerifyMulti(CreateRandomFiller(), signatureInputs.data(), signatureInputs.size()).second)
+				if (!crypto::VerifyMulti(backend, CreateRandomFiller(), signatureInputs.data(), signatureInputs.size()).second)
 					++numFailures;
 			}
 
-			state.SetBytesProcessed(static_cast<int64_t>(Data_Size * Batch_Size * state.iterations()));
+			state.SetBytesProcessed(static_cast<int64_t>(Data_Size * batchSize * state.iterations()));
+			state.SetItemsProcessed(static_cast<int64_t>(batchSize * state.iterations()));
 			if (0 != numFailures)
 				CATAPULT_LOG(warning) << numFailures << " calls to VerifyMulti failed";
 		}
+
+		void BenchmarkVerifyMulti(benchmark::State& state, CurveBackend backend) {
+			BenchmarkVerifyMulti(state, backend, 100);
+		}
+
+		void BenchmarkVerifyMultiBatchSize(benchmark::State& state) {
+			BenchmarkVerifyMulti(state, GetDefaultCurveBackend(), static_cast<size_t>(state.range(0)));
+		}
 	}
 }}
 
@@ -101,10 +109,28 @@ void RegisterTests() {
 			->Threads(4)
 			->Threads(8);
 
-	benchmark::RegisterBenchmark("BenchmarkVerifyMulti", catapult::crypto::BenchmarkVerifyMulti)
+	using catapult::crypto::CurveBackend;
+	for (const auto& pair : std::initializer_list<std::pair<const char*, CurveBackend>>{
+		{ "BenchmarkVerifyMulti/Scalar", CurveBackend::Scalar },
+		{ "BenchmarkVerifyMulti/Avx2", CurveBackend::Avx2 },
+		{ "BenchmarkVerifyMulti/Avx512", CurveBackend::Avx512 }
+	}) {
+		if (!catapult::crypto::IsCurveBackendSupported(pair.second))
+			continue;
+
+		void (*benchmarkVerifyMulti)(benchmark::State&, CurveBackend) = catapult::crypto::BenchmarkVerifyMulti;
+		benchmark::RegisterBenchmark(pair.first, benchmarkVerifyMulti, pair.second)
+				->UseRealTime()
+				->Threads(1)
+				->Threads(2)
+				->Threads(4)
+				->Threads(8);
+	}
+
+	// sweep batch sizes around the crossover between Bos-Coster and bucket multi scalar multiplication
+	benchmark::RegisterBenchmark("BenchmarkVerifyMultiBatchSize", catapult::crypto::BenchmarkVerifyMultiBatchSize)
 			->UseRealTime()
-			->Threads(1)
-			->Threads(2)
-			->Threads(4)
-			->Threads(8);
+			->RangeMultiplier(2)
+			->Range(16, 4096)
+			->Threads(1);
 }
@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "catapult/model/RangeTypes.h"
+#include <benchmark/benchmark.h>
+#include <boost/thread.hpp>
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		// number of consumers in the transaction dispatcher
+		constexpr size_t Num_Stub_Consumers = 5;
+		constexpr size_t Num_Elements_Per_Iteration = 10'000;
+		constexpr size_t Disruptor_Size = 16 * 1024;
+
+		ConsumerDispatcherOptions CreateOptions() {
+			auto options = ConsumerDispatcherOptions("bench dispatcher", Disruptor_Size);
+			options.ElementTraceInterval = 0;
+			options.ShouldThrowWhenFull = false;
+			return options;
+		}
+
+		std::vector<DisruptorConsumer> CreateStubConsumers() {
+			std::vector<DisruptorConsumer> consumers;
+			for (auto i = 0u; i < Num_Stub_Consumers; ++i)
+				consumers.push_back([](const auto&) { return ConsumerResult::Continue(); });
+
+			return consumers;
+		}
+
+		model::TransactionRange CreateTransactionRange() {
+			uint8_t* pData;
+			auto range = model::TransactionRange::PrepareFixed(1, &pData);
+			std::memset(pData, 0, sizeof(model::Transaction));
+			reinterpret_cast<model::Transaction*>(pData)->Size = sizeof(model::Transaction);
+			return range;
+		}
+
+		void ProcessAll(ConsumerDispatcher& dispatcher, std::vector<model::TransactionRange>& ranges) {
+			for (auto& range : ranges) {
+				// retry when the disruptor is full, like a packet reader waiting for the dispatcher to catch up
+				while (0 == dispatcher.processElement(ConsumerInput(std::move(range))))
+					std::this_thread::yield();
+			}
+		}
+
+		// measures the rate at which elements pass through a dispatcher with no-op consumers when pushed by multiple producers
+		void BenchmarkProcessElement(benchmark::State& state) {
+			auto numProducers = static_cast<size_t>(state.range(0));
+			ConsumerDispatcher dispatcher(CreateOptions(), CreateStubConsumers());
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				std::vector<std::vector<model::TransactionRange>> producerRanges(numProducers);
+				for (auto i = 0u; i < Num_Elements_Per_Iteration; ++i)
+					producerRanges[i % numProducers].push_back(CreateTransactionRange());
+
+				state.ResumeTiming();
+
+				boost::thread_group threads;
+				for (auto& ranges : producerRanges)
+					threads.create_thread([&dispatcher, &ranges]() { ProcessAll(dispatcher, ranges); });
+
+				threads.join_all();
+				while (0 != dispatcher.numActiveElements())
+					std::this_thread::yield();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Elements_Per_Iteration * state.iterations()));
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 1, 2, 4, 8, 16 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) \
+	catapult::disruptor::AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, catapult::disruptor::BENCH_NAME))
+
+void RegisterTests();
+void RegisterTests() {
+	REGISTER_BENCHMARK(BenchmarkProcessElement);
+}
@@ -0,0 +1,164 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		constexpr size_t Base_Tree_Size = 100'000;
+
+		struct Encoder {
+			using KeyType = uint64_t;
+			using ValueType = Hash256;
+
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const ValueType& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using Tree = PatriciaTree<Encoder, MemoryDataSource>;
+		using KeyValuePairs = std::vector<std::pair<uint64_t, Hash256>>;
+
+		Hash256 GenerateRandomHash() {
+			Hash256 hash;
+			bench::FillWithRandomData(hash);
+			return hash;
+		}
+
+		class BaseTree {
+		public:
+			BaseTree() : m_dataSource(DataSourceVerbosity::Off) {
+				Tree tree(m_dataSource);
+				for (auto i = 0u; i < Base_Tree_Size; ++i) {
+					auto key = bench::Random();
+					tree.set(key, GenerateRandomHash());
+					m_keys.push_back(key);
+				}
+
+				tree.saveAll();
+				m_root = tree.root();
+			}
+
+		public:
+			MemoryDataSource& dataSource() {
+				return m_dataSource;
+			}
+
+			const Hash256& root() const {
+				return m_root;
+			}
+
+			// half of the pairs update existing values and half of the pairs insert new values
+			KeyValuePairs generateChanges(size_t count) const {
+				KeyValuePairs pairs;
+				for (auto i = 0u; i < count; ++i) {
+					auto key = 0 == i % 2 ? m_keys[bench::Random() % m_keys.size()] : bench::Random();
+					pairs.emplace_back(key, GenerateRandomHash());
+				}
+
+				return pairs;
+			}
+
+		private:
+			MemoryDataSource m_dataSource;
+			std::vector<uint64_t> m_keys;
+			Hash256 m_root;
+		};
+
+		BaseTree& GetBaseTree() {
+			static BaseTree baseTree;
+			return baseTree;
+		}
+
+		template<typename TApplyChanges>
+		void BenchmarkApplyChanges(benchmark::State& state, TApplyChanges applyChanges) {
+			auto& baseTree = GetBaseTree();
+			auto numChanges = static_cast<size_t>(state.range(0));
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto pairs = baseTree.generateChanges(numChanges);
+				Tree tree(baseTree.dataSource());
+				tree.tryLoad(baseTree.root());
+				state.ResumeTiming();
+
+				applyChanges(tree, pairs);
+				benchmark::DoNotOptimize(tree.root());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numChanges * state.iterations()));
+		}
+
+		// region benchmarks
+
+		// calculates the root after every change, which rehashes the entire path to each changed leaf
+		void BenchmarkSetEager(benchmark::State& state) {
+			BenchmarkApplyChanges(state, [](auto& tree, const auto& pairs) {
+				for (const auto& pair : pairs) {
+					tree.set(pair.first, pair.second);
+					benchmark::DoNotOptimize(tree.root());
+				}
+			});
+		}
+
+		// calculates the root once after all changes, which hashes each modified branch once but copies it once per change
+		void BenchmarkSet(benchmark::State& state) {
+			BenchmarkApplyChanges(state, [](auto& tree, const auto& pairs) {
+				for (const auto& pair : pairs)
+					tree.set(pair.first, pair.second);
+			});
+		}
+
+		// applies all changes in a single pass, which hashes and copies each modified branch once
+		void BenchmarkSetAll(benchmark::State& state) {
+			BenchmarkApplyChanges(state, [](auto& tree, const auto& pairs) {
+				std::vector<const std::pair<uint64_t, Hash256>*> pairPointers;
+				for (const auto& pair : pairs)
+					pairPointers.push_back(&pair);
+
+				tree.setAll(pairPointers);
+			});
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 100, 1000, 10000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+		// endregion
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) \
+	catapult::tree::AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, catapult::tree::BENCH_NAME))
+
+void RegisterTests();
+void RegisterTests() {
+	REGISTER_BENCHMARK(BenchmarkSetEager);
+	REGISTER_BENCHMARK(BenchmarkSet);
+	REGISTER_BENCHMARK(BenchmarkSetAll);
+}
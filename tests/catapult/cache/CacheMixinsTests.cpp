@@ -667,6 +667,35 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region PrefetchMixin
+
+	namespace {
+		struct PrefetchCapturingSet {
+		public:
+			void prefetch(const std::vector<TestCacheDescriptor::KeyType>& keys) const {
+				PrefetchedKeys.push_back(keys);
+			}
+
+		public:
+			mutable std::vector<std::vector<TestCacheDescriptor::KeyType>> PrefetchedKeys;
+		};
+	}
+
+	TEST(TEST_CLASS, PrefetchMixin_ForwardsKeysToSet) {
+		// Arrange:
+		PrefetchCapturingSet set;
+		auto mixin = PrefetchMixin<PrefetchCapturingSet, TestCacheDescriptor>(set);
+
+		// Act:
+		mixin.prefetch({ 3, 1, 4 });
+
+		// Assert:
+		ASSERT_EQ(1u, set.PrefetchedKeys.size());
+		EXPECT_EQ(std::vector<TestCacheDescriptor::KeyType>({ 3, 1, 4 }), set.PrefetchedKeys[0]);
+	}
+
+	// endregion
+
 	// region HeightBasedTouchMixin
 
 	namespace {
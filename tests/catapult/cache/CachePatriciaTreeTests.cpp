@@ -244,4 +244,72 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region enabled - warm start
+
+	namespace {
+		void SerialRunner(size_t count, const consumer<size_t>& callback) {
+			for (auto i = 0u; i < count; ++i)
+				callback(i);
+		}
+
+		void SeedTree(CacheDatabase& database) {
+			CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, database, 1);
+			auto pDeltaTree = tree.rebase();
+			pDeltaTree->set(0x01'23'4A'B6, "alpha");
+			pDeltaTree->set(0x01'23'4A'99, "beta");
+			tree.commit();
+		}
+	}
+
+	TEST(TEST_CLASS, Enabled_WarmStartLoadsSavedNodesIntoNodeCache) {
+		// Arrange: saved tree is composed of one branch and two leaves
+		CacheDatabaseHolder holder;
+		SeedTree(holder.database());
+
+		PatriciaTreeNodeCache nodeCache(100);
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, &nodeCache);
+
+		// Act:
+		auto numLoadedNodes = nodeCache.warmStart(SerialRunner);
+
+		// Assert:
+		EXPECT_EQ(3u, numLoadedNodes);
+		EXPECT_TRUE(!!nodeCache.find(tree.get()->root()));
+	}
+
+	TEST(TEST_CLASS, Enabled_DestroyedTreeIsNotWarmStarted) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+		SeedTree(holder.database());
+
+		PatriciaTreeNodeCache nodeCache(100);
+		{
+			CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, &nodeCache);
+		}
+
+		// Act:
+		auto numLoadedNodes = nodeCache.warmStart(SerialRunner);
+
+		// Assert: only the root node was cached (when the tree was created)
+		EXPECT_EQ(0u, numLoadedNodes);
+		EXPECT_EQ(1u, nodeCache.statistics().Size);
+	}
+
+	TEST(TEST_CLASS, Enabled_TreeThatFailedToInitializeIsNotWarmStarted) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+		holder.database().put(1, "root", HashToString(test::GenerateRandomByteArray<Hash256>()));
+
+		PatriciaTreeNodeCache nodeCache(100);
+		EXPECT_THROW(CachePatriciaTree<DatabaseBasePatriciaTree>(true, holder.database(), 1, &nodeCache), catapult_runtime_error);
+
+		// Act:
+		auto numLoadedNodes = nodeCache.warmStart(SerialRunner);
+
+		// Assert:
+		EXPECT_EQ(0u, numLoadedNodes);
+	}
+
+	// endregion
 }}
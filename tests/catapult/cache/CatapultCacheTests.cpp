@@ -230,6 +230,60 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(hashes, subCacheMerkleRoots);
 	}
 
+	namespace {
+		void SetReverseOrderSubCacheRunner(CatapultCache& cache, std::vector<size_t>& runnerCounts) {
+			cache.setStateHashRunners({
+				[&runnerCounts](auto count, const auto& callback) {
+					runnerCounts.push_back(count);
+					for (auto i = count; i > 0; --i)
+						callback(i - 1);
+				},
+				utils::ParallelRunner()
+			});
+		}
+
+		void AssertStateHashIsCalculatedViaSubCacheRunner(CatapultCacheDelta& delta, const std::vector<size_t>& runnerCounts) {
+			// Arrange:
+			std::vector<Hash256> expectedSubCacheMerkleRoots{
+				DeltaTraits::GetMerkleRoot(delta.sub<test::SimpleCacheT<2>>()),
+				DeltaTraits::GetMerkleRoot(delta.sub<test::SimpleCacheT<6>>()),
+				DeltaTraits::GetMerkleRoot(delta.sub<test::SimpleCacheT<10>>())
+			};
+
+			// Act:
+			auto stateHashInfo = delta.calculateStateHash(Height(123));
+
+			// Assert: all (five) sub caches are passed to the runner but merkle roots are collected in order
+			EXPECT_EQ(std::vector<size_t>({ 5 }), runnerCounts);
+			EXPECT_EQ(expectedSubCacheMerkleRoots, stateHashInfo.SubCacheMerkleRoots);
+		}
+	}
+
+	TEST(TEST_CLASS, CalculateStateHashUpdatesSubCachesViaSubCacheRunnerWhenSet_Delta) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		std::vector<size_t> runnerCounts;
+		SetReverseOrderSubCacheRunner(cache, runnerCounts);
+
+		auto delta = cache.createDelta();
+
+		// Act + Assert:
+		AssertStateHashIsCalculatedViaSubCacheRunner(delta, runnerCounts);
+	}
+
+	TEST(TEST_CLASS, CalculateStateHashUpdatesSubCachesViaSubCacheRunnerWhenSet_DetachedDelta) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		std::vector<size_t> runnerCounts;
+		SetReverseOrderSubCacheRunner(cache, runnerCounts);
+
+		auto detachedDelta = cache.createDetachableDelta().detach();
+		auto pDelta = detachedDelta.tryLock();
+
+		// Act + Assert:
+		AssertStateHashIsCalculatedViaSubCacheRunner(*pDelta, runnerCounts);
+	}
+
 	// endregion
 
 	// region commit
@@ -269,10 +323,47 @@ namespace catapult { namespace cache {
 		AssertSubCacheSizes(delta, 1);
 	}
 
+	TEST(TEST_CLASS, CommitDelegatesToSubCachesViaCommitRunnerWhenSet) {
+		// Arrange: use a runner that processes the indexes in reverse order
+		auto cache = CreateSimpleCatapultCache();
+		std::vector<size_t> runnerCounts;
+		cache.setCommitRunner([&runnerCounts](auto count, const auto& callback) {
+			runnerCounts.push_back(count);
+			for (auto i = count; i > 0; --i)
+				callback(i - 1);
+		});
+
+		// Act:
+		CommitChangeToAllSubCaches(cache);
+		auto view = cache.createView();
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 3 }), runnerCounts);
+		AssertSubCacheSizes(view, 1);
+	}
+
+	TEST(TEST_CLASS, CommitUpdatesDurationHistograms) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Sanity:
+		EXPECT_EQ(0u, cache.commitDurations().count());
+		EXPECT_EQ(0u, cache.commitLockDurations().count());
+
+		// Act:
+		CommitChangeToAllSubCaches(cache);
+		CommitChangeToAllSubCaches(cache);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.commitDurations().count());
+		EXPECT_EQ(2u, cache.commitLockDurations().count());
+		EXPECT_LE(cache.commitLockDurations().maxMillis(), cache.commitDurations().maxMillis());
+	}
+
 	TEST(TEST_CLASS, CommitOfSubCacheInvalidatesDetachedDelta) {
 		// Arrange:
 		auto cache = CreateSimpleCatapultCache();
-		CatapultCacheDetachedDelta cacheDetachedDelta(state::CatapultState(), {});
+		CatapultCacheDetachedDelta cacheDetachedDelta(state::CatapultState(), {}, StateHashRunners());
 		{
 			// - create a detachable delta and release it (to release read lock it holds)
 			auto cacheDetachableDelta = cache.createDetachableDelta();
@@ -671,7 +762,7 @@ namespace catapult { namespace cache {
 			class ViewProxy {
 			public:
 				ViewProxy()
-						: m_view(m_dependentState, {})
+						: m_view(m_dependentState, {}, StateHashRunners())
 						, m_isValid(false)
 				{}
 
@@ -352,6 +352,67 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region PatriciaTreeDeltaMixin - updateMerkleRoot (subtree runner)
+
+	namespace {
+		using DeltaMixin = PatriciaTreeDeltaMixin<DeltasWrapper, test::MemoryBasePatriciaTree::DeltaType>;
+
+		void AddValues(DeltasWrapper& deltaset, size_t count) {
+			for (auto i = 0u; i < count; ++i)
+				deltaset.Added.emplace(static_cast<uint32_t>(i * 2'654'435'761u), std::to_string(i));
+		}
+
+		void AssertSubtreeRunner(size_t numChanges, size_t expectedNumRunnerCalls) {
+			// Arrange:
+			tree::MemoryDataSource dataSource;
+			test::MemoryBasePatriciaTree tree(dataSource);
+			test::SeedTreeWithFourNodes(tree);
+
+			DeltasWrapper deltaset;
+			AddValues(deltaset, numChanges);
+
+			DeltasWrapper deltasetSequential;
+			AddValues(deltasetSequential, numChanges);
+
+			auto pDeltaTree = tree.rebase();
+			auto mixin = DeltaMixin(deltaset, pDeltaTree);
+
+			tree::MemoryDataSource dataSourceSequential;
+			test::MemoryBasePatriciaTree treeSequential(dataSourceSequential);
+			test::SeedTreeWithFourNodes(treeSequential);
+			auto mixinSequential = DeltaMixin(deltasetSequential, treeSequential.rebase());
+			mixinSequential.updateMerkleRoot(Height(123));
+
+			std::vector<size_t> counts;
+			auto subtreeRunner = [&counts](auto count, const auto& callback) {
+				counts.push_back(count);
+				for (auto i = 0u; i < count; ++i)
+					callback(i);
+			};
+
+			// Act:
+			mixin.updateMerkleRoot(Height(123), subtreeRunner);
+			auto result = mixin.tryGetMerkleRoot();
+
+			// Assert:
+			EXPECT_EQ(expectedNumRunnerCalls, counts.size());
+			EXPECT_TRUE(result.second);
+			EXPECT_EQ(mixinSequential.tryGetMerkleRoot().first, result.first);
+
+			EXPECT_EQ(2u, deltaset.generationId());
+		}
+	}
+
+	TEST(TEST_CLASS, DeltaMixin_UpdateDoesNotUseSubtreeRunnerWhenFewChangesArePending) {
+		AssertSubtreeRunner(DeltaMixin::Min_Parallel_Hash_Changes - 1, 0);
+	}
+
+	TEST(TEST_CLASS, DeltaMixin_UpdateUsesSubtreeRunnerWhenManyChangesArePending) {
+		AssertSubtreeRunner(DeltaMixin::Min_Parallel_Hash_Changes, 1);
+	}
+
+	// endregion
+
 	// region PatriciaTreeDeltaMixin - setMerkleRoot
 
 	TEST(TEST_CLASS, DeltaMixin_SetThrowsWhenTreeIsNullptr) {
@@ -152,7 +152,7 @@ namespace catapult { namespace cache {
 		deltaset.Copied.emplace(0x64'6F'00'00, "noun");
 
 		// Act:
-		ApplyDeltasToTree(tree, deltaset, 1, Height(1));
+		auto numChanges = ApplyDeltasToTree(tree, deltaset, 1, Height(1));
 
 		// Assert:
 		auto expectedRoot = test::CalculateRootHash({
@@ -162,6 +162,7 @@ namespace catapult { namespace cache {
 			{ 0x26'54'32'10, "alpha" }
 		});
 
+		EXPECT_EQ(3u, numChanges);
 		EXPECT_EQ(expectedRoot, tree.root());
 	}
 
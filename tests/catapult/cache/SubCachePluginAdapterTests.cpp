@@ -365,7 +365,7 @@ namespace catapult { namespace cache {
 		// Arrange:
 		RunTestForMerkleRootSupportedButDisabled([](auto& view) {
 			// Act:
-			view.updateMerkleRoot(Height(3));
+			view.updateMerkleRoot(Height(3), utils::ParallelRunner());
 
 			// Assert:
 			Hash256 merkleRoot;
@@ -380,7 +380,7 @@ namespace catapult { namespace cache {
 			expectedUpdatedMerkleRoot[0] = 3;
 
 			// Act:
-			view.updateMerkleRoot(Height(3));
+			view.updateMerkleRoot(Height(3), utils::ParallelRunner());
 
 			// Assert:
 			Hash256 merkleRoot;
@@ -393,7 +393,7 @@ namespace catapult { namespace cache {
 		// Arrange:
 		RunTestForMerkleRootSupportedAndEnabledView([](auto& view, const auto& expectedMerkleRoot) {
 			// Act: even if const is improperly casted away, operation should fail on const view
-			const_cast<SubCacheView&>(view).updateMerkleRoot(Height(3));
+			const_cast<SubCacheView&>(view).updateMerkleRoot(Height(3), utils::ParallelRunner());
 
 			// Assert:
 			Hash256 merkleRoot;
@@ -406,7 +406,7 @@ namespace catapult { namespace cache {
 		// Arrange:
 		RunTestForMerkleRootNotSupported([](auto& view) {
 			// Act:
-			view.updateMerkleRoot(Height(3));
+			view.updateMerkleRoot(Height(3), utils::ParallelRunner());
 
 			// Assert:
 			Hash256 merkleRoot;
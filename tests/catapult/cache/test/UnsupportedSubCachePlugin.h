@@ -59,7 +59,7 @@ namespace catapult { namespace test {
 		}
 
 		[[noreturn]]
-		void updateMerkleRoot(Height) override {
+		void updateMerkleRoot(Height, const utils::ParallelRunner&) override {
 			CATAPULT_THROW_RUNTIME_ERROR("updateMerkleRoot is not supported");
 		}
 
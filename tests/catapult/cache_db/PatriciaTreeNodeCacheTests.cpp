@@ -0,0 +1,331 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS PatriciaTreeNodeCacheTests
+
+	namespace {
+		tree::TreeNode CreateLeafNode(uint8_t value) {
+			return tree::TreeNode(tree::LeafTreeNode(tree::TreeNodePath(value), test::GenerateRandomByteArray<Hash256>()));
+		}
+
+		void AssertStatistics(const PatriciaTreeNodeCache& cache, uint64_t numHits, uint64_t numMisses, size_t size) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(size, statistics.Size);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		PatriciaTreeNodeCache cache(10);
+
+		// Assert:
+		EXPECT_EQ(10u, cache.maxNodes());
+		EXPECT_FALSE(cache.isFull());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	// endregion
+
+	// region find / insert
+
+	TEST(TEST_CLASS, FindReturnsNullptrWhenNodeIsNotCached) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		cache.insert(CreateLeafNode(0x12));
+
+		// Act:
+		auto pNode = cache.find(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_FALSE(!!pNode);
+		AssertStatistics(cache, 0, 1, 1);
+	}
+
+	TEST(TEST_CLASS, FindReturnsCachedLeafNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		auto node = CreateLeafNode(0x12);
+		cache.insert(node);
+
+		// Act:
+		auto pNode = cache.find(node.hash());
+
+		// Assert:
+		ASSERT_TRUE(!!pNode);
+		EXPECT_TRUE(pNode->isLeaf());
+		EXPECT_EQ(node.hash(), pNode->hash());
+		EXPECT_EQ(node.asLeafNode().value(), pNode->asLeafNode().value());
+		AssertStatistics(cache, 1, 0, 1);
+	}
+
+	TEST(TEST_CLASS, FindReturnsCompactedBranchNode) {
+		// Arrange: link the branch to an in memory node
+		PatriciaTreeNodeCache cache(10);
+		auto linkedNode = CreateLeafNode(0x12);
+		tree::BranchTreeNode branchNode(tree::TreeNodePath(0x34));
+		branchNode.setLink(linkedNode, 3);
+		branchNode.setLink(test::GenerateRandomByteArray<Hash256>(), 7);
+		auto node = tree::TreeNode(branchNode);
+		cache.insert(node);
+
+		// Act:
+		auto pNode = cache.find(node.hash());
+
+		// Assert: the cached branch only contains link hashes
+		ASSERT_TRUE(!!pNode);
+		ASSERT_TRUE(pNode->isBranch());
+		EXPECT_EQ(node.hash(), pNode->hash());
+
+		const auto& cachedBranchNode = pNode->asBranchNode();
+		EXPECT_EQ(2u, cachedBranchNode.numLinks());
+		EXPECT_EQ(linkedNode.hash(), cachedBranchNode.link(3));
+		EXPECT_FALSE(!!cachedBranchNode.linkedNodePointer(3));
+		EXPECT_EQ(branchNode.link(7), cachedBranchNode.link(7));
+	}
+
+	TEST(TEST_CLASS, InsertIgnoresKnownNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		auto node = CreateLeafNode(0x12);
+		cache.insert(node);
+
+		// Act:
+		cache.insert(node);
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 1);
+	}
+
+	TEST(TEST_CLASS, InsertIgnoresEmptyNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+
+		// Act:
+		cache.insert(tree::TreeNode());
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, InsertIgnoresAllNodesWhenMaxNodesIsZero) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(0);
+		auto node = CreateLeafNode(0x12);
+
+		// Act:
+		cache.insert(node);
+		auto pNode = cache.find(node.hash());
+
+		// Assert:
+		EXPECT_FALSE(!!pNode);
+		AssertStatistics(cache, 0, 1, 0);
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, InsertEvictsLeastRecentlyInsertedNodeWhenFull) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(3);
+		std::vector<tree::TreeNode> nodes;
+		for (uint8_t i = 0; i < 4; ++i)
+			nodes.push_back(CreateLeafNode(i));
+
+		// Act:
+		for (const auto& node : nodes)
+			cache.insert(node);
+
+		// Assert:
+		EXPECT_FALSE(!!cache.find(nodes[0].hash()));
+		for (auto i = 1u; i < nodes.size(); ++i)
+			EXPECT_TRUE(!!cache.find(nodes[i].hash())) << i;
+
+		AssertStatistics(cache, 3, 1, 3);
+	}
+
+	TEST(TEST_CLASS, InsertEvictsLeastRecentlyFoundNodeWhenFull) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(3);
+		std::vector<tree::TreeNode> nodes;
+		for (uint8_t i = 0; i < 4; ++i)
+			nodes.push_back(CreateLeafNode(i));
+
+		for (auto i = 0u; i < 3; ++i)
+			cache.insert(nodes[i]);
+
+		// - touch the first node so that the second node is the least recently used one
+		cache.find(nodes[0].hash());
+
+		// Act:
+		cache.insert(nodes[3]);
+
+		// Assert:
+		EXPECT_TRUE(!!cache.find(nodes[0].hash()));
+		EXPECT_FALSE(!!cache.find(nodes[1].hash()));
+		EXPECT_TRUE(!!cache.find(nodes[2].hash()));
+		EXPECT_TRUE(!!cache.find(nodes[3].hash()));
+		AssertStatistics(cache, 4, 1, 3);
+	}
+
+	TEST(TEST_CLASS, IsFullReturnsTrueOnlyWhenCacheHoldsMaxNodes) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(3);
+
+		// Act + Assert:
+		for (uint8_t i = 0; i < 4; ++i) {
+			EXPECT_EQ(3 <= i, cache.isFull()) << static_cast<int>(i);
+			cache.insert(CreateLeafNode(i));
+		}
+
+		EXPECT_TRUE(cache.isFull());
+	}
+
+	// endregion
+
+	// region warm start
+
+	namespace {
+		void SerialRunner(size_t count, const consumer<size_t>& callback) {
+			for (auto i = 0u; i < count; ++i)
+				callback(i);
+		}
+
+		class WarmStartLoaderOwner {
+		public:
+			WarmStartLoaderOwner(PatriciaTreeNodeCache& cache, size_t numNodes)
+					: m_cache(cache)
+					, m_numNodes(numNodes)
+					, m_numCalls(0) {
+				m_cache.registerWarmStartLoader(this, [this]() {
+					++m_numCalls;
+					for (auto i = 0u; i < m_numNodes; ++i)
+						m_cache.insert(CreateLeafNode(static_cast<uint8_t>(i)));
+
+					return m_numNodes;
+				});
+			}
+
+		public:
+			size_t numCalls() const {
+				return m_numCalls;
+			}
+
+			void unregister() {
+				m_cache.unregisterWarmStartLoader(this);
+			}
+
+		private:
+			PatriciaTreeNodeCache& m_cache;
+			size_t m_numNodes;
+			size_t m_numCalls;
+		};
+	}
+
+	TEST(TEST_CLASS, WarmStartHasNoEffectWhenNoLoadersAreRegistered) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+
+		// Act:
+		auto numLoadedNodes = cache.warmStart(SerialRunner);
+
+		// Assert:
+		EXPECT_EQ(0u, numLoadedNodes);
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, WarmStartRunsAllRegisteredLoaders) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		WarmStartLoaderOwner owner1(cache, 2);
+		WarmStartLoaderOwner owner2(cache, 3);
+
+		// Act:
+		auto numLoadedNodes = cache.warmStart(SerialRunner);
+
+		// Assert:
+		EXPECT_EQ(5u, numLoadedNodes);
+		EXPECT_EQ(1u, owner1.numCalls());
+		EXPECT_EQ(1u, owner2.numCalls());
+		AssertStatistics(cache, 0, 0, 5);
+	}
+
+	TEST(TEST_CLASS, WarmStartPassesNumberOfLoadersToRunner) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		WarmStartLoaderOwner owner1(cache, 2);
+		WarmStartLoaderOwner owner2(cache, 3);
+		WarmStartLoaderOwner owner3(cache, 1);
+
+		std::vector<size_t> counts;
+		auto runner = [&counts](auto count, const auto& callback) {
+			counts.push_back(count);
+			SerialRunner(count, callback);
+		};
+
+		// Act:
+		cache.warmStart(runner);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 3 }), counts);
+	}
+
+	TEST(TEST_CLASS, WarmStartDoesNotRunUnregisteredLoaders) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		WarmStartLoaderOwner owner1(cache, 2);
+		WarmStartLoaderOwner owner2(cache, 3);
+		owner1.unregister();
+
+		// Act:
+		auto numLoadedNodes = cache.warmStart(SerialRunner);
+
+		// Assert:
+		EXPECT_EQ(3u, numLoadedNodes);
+		EXPECT_EQ(0u, owner1.numCalls());
+		EXPECT_EQ(1u, owner2.numCalls());
+	}
+
+	TEST(TEST_CLASS, WarmStartRunsEachLoaderAtMostOnce) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10);
+		WarmStartLoaderOwner owner(cache, 2);
+		cache.warmStart(SerialRunner);
+
+		// Act:
+		auto numLoadedNodes = cache.warmStart(SerialRunner);
+
+		// Assert:
+		EXPECT_EQ(0u, numLoadedNodes);
+		EXPECT_EQ(1u, owner.numCalls());
+	}
+
+	// endregion
+}}
@@ -20,6 +20,7 @@
 
 #include "catapult/cache_db/PatriciaTreeRdbDataSource.h"
 #include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
 #include "tests/test/tree/PatriciaTreeDataSourceTests.h"
 
 namespace catapult { namespace cache {
@@ -73,4 +74,163 @@ namespace catapult { namespace cache {
 	}
 
 	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(RocksDataSourceTraits)
+
+	// region node cache
+
+	namespace {
+		class NodeCacheTestContext {
+		public:
+			explicit NodeCacheTestContext(size_t maxNodes = 100)
+					: m_db(DefaultSettings(m_dbDirGuard.name()))
+					, m_container(m_db, 0)
+					, m_nodeCache(maxNodes)
+			{}
+
+		public:
+			auto& container() {
+				return m_container;
+			}
+
+			auto& nodeCache() {
+				return m_nodeCache;
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			RocksDatabase m_db;
+			PatriciaTreeContainer m_container;
+			PatriciaTreeNodeCache m_nodeCache;
+		};
+
+		tree::LeafTreeNode CreateLeafNode() {
+			return tree::LeafTreeNode(tree::TreeNodePath(0x12), test::GenerateRandomByteArray<Hash256>());
+		}
+
+		std::vector<Hash256> SeedNodes(PatriciaTreeContainer& container, size_t numNodes) {
+			std::vector<Hash256> hashes;
+			PatriciaTreeRdbDataSource dataSource(container);
+			for (auto i = 0u; i < numNodes; ++i) {
+				auto node = CreateLeafNode();
+				dataSource.set(node);
+				hashes.push_back(node.hash());
+			}
+
+			container.setSize(numNodes);
+			return hashes;
+		}
+	}
+
+	TEST(TEST_CLASS, SetAddsNodeToNodeCache) {
+		// Arrange:
+		NodeCacheTestContext context;
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+		auto node = CreateLeafNode();
+
+		// Act:
+		dataSource.set(node);
+
+		// Assert: node was saved in both the container and the node cache
+		EXPECT_TRUE(context.container().cend() != context.container().find(node.hash()));
+		EXPECT_TRUE(!!context.nodeCache().find(node.hash()));
+	}
+
+	TEST(TEST_CLASS, GetReturnsNodeFromNodeCacheWhenCached) {
+		// Arrange: only add the node to the node cache
+		NodeCacheTestContext context;
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+		auto node = CreateLeafNode();
+		context.nodeCache().insert(tree::TreeNode(node));
+
+		// Act:
+		auto pNode = dataSource.get(node.hash());
+
+		// Assert:
+		ASSERT_TRUE(!!pNode);
+		EXPECT_EQ(node.hash(), pNode->hash());
+		EXPECT_EQ(1u, context.nodeCache().statistics().NumHits);
+		EXPECT_EQ(0u, context.nodeCache().statistics().NumMisses);
+	}
+
+	TEST(TEST_CLASS, GetAddsNodeToNodeCacheWhenLoadedFromContainer) {
+		// Arrange: only add the node to the container
+		NodeCacheTestContext context;
+		auto node = CreateLeafNode();
+		PatriciaTreeRdbDataSource(context.container()).set(node);
+
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+
+		// Act:
+		auto pNode1 = dataSource.get(node.hash());
+		auto pNode2 = dataSource.get(node.hash());
+
+		// Assert: first get was served by the container, second by the node cache
+		ASSERT_TRUE(!!pNode1);
+		ASSERT_TRUE(!!pNode2);
+		EXPECT_EQ(node.hash(), pNode1->hash());
+		EXPECT_EQ(node.hash(), pNode2->hash());
+
+		auto statistics = context.nodeCache().statistics();
+		EXPECT_EQ(1u, statistics.NumHits);
+		EXPECT_EQ(1u, statistics.NumMisses);
+		EXPECT_EQ(1u, statistics.Size);
+	}
+
+	TEST(TEST_CLASS, GetDoesNotAddUnknownNodeToNodeCache) {
+		// Arrange:
+		NodeCacheTestContext context;
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+
+		// Act:
+		auto pNode = dataSource.get(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_FALSE(!!pNode);
+		EXPECT_EQ(1u, context.nodeCache().statistics().NumMisses);
+		EXPECT_EQ(0u, context.nodeCache().statistics().Size);
+	}
+
+	TEST(TEST_CLASS, PreloadHasNoEffectWithoutNodeCache) {
+		// Arrange:
+		NodeCacheTestContext context;
+		SeedNodes(context.container(), 3);
+		PatriciaTreeRdbDataSource dataSource(context.container());
+
+		// Act:
+		auto numNodes = dataSource.preload();
+
+		// Assert:
+		EXPECT_EQ(0u, numNodes);
+	}
+
+	TEST(TEST_CLASS, PreloadStreamsAllNodesIntoNodeCache) {
+		// Arrange:
+		NodeCacheTestContext context;
+		auto hashes = SeedNodes(context.container(), 3);
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+
+		// Act:
+		auto numNodes = dataSource.preload();
+
+		// Assert: properties (e.g. size) are not streamed
+		EXPECT_EQ(3u, numNodes);
+		EXPECT_EQ(3u, context.nodeCache().statistics().Size);
+		for (const auto& hash : hashes)
+			EXPECT_TRUE(!!context.nodeCache().find(hash)) << hash;
+	}
+
+	TEST(TEST_CLASS, PreloadStopsWhenNodeCacheIsFull) {
+		// Arrange:
+		NodeCacheTestContext context(2);
+		SeedNodes(context.container(), 3);
+		PatriciaTreeRdbDataSource dataSource(context.container(), &context.nodeCache());
+
+		// Act:
+		auto numNodes = dataSource.preload();
+
+		// Assert:
+		EXPECT_EQ(2u, numNodes);
+		EXPECT_EQ(2u, context.nodeCache().statistics().Size);
+	}
+
+	// endregion
 }}
@@ -45,6 +45,10 @@ namespace catapult { namespace cache {
 				RdbColumnContainer::remove(key);
 			}
 
+			void prefetch(const std::vector<RawBuffer>& keys) const {
+				RdbColumnContainer::prefetch(keys);
+			}
+
 			size_t prune(uint64_t pruningBoundary) {
 				return RdbColumnContainer::prune(pruningBoundary);
 			}
@@ -290,6 +294,119 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prefetch
+
+	namespace {
+		template<typename TContainer>
+		void PutDirect(RocksDatabase& database, const TContainer& key, const std::string& value) {
+			// bypass container so that prefetched elements are not discarded
+			database.put(0, ToSlice(key), value);
+			database.flush();
+		}
+	}
+
+	TEST(TEST_CLASS, FindReturnsPrefetchedElementsFromMemory) {
+		// Arrange:
+		auto key1 = test::GenerateRandomArray<10>();
+		auto key2 = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key1](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key1), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+
+		// Act: change both elements in database after prefetching them
+		container.prefetch({ key1, key2 });
+		PutDirect(context.database(), key1, "hello");
+		PutDirect(context.database(), key2, "moon");
+
+		RdbDataIterator iter1;
+		RdbDataIterator iter2;
+		container.find(key1, iter1);
+		container.find(key2, iter2);
+
+		// Assert: prefetched values (including absence) are returned
+		test::AssertIteratorValue("world", iter1);
+		EXPECT_EQ(RdbDataIterator::End(), iter2);
+	}
+
+	TEST(TEST_CLASS, FindForwardsToGetWhenElementIsNotPrefetched) {
+		// Arrange:
+		auto key1 = test::GenerateRandomArray<10>();
+		auto key2 = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key2](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key2), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+
+		// Act:
+		container.prefetch({ key1 });
+
+		RdbDataIterator iter;
+		container.find(key2, iter);
+
+		// Assert:
+		test::AssertIteratorValue("world", iter);
+	}
+
+	TEST(TEST_CLASS, PrefetchDiscardsPreviouslyPrefetchedElements) {
+		// Arrange:
+		auto key1 = test::GenerateRandomArray<10>();
+		auto key2 = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key1](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key1), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+
+		// Act:
+		container.prefetch({ key1 });
+		PutDirect(context.database(), key1, "hello");
+		container.prefetch({ key2 });
+
+		RdbDataIterator iter;
+		container.find(key1, iter);
+
+		// Assert:
+		test::AssertIteratorValue("hello", iter);
+	}
+
+	TEST(TEST_CLASS, InsertDiscardsPrefetchedElements) {
+		// Arrange:
+		auto key = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+		container.prefetch({ key });
+
+		// Act:
+		container.insert(key, "1234567890");
+
+		// Assert:
+		RdbDataIterator iter;
+		container.find(key, iter);
+		test::AssertIteratorValue("1234567890", iter);
+	}
+
+	TEST(TEST_CLASS, RemoveDiscardsPrefetchedElements) {
+		// Arrange:
+		auto key = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+		container.prefetch({ key });
+
+		// Act:
+		container.remove(key);
+
+		// Assert:
+		RdbDataIterator iter;
+		container.find(key, iter);
+		EXPECT_EQ(RdbDataIterator::End(), iter);
+	}
+
+	// endregion
+
 	// region prune
 
 	namespace {
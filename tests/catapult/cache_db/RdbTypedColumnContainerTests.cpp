@@ -125,6 +125,8 @@ namespace catapult { namespace cache {
 		public:
 			size_t Size = 0;
 			size_t NumPruned = 0;
+			size_t NumElements = 0;
+			mutable std::vector<std::vector<RawBuffer>> PrefetchParams;
 
 			test::ParamsCapture<InsertParamsType> InsertParams;
 			mutable test::ParamsCapture<FindParamsType> FindParams;
@@ -151,6 +153,10 @@ namespace catapult { namespace cache {
 				m_db.find(key, iterator);
 			}
 
+			void prefetch(const std::vector<RawBuffer>& keys) const {
+				m_db.PrefetchParams.push_back(keys);
+			}
+
 			size_t prune(uint64_t pruningBoundary) {
 				return m_db.prune(pruningBoundary);
 			}
@@ -159,6 +165,13 @@ namespace catapult { namespace cache {
 				m_db.RemoveParams.push(key);
 			}
 
+			void forEach(const predicate<const RawBuffer&, const RawBuffer&>& sink) const {
+				for (auto i = 0u; i < m_db.NumElements; ++i) {
+					if (!sink(RawBuffer(), RawBuffer()))
+						return;
+				}
+			}
+
 		private:
 			MockDb& m_db;
 		};
@@ -235,6 +248,25 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(&iter.dbIterator(), params.pIterator);
 	}
 
+	TEST(TEST_CLASS, PrefetchSerializesKeysAndForwardsToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<test::StringKey> keys{ test::StringKey("hello"), test::StringKey("world") };
+		container.prefetch(keys);
+
+		// Assert:
+		ASSERT_EQ(1u, db.PrefetchParams.size());
+		const auto& params = db.PrefetchParams[0];
+		ASSERT_EQ(2u, params.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			EXPECT_EQ(test::AsBytePointer(keys[i].data()), params[i].pData) << i;
+			EXPECT_EQ(keys[i].size(), params[i].Size) << i;
+		}
+	}
+
 	TEST(TEST_CLASS, PruneExtractsBoundaryFromKeyAndForwardsToContainer) {
 		// Arrange:
 		MockDb db;
@@ -346,4 +378,45 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region forEachValue
+
+	TEST(TEST_CLASS, ForEachValueForwardsDeserializedValuesToSink) {
+		// Arrange:
+		MockDb db;
+		db.NumElements = 3;
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<DummyValue> values;
+		container.forEachValue([&values](const auto& value) {
+			values.push_back(value);
+			return true;
+		});
+
+		// Assert: all values contain dummy data set by deserializer
+		ASSERT_EQ(3u, values.size());
+		for (const auto& value : values) {
+			EXPECT_EQ("world", value.KeyCopy);
+			EXPECT_EQ(54321, value.Integer);
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachValueStopsWhenSinkReturnsFalse) {
+		// Arrange:
+		MockDb db;
+		db.NumElements = 3;
+		auto container = CreateContainer(db);
+
+		// Act:
+		auto numValues = 0u;
+		container.forEachValue([&numValues](const auto&) {
+			return 2 != ++numValues;
+		});
+
+		// Assert:
+		EXPECT_EQ(2u, numValues);
+	}
+
+	// endregion
 }}
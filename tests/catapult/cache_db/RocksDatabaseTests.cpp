@@ -19,10 +19,12 @@
 **/
 
 #include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksWriteQueue.h"
 #include "catapult/io/FileLock.h"
 #include "catapult/io/RawFile.h"
 #include "tests/catapult/cache_db/test/RdbTestUtils.h"
 #include "tests/catapult/cache_db/test/SliceTestUtils.h"
+#include "tests/test/nodeps/Atomics.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 #include <boost/filesystem.hpp>
@@ -131,6 +133,308 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region tuning
+
+	namespace {
+		auto CreateTuningSettings(const RocksTuningSettings& tuning) {
+			return RocksDatabaseSettings(
+					test::TempDirectoryGuard::DefaultName(),
+					{ "default", "foo" },
+					utils::FileSize(),
+					FilterPruningMode::Disabled,
+					tuning);
+		}
+
+		RocksTuningSettings CreateCustomTuning(const std::shared_ptr<RocksSharedResources>& pSharedResources) {
+			RocksTuningSettings tuning;
+			tuning.MaxBackgroundJobs = 3;
+			tuning.DefaultColumnSettings.WriteBufferSize = utils::FileSize::FromMegabytes(1);
+			tuning.DefaultColumnSettings.BloomFilterBitsPerKey = 10;
+			tuning.DefaultColumnSettings.CompressionPerLevel = "none, none";
+
+			auto& fooColumnSettings = tuning.ColumnSettings["foo"];
+			fooColumnSettings.BloomFilterBitsPerKey = 16;
+			fooColumnSettings.EnablePartitionedIndexFilters = true;
+
+			tuning.pSharedResources = pSharedResources;
+			return tuning;
+		}
+	}
+
+	TEST(TEST_CLASS, CanOpenDatabaseWithCustomTuning) {
+		// Arrange:
+		auto pSharedResources = std::make_shared<RocksSharedResources>(utils::FileSize::FromMegabytes(1), true);
+		test::RdbTestContext context(CreateTuningSettings(CreateCustomTuning(pSharedResources)));
+		auto& database = context.database();
+
+		// Act:
+		database.put(0, "hello", "amazing");
+		database.put(1, "world", "awesome");
+		database.flush();
+
+		// Assert:
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		test::AssertIteratorValue("amazing", iter);
+
+		database.get(1, "world", iter);
+		test::AssertIteratorValue("awesome", iter);
+	}
+
+	TEST(TEST_CLASS, CanOpenDatabaseWithPartitionedIndexWithoutBloomFilters) {
+		// Arrange:
+		RocksTuningSettings tuning;
+		tuning.DefaultColumnSettings.EnablePartitionedIndexFilters = true;
+		test::RdbTestContext context(CreateTuningSettings(tuning));
+		auto& database = context.database();
+
+		// Act:
+		database.put(0, "hello", "amazing");
+		database.flush();
+
+		// Assert:
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		test::AssertIteratorValue("amazing", iter);
+	}
+
+	TEST(TEST_CLASS, RdbThrowsWhenCompressionCodecIsUnknown) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		RocksTuningSettings tuning;
+		tuning.ColumnSettings["foo"].CompressionPerLevel = "none,lz5";
+
+		// Act + Assert:
+		EXPECT_THROW(RocksDatabase(CreateTuningSettings(tuning)), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, DatabaseCollectsStatisticsInSharedResources) {
+		// Arrange:
+		auto pSharedResources = std::make_shared<RocksSharedResources>(utils::FileSize::FromMegabytes(1), true);
+		test::RdbTestContext context(CreateTuningSettings(CreateCustomTuning(pSharedResources)));
+		auto& database = context.database();
+
+		for (auto i = 0u; i < 100; ++i)
+			database.put(0, std::to_string(i), std::string(100, static_cast<char>('a' + i % 26)));
+
+		database.flush();
+
+		// Act:
+		RdbDataIterator iter;
+		for (auto i = 0u; i < 100; ++i)
+			database.get(0, std::to_string(i), iter);
+
+		auto statistics = pSharedResources->collectStatistics();
+
+		// Assert: values are read from memtable, so only read bytes are guaranteed to be nonzero
+		EXPECT_EQ(100u * 100, statistics.NumBytesRead);
+	}
+
+	// endregion
+
+	// region write behind
+
+	namespace {
+		class WriteBehindTestContext {
+		public:
+			WriteBehindTestContext()
+					: m_pWriteQueue(std::make_shared<RocksWriteQueue>(10))
+					, m_pIsUnblocked(m_isUnblocked.state())
+					, m_rdbContext(CreateTuningSettings(CreateWriteBehindTuning(m_pWriteQueue)))
+			{}
+
+			~WriteBehindTestContext() {
+				// writer needs to be unblocked before the database waits for its pending writes
+				unblockWriter();
+			}
+
+		public:
+			RocksDatabase& database() {
+				return m_rdbContext.database();
+			}
+
+			RocksWriteQueue& writeQueue() {
+				return *m_pWriteQueue;
+			}
+
+		public:
+			void blockWriter() {
+				std::atomic_bool isBlocked(false);
+				m_pWriteQueue->push([pIsUnblocked = m_pIsUnblocked, &isBlocked]() {
+					isBlocked = true;
+					pIsUnblocked->wait();
+				});
+				WAIT_FOR(isBlocked);
+			}
+
+			void unblockWriter() {
+				m_pIsUnblocked->set();
+			}
+
+		private:
+			static RocksTuningSettings CreateWriteBehindTuning(const std::shared_ptr<RocksWriteQueue>& pWriteQueue) {
+				RocksTuningSettings tuning;
+				tuning.pWriteQueue = pWriteQueue;
+				return tuning;
+			}
+
+		private:
+			std::shared_ptr<RocksWriteQueue> m_pWriteQueue;
+			test::AutoSetFlag m_isUnblocked;
+			std::shared_ptr<test::AutoSetFlag::State> m_pIsUnblocked;
+			test::RdbTestContext m_rdbContext;
+		};
+	}
+
+	TEST(TEST_CLASS, WriteBehindIsEnabledOnlyWhenWriteQueueIsPresent) {
+		// Arrange:
+		test::RdbTestContext context1(DefaultSettings());
+		WriteBehindTestContext context2;
+
+		// Act + Assert:
+		EXPECT_FALSE(context1.database().isWriteBehindEnabled());
+		EXPECT_TRUE(context2.database().isWriteBehindEnabled());
+	}
+
+	TEST(TEST_CLASS, FlushQueuesBatchWhenWriteBehindIsEnabled) {
+		// Arrange:
+		WriteBehindTestContext context;
+		auto& database = context.database();
+		context.blockWriter();
+
+		database.put(0, "hello", "amazing");
+
+		// Act:
+		database.flush();
+
+		// Assert: blocking operation and batch are pending
+		EXPECT_EQ(2u, context.writeQueue().numPendingOperations());
+
+		// - batch is written after writer is unblocked
+		context.unblockWriter();
+		context.writeQueue().drain();
+		EXPECT_EQ(0u, context.writeQueue().numPendingOperations());
+	}
+
+	TEST(TEST_CLASS, FlushedValuesAreReadableBeforeBatchIsWritten) {
+		// Arrange:
+		WriteBehindTestContext context;
+		auto& database = context.database();
+		database.put(0, "hello", "amazing");
+		database.put(1, "world", "awesome");
+		database.flush();
+		context.writeQueue().drain();
+
+		context.blockWriter();
+
+		// Act: overwrite a written value and delete another one
+		database.put(0, "hello", "fantastic");
+		database.del(1, "world");
+		database.put(1, "alpha", "omega");
+		database.flush();
+
+		// Assert:
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		test::AssertIteratorValue("fantastic", iter);
+
+		database.get(1, "world", iter);
+		EXPECT_EQ(RdbDataIterator::End(), iter);
+
+		database.get(1, "alpha", iter);
+		test::AssertIteratorValue("omega", iter);
+	}
+
+	TEST(TEST_CLASS, MultiGetReadsPendingAndWrittenValues) {
+		// Arrange:
+		WriteBehindTestContext context;
+		auto& database = context.database();
+		database.put(0, "hello", "amazing");
+		database.put(0, "world", "awesome");
+		database.flush();
+		context.writeQueue().drain();
+
+		context.blockWriter();
+		database.put(0, "alpha", "omega");
+		database.del(0, "world");
+		database.flush();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "world", "alpha", "beta", "hello" }, iters);
+
+		// Assert:
+		ASSERT_EQ(4u, iters.size());
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+		test::AssertIteratorValue("omega", iters[1]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[2]);
+		test::AssertIteratorValue("amazing", iters[3]);
+	}
+
+	TEST(TEST_CLASS, NewerPendingBatchesTakePrecedenceOverOlderPendingBatches) {
+		// Arrange:
+		WriteBehindTestContext context;
+		auto& database = context.database();
+		context.blockWriter();
+
+		// Act:
+		database.put(0, "hello", "amazing");
+		database.flush();
+		database.put(0, "hello", "awesome");
+		database.flush();
+
+		// Assert:
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		test::AssertIteratorValue("awesome", iter);
+	}
+
+	TEST(TEST_CLASS, ValuesRemainReadableAfterBatchIsWritten) {
+		// Arrange:
+		WriteBehindTestContext context;
+		auto& database = context.database();
+		database.put(0, "hello", "amazing");
+		database.flush();
+
+		// Act:
+		context.writeQueue().drain();
+
+		// Assert:
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		test::AssertIteratorValue("amazing", iter);
+	}
+
+	TEST(TEST_CLASS, ForEachWaitsForPendingBatches) {
+		// Arrange:
+		WriteBehindTestContext context;
+		auto& database = context.database();
+		context.blockWriter();
+
+		database.put(0, "hello", "amazing");
+		database.put(0, "world", "awesome");
+		database.flush();
+
+		// Act: unblock the writer from a separate thread while forEach is waiting
+		std::thread unblockThread([&context]() {
+			test::Sleep(20);
+			context.unblockWriter();
+		});
+
+		std::vector<std::string> keys;
+		database.forEach(0, [&keys](const auto& key, const auto&) {
+			keys.emplace_back(reinterpret_cast<const char*>(key.pData), key.Size);
+			return true;
+		});
+		unblockThread.join();
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::string>({ "hello", "world" }), keys);
+		EXPECT_EQ(0u, context.writeQueue().numPendingOperations());
+	}
+
+	// endregion
+
 	// region single value
 
 	TEST(TEST_CLASS, ReadingNonexistentKeyReturnsSentinelValue) {
@@ -244,6 +548,23 @@ namespace catapult { namespace cache {
 		EXPECT_THROW(database.del(0, "hello"), catapult_invalid_argument);
 	}
 
+	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowForEach) {
+		// Arrange:
+		RocksDatabase database;
+
+		// Act + Assert:
+		EXPECT_THROW(database.forEach(0, [](const auto&, const auto&) { return true; }), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowMultiGet) {
+		// Arrange:
+		RocksDatabase database;
+
+		// Act + Assert:
+		std::vector<RdbDataIterator> iters;
+		EXPECT_THROW(database.multiGet(0, { "hello" }, iters), catapult_invalid_argument);
+	}
+
 	// endregion
 
 	namespace {
@@ -451,6 +772,152 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region multiGet
+
+	TEST(TEST_CLASS, MultiGetWithNoKeysReturnsNoValues) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+		});
+
+		// Act:
+		std::vector<RdbDataIterator> iters(3);
+		context.database().multiGet(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
+	TEST(TEST_CLASS, MultiGetCanReadExistentAndNonexistentValues) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+		});
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		context.database().multiGet(0, { "world", "alpha", "hello" }, iters);
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+	}
+
+	TEST(TEST_CLASS, MultiGetOnlyReadsValuesInSpecifiedColumn) {
+		// Arrange:
+		test::RdbTestContext context(MultiColumnSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "awesome");
+		});
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		context.database().multiGet(1, { "hello" }, iters);
+
+		// Assert:
+		ASSERT_EQ(1u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+	}
+
+	TEST(TEST_CLASS, MultiGetDoesNotReturnBatchedValues) {
+		// Arrange:
+		test::RdbTestContext context(BatchSettings());
+		auto& database = context.database();
+		database.put(0, "hello", "amazing");
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "hello" }, iters);
+
+		// Assert: batch wasn't finalized
+		ASSERT_EQ(1u, iters.size());
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+	}
+
+	// endregion
+
+	// region forEach
+
+	namespace {
+		using KeyValuePairs = std::vector<std::pair<std::string, std::string>>;
+
+		KeyValuePairs CollectAll(const RocksDatabase& database, size_t columnId, size_t maxPairs = std::numeric_limits<size_t>::max()) {
+			KeyValuePairs pairs;
+			database.forEach(columnId, [maxPairs, &pairs](const auto& key, const auto& value) {
+				pairs.emplace_back(
+						std::string(reinterpret_cast<const char*>(key.pData), key.Size),
+						std::string(reinterpret_cast<const char*>(value.pData), value.Size));
+				return maxPairs != pairs.size();
+			});
+
+			return pairs;
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachVisitsNothingWhenColumnIsEmpty) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings());
+
+		// Act:
+		auto pairs = CollectAll(context.database(), 0);
+
+		// Assert:
+		EXPECT_TRUE(pairs.empty());
+	}
+
+	TEST(TEST_CLASS, ForEachVisitsAllValuesInKeyOrder) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[0], "alpha", "omega");
+		});
+
+		// Act:
+		auto pairs = CollectAll(context.database(), 0);
+
+		// Assert:
+		KeyValuePairs expectedPairs{ { "alpha", "omega" }, { "hello", "amazing" }, { "world", "awesome" } };
+		EXPECT_EQ(expectedPairs, pairs);
+	}
+
+	TEST(TEST_CLASS, ForEachOnlyVisitsValuesInSpecifiedColumn) {
+		// Arrange:
+		test::RdbTestContext context(MultiColumnSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "world", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[2], "alpha", "omega");
+		});
+
+		// Act:
+		auto pairs = CollectAll(context.database(), 1);
+
+		// Assert:
+		KeyValuePairs expectedPairs{ { "world", "awesome" } };
+		EXPECT_EQ(expectedPairs, pairs);
+	}
+
+	TEST(TEST_CLASS, ForEachStopsWhenSinkReturnsFalse) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[0], "alpha", "omega");
+		});
+
+		// Act:
+		auto pairs = CollectAll(context.database(), 0, 2);
+
+		// Assert:
+		KeyValuePairs expectedPairs{ { "alpha", "omega" }, { "hello", "amazing" } };
+		EXPECT_EQ(expectedPairs, pairs);
+	}
+
+	// endregion
+
 	// region pruning
 
 	namespace {
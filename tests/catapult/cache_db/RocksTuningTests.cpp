@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "catapult/cache_db/RocksTuning.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS RocksTuningTests
+
+	// region RocksSharedResources
+
+	TEST(TEST_CLASS, CanCreateSharedResourcesWithoutBlockCacheOrStatistics) {
+		// Act:
+		RocksSharedResources resources(utils::FileSize(), false);
+		auto statistics = resources.collectStatistics();
+
+		// Assert:
+		EXPECT_FALSE(!!resources.blockCache());
+		EXPECT_FALSE(!!resources.statistics());
+
+		EXPECT_EQ(0u, statistics.NumBlockCacheHits);
+		EXPECT_EQ(0u, statistics.NumBlockCacheMisses);
+		EXPECT_EQ(0u, statistics.BlockCacheUsage);
+		EXPECT_EQ(0u, statistics.StallMicros);
+		EXPECT_EQ(0u, statistics.NumBytesRead);
+		EXPECT_EQ(0u, statistics.NumCompactionBytesWritten);
+	}
+
+	TEST(TEST_CLASS, CanCreateSharedResourcesWithBlockCacheAndStatistics) {
+		// Act:
+		RocksSharedResources resources(utils::FileSize::FromMegabytes(1), true);
+		auto statistics = resources.collectStatistics();
+
+		// Assert:
+		EXPECT_TRUE(!!resources.blockCache());
+		EXPECT_TRUE(!!resources.statistics());
+
+		EXPECT_EQ(0u, statistics.NumBlockCacheHits);
+		EXPECT_EQ(0u, statistics.NumBlockCacheMisses);
+		EXPECT_EQ(0u, statistics.StallMicros);
+		EXPECT_EQ(0u, statistics.NumBytesRead);
+		EXPECT_EQ(0u, statistics.NumCompactionBytesWritten);
+	}
+
+	// endregion
+
+	// region RocksTuningSettings
+
+	TEST(TEST_CLASS, ColumnSettingsReturnsCustomSettingsWhenPresent) {
+		// Arrange:
+		RocksTuningSettings tuning;
+		tuning.DefaultColumnSettings.BloomFilterBitsPerKey = 10;
+		tuning.ColumnSettings["foo"].BloomFilterBitsPerKey = 16;
+
+		// Act:
+		const auto& columnSettings = tuning.columnSettings("foo");
+
+		// Assert:
+		EXPECT_EQ(&tuning.ColumnSettings["foo"], &columnSettings);
+		EXPECT_EQ(16u, columnSettings.BloomFilterBitsPerKey);
+	}
+
+	TEST(TEST_CLASS, ColumnSettingsReturnsDefaultSettingsWhenCustomSettingsAreNotPresent) {
+		// Arrange:
+		RocksTuningSettings tuning;
+		tuning.DefaultColumnSettings.BloomFilterBitsPerKey = 10;
+		tuning.ColumnSettings["foo"].BloomFilterBitsPerKey = 16;
+
+		// Act:
+		const auto& columnSettings = tuning.columnSettings("bar");
+
+		// Assert:
+		EXPECT_EQ(&tuning.DefaultColumnSettings, &columnSettings);
+		EXPECT_EQ(10u, columnSettings.BloomFilterBitsPerKey);
+	}
+
+	// endregion
+}}
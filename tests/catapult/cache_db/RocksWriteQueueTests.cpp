@@ -0,0 +1,170 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksWriteQueue.h"
+#include "tests/test/nodeps/Atomics.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS RocksWriteQueueTests
+
+	// region constructor / destructor
+
+	TEST(TEST_CLASS, CannotCreateQueueWithZeroMaxPendingOperations) {
+		EXPECT_THROW(RocksWriteQueue(0), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateQueue) {
+		// Act:
+		RocksWriteQueue queue(7);
+
+		// Assert:
+		EXPECT_EQ(7u, queue.maxPendingOperations());
+		EXPECT_EQ(0u, queue.numPendingOperations());
+	}
+
+	TEST(TEST_CLASS, DestructorExecutesAllPendingOperations) {
+		// Arrange:
+		std::atomic<size_t> numExecutions(0);
+		{
+			RocksWriteQueue queue(10);
+			for (auto i = 0u; i < 5; ++i) {
+				queue.push([&numExecutions]() {
+					test::Sleep(5);
+					++numExecutions;
+				});
+			}
+
+			// Act: destroy the queue
+		}
+
+		// Assert:
+		EXPECT_EQ(5u, numExecutions);
+	}
+
+	// endregion
+
+	// region push / drain
+
+	TEST(TEST_CLASS, OperationsAreExecutedInOrder) {
+		// Arrange:
+		std::vector<size_t> executionOrder;
+		RocksWriteQueue queue(3);
+
+		// Act:
+		for (auto i = 0u; i < 10; ++i)
+			queue.push([&executionOrder, i]() { executionOrder.push_back(i); });
+
+		queue.drain();
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }), executionOrder);
+		EXPECT_EQ(0u, queue.numPendingOperations());
+	}
+
+	TEST(TEST_CLASS, NumPendingOperationsIncludesRunningOperation) {
+		// Arrange:
+		RocksWriteQueue queue(5);
+		test::AutoSetFlag isUnblocked;
+		auto pIsUnblocked = isUnblocked.state();
+		std::atomic_bool isRunning(false);
+
+		// Act: block the writer thread and queue two more operations
+		queue.push([pIsUnblocked, &isRunning]() {
+			isRunning = true;
+			pIsUnblocked->wait();
+		});
+		queue.push([]() {});
+		queue.push([]() {});
+		WAIT_FOR(isRunning);
+
+		// Assert:
+		EXPECT_EQ(3u, queue.numPendingOperations());
+
+		// Sanity:
+		pIsUnblocked->set();
+		queue.drain();
+		EXPECT_EQ(0u, queue.numPendingOperations());
+	}
+
+	TEST(TEST_CLASS, PushBlocksWhileQueueIsFull) {
+		// Arrange:
+		RocksWriteQueue queue(2);
+		test::AutoSetFlag isUnblocked;
+		auto pIsUnblocked = isUnblocked.state();
+		std::atomic_bool isRunning(false);
+
+		// - block the writer thread and fill the queue
+		queue.push([pIsUnblocked, &isRunning]() {
+			isRunning = true;
+			pIsUnblocked->wait();
+		});
+		WAIT_FOR(isRunning);
+		queue.push([]() {});
+		queue.push([]() {});
+
+		// Act: push another operation from a separate thread
+		std::atomic_bool isPushed(false);
+		boost::thread pushThread([&queue, &isPushed]() {
+			queue.push([]() {});
+			isPushed = true;
+		});
+
+		// Assert: push is blocked until the writer thread makes progress
+		test::Sleep(50);
+		EXPECT_FALSE(isPushed);
+
+		pIsUnblocked->set();
+		pushThread.join();
+		EXPECT_TRUE(isPushed);
+	}
+
+	TEST(TEST_CLASS, DrainWaitsForPreviouslyQueuedOperations) {
+		// Arrange:
+		std::atomic<size_t> numExecutions(0);
+		RocksWriteQueue queue(10);
+		for (auto i = 0u; i < 5; ++i) {
+			queue.push([&numExecutions]() {
+				test::Sleep(5);
+				++numExecutions;
+			});
+		}
+
+		// Act:
+		queue.drain();
+
+		// Assert:
+		EXPECT_EQ(5u, numExecutions);
+		EXPECT_EQ(0u, queue.numPendingOperations());
+	}
+
+	TEST(TEST_CLASS, DrainReturnsImmediatelyWhenQueueIsEmpty) {
+		// Arrange:
+		RocksWriteQueue queue(1);
+
+		// Act + Assert: no exception, no deadlock
+		queue.drain();
+		EXPECT_EQ(0u, queue.numPendingOperations());
+	}
+
+	// endregion
+}}
@@ -866,14 +866,14 @@ namespace catapult { namespace cache {
 			AddAll(cache, transactionInfos);
 
 			// - mark all transactions as known (with different cosignatures) and add three cosignatures per info
-			ShortHashPairMap knownShortHashes;
+			std::vector<ShortHashPair> knownShortHashPairs;
 			for (const auto& transactionInfo : transactionInfos) {
-				knownShortHashes.emplace(utils::ToShortHash(transactionInfo.EntityHash), utils::ShortHash());
+				knownShortHashPairs.push_back({ utils::ToShortHash(transactionInfo.EntityHash), utils::ShortHash() });
 				AddAll(cache, transactionInfo, test::GenerateRandomDataVector<model::Cosignature>(3));
 			}
 
 			// Act:
-			auto unknownInfos = cache.view().unknownTransactions(knownShortHashes);
+			auto unknownInfos = cache.view().unknownTransactions(ShortHashPairMap(std::move(knownShortHashPairs)));
 
 			// Assert: notice that no ordering is guaranteed
 			EXPECT_EQ(numExpectedTransactions, unknownInfos.size());
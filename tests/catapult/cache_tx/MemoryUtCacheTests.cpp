@@ -295,6 +295,28 @@ namespace catapult { namespace cache {
 		test::AssertDeadlines(*pCache, { 2, 4, 6, 8, 10, 1, 2, 3, 4, 5 });
 	}
 
+	TEST(TEST_CLASS, RemovingMostTransactionInfosPreservesInsertionOrderAndLookups) {
+		// Arrange:
+		auto pCache = test::CreateSeededMemoryUtCache(300);
+		std::vector<Hash256> hashes;
+		pCache->view().forEach([&hashes](const auto& info) {
+			hashes.push_back(info.EntityHash);
+			return true;
+		});
+
+		// Act: remove enough transaction infos to trigger compaction of the underlying storage
+		test::RemoveAll(*pCache, std::vector<Hash256>(hashes.cbegin(), hashes.cbegin() + 295));
+		test::AddAll(*pCache, test::CreateTransactionInfos(2));
+
+		// Assert:
+		AssertCacheSize(*pCache, 7);
+		test::AssertDeadlines(*pCache, { 296, 297, 298, 299, 300, 1, 2 });
+
+		auto view = pCache->view();
+		for (auto i = 0u; i < hashes.size(); ++i)
+			EXPECT_EQ(i >= 295, view.contains(hashes[i])) << "hash at " << i;
+	}
+
 	// endregion
 
 	// region count
@@ -505,6 +527,122 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEach (max fee multiplier order)
+
+	namespace {
+		// max fee multipliers { 2, 5, 1, 5, 3, 1 }
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithMaxFeeMultipliers() {
+			return test::CreateTransactionInfosFromSizeMultiplierPairs({
+				{ 200, 20 }, { 200, 50 }, { 200, 10 }, { 200, 50 }, { 200, 30 }, { 200, 10 }
+			});
+		}
+
+		std::vector<Hash256> ExtractHashes(
+				const MemoryUtCache& cache,
+				MaxFeeMultiplierOrder order,
+				size_t numRequested = std::numeric_limits<size_t>::max()) {
+			std::vector<Hash256> hashes;
+			cache.view().forEach(order, [numRequested, &hashes](const auto& info) {
+				hashes.push_back(info.EntityHash);
+				return numRequested != hashes.size();
+			});
+			return hashes;
+		}
+
+		std::vector<Hash256> SelectHashes(
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				const std::vector<size_t>& indexes) {
+			std::vector<Hash256> hashes;
+			for (auto index : indexes)
+				hashes.push_back(transactionInfos[index].EntityHash);
+
+			return hashes;
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierForwardsNoTransactionInfosWhenCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act + Assert:
+		EXPECT_TRUE(ExtractHashes(cache, MaxFeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(ExtractHashes(cache, MaxFeeMultiplierOrder::Descending).empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierForwardsAllTransactionsInDescendingOrder) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers();
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto hashes = ExtractHashes(cache, MaxFeeMultiplierOrder::Descending);
+
+		// Assert: older transactions are forwarded first when multipliers are equal
+		EXPECT_EQ(SelectHashes(transactionInfos, { 1, 3, 4, 0, 2, 5 }), hashes);
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierForwardsAllTransactionsInAscendingOrder) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers();
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto hashes = ExtractHashes(cache, MaxFeeMultiplierOrder::Ascending);
+
+		// Assert: older transactions are forwarded first when multipliers are equal
+		EXPECT_EQ(SelectHashes(transactionInfos, { 2, 5, 0, 4, 1, 3 }), hashes);
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierForwardsSubsetOfTransactionsWhenShortCircuited) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers();
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto ascendingHashes = ExtractHashes(cache, MaxFeeMultiplierOrder::Ascending, 3);
+		auto descendingHashes = ExtractHashes(cache, MaxFeeMultiplierOrder::Descending, 3);
+
+		// Assert:
+		EXPECT_EQ(SelectHashes(transactionInfos, { 2, 5, 0 }), ascendingHashes);
+		EXPECT_EQ(SelectHashes(transactionInfos, { 1, 3, 4 }), descendingHashes);
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierDoesNotForwardRemovedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers();
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(transactionInfos[1].EntityHash);
+			modifier.remove(transactionInfos[2].EntityHash);
+		}
+
+		// Assert:
+		EXPECT_EQ(SelectHashes(transactionInfos, { 5, 0, 4, 3 }), ExtractHashes(cache, MaxFeeMultiplierOrder::Ascending));
+		EXPECT_EQ(SelectHashes(transactionInfos, { 3, 4, 0, 5 }), ExtractHashes(cache, MaxFeeMultiplierOrder::Descending));
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierDoesNotForwardTransactionsAfterRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithMaxFeeMultipliers());
+
+		// Act:
+		cache.modifier().removeAll();
+
+		// Assert:
+		EXPECT_TRUE(ExtractHashes(cache, MaxFeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(ExtractHashes(cache, MaxFeeMultiplierOrder::Descending).empty());
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsAllShortHashes) {
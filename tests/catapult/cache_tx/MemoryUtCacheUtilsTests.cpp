@@ -204,5 +204,73 @@ namespace catapult { namespace cache {
 			test::AssertEqual(*allTransactionInfos[9 - i * 2], *transactionInfos[i], "transaction at " + std::to_string(i));
 	}
 
+	// endregion
+	// region MaxFeeMultiplierFiltered
+
+	namespace {
+		// max fee multipliers { 2, 5, 1, 5, 3, 1 }
+		auto SeedMemoryUtCacheWithMaxFeeMultipliers(MemoryUtCache& utCache) {
+			auto transactionInfos = test::CreateTransactionInfosFromSizeMultiplierPairs({
+				{ 200, 20 }, { 200, 50 }, { 200, 10 }, { 200, 50 }, { 200, 30 }, { 200, 10 }
+			});
+			test::AddAll(utCache, transactionInfos);
+			return transactionInfos;
+		}
+
+		void AssertTransactionInfos(
+				const std::vector<model::TransactionInfo>& allTransactionInfos,
+				const std::vector<size_t>& expectedIndexes,
+				const std::vector<const model::TransactionInfo*>& transactionInfos) {
+			ASSERT_EQ(expectedIndexes.size(), transactionInfos.size());
+			for (auto i = 0u; i < transactionInfos.size(); ++i)
+				test::AssertEqual(allTransactionInfos[expectedIndexes[i]], *transactionInfos[i], "transaction at " + std::to_string(i));
+		}
+
+		void AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder order, uint32_t count, const std::vector<size_t>& expectedIndexes) {
+			// Arrange:
+			MemoryUtCache utCache(MemoryCacheOptions(1000, 1000));
+			auto allTransactionInfos = SeedMemoryUtCacheWithMaxFeeMultipliers(utCache);
+			auto utCacheView = utCache.view();
+
+			// Act:
+			auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, count, order, [](const auto&) { return true; });
+
+			// Assert:
+			AssertTransactionInfos(allTransactionInfos, expectedIndexes, transactionInfos);
+		}
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersReturnsNoTransactionInfosWhenZeroAreRequested_MaxFeeMultiplierFiltered) {
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Ascending, 0, {});
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Descending, 0, {});
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesAscendingOrdering_MaxFeeMultiplierFiltered) {
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Ascending, 4, { 2, 5, 0, 4 });
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Ascending, 10, { 2, 5, 0, 4, 1, 3 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesDescendingOrdering_MaxFeeMultiplierFiltered) {
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Descending, 4, { 1, 3, 4, 0 });
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Descending, 10, { 1, 3, 4, 0, 2, 5 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesFiltering_MaxFeeMultiplierFiltered) {
+		// Arrange:
+		MemoryUtCache utCache(MemoryCacheOptions(1000, 1000));
+		auto allTransactionInfos = SeedMemoryUtCacheWithMaxFeeMultipliers(utCache);
+		auto utCacheView = utCache.view();
+
+		// Act: filter second transaction
+		const auto& filteredHash = allTransactionInfos[1].EntityHash;
+		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 3, MaxFeeMultiplierOrder::Descending, [&filteredHash](
+				const auto& transactionInfo) {
+			return filteredHash != transactionInfo.EntityHash;
+		});
+
+		// Assert: (3, 4, 0) should be returned; if count was applied first, only (3, 4) would be returned
+		AssertTransactionInfos(allTransactionInfos, { 3, 4, 0 }, transactionInfos);
+	}
+
 	// endregion
 }}
@@ -55,4 +55,97 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region ShortHashPairMap
+
+	namespace {
+		std::pair<utils::ShortHash, utils::ShortHash> MakePair(uint32_t transactionShortHash, uint32_t cosignaturesShortHash) {
+			return std::make_pair(utils::ShortHash(transactionShortHash), utils::ShortHash(cosignaturesShortHash));
+		}
+
+		void AssertFind(const ShortHashPairMap& map, uint32_t transactionShortHash, uint32_t expectedCosignaturesShortHash) {
+			const auto* pCosignaturesShortHash = map.find(utils::ShortHash(transactionShortHash));
+			ASSERT_TRUE(!!pCosignaturesShortHash) << transactionShortHash;
+			EXPECT_EQ(utils::ShortHash(expectedCosignaturesShortHash), *pCosignaturesShortHash) << transactionShortHash;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptyShortHashPairMap) {
+		// Act:
+		ShortHashPairMap map;
+
+		// Assert:
+		EXPECT_EQ(0u, map.size());
+		EXPECT_TRUE(map.empty());
+		EXPECT_FALSE(!!map.find(utils::ShortHash(0)));
+	}
+
+	TEST(TEST_CLASS, CanCreateShortHashPairMapFromInitializerList) {
+		// Act:
+		ShortHashPairMap map{ MakePair(30, 3), MakePair(10, 1), MakePair(20, 2) };
+
+		// Assert:
+		EXPECT_EQ(3u, map.size());
+		EXPECT_FALSE(map.empty());
+		AssertFind(map, 10, 1);
+		AssertFind(map, 20, 2);
+		AssertFind(map, 30, 3);
+	}
+
+	TEST(TEST_CLASS, CanCreateShortHashPairMapFromVector) {
+		// Arrange:
+		std::vector<ShortHashPair> pairs{
+			{ utils::ShortHash(30), utils::ShortHash(3) },
+			{ utils::ShortHash(10), utils::ShortHash(1) },
+			{ utils::ShortHash(20), utils::ShortHash(2) }
+		};
+
+		// Act:
+		ShortHashPairMap map(std::move(pairs));
+
+		// Assert:
+		EXPECT_EQ(3u, map.size());
+		AssertFind(map, 10, 1);
+		AssertFind(map, 20, 2);
+		AssertFind(map, 30, 3);
+	}
+
+	TEST(TEST_CLASS, ShortHashPairMapKeepsFirstPairForDuplicateTransactionShortHashes) {
+		// Act:
+		ShortHashPairMap map{ MakePair(30, 3), MakePair(10, 1), MakePair(30, 7), MakePair(20, 2), MakePair(10, 8) };
+
+		// Assert:
+		EXPECT_EQ(3u, map.size());
+		AssertFind(map, 10, 1);
+		AssertFind(map, 20, 2);
+		AssertFind(map, 30, 3);
+	}
+
+	TEST(TEST_CLASS, ShortHashPairMapFindReturnsNullptrForUnknownTransactionShortHashes) {
+		// Arrange:
+		ShortHashPairMap map{ MakePair(30, 3), MakePair(10, 1), MakePair(20, 2) };
+
+		// Act + Assert: cosignatures short hashes are not keys
+		for (auto rawShortHash : { 0u, 1u, 2u, 3u, 15u, 25u, 35u })
+			EXPECT_FALSE(!!map.find(utils::ShortHash(rawShortHash))) << rawShortHash;
+	}
+
+	TEST(TEST_CLASS, ShortHashPairMapsWithSamePairsAreEqual) {
+		// Arrange:
+		ShortHashPairMap map1{ MakePair(30, 3), MakePair(10, 1) };
+		ShortHashPairMap map2{ MakePair(10, 1), MakePair(30, 3) };
+		ShortHashPairMap map3{ MakePair(10, 1), MakePair(30, 4) };
+		ShortHashPairMap map4{ MakePair(10, 1), MakePair(31, 3) };
+
+		// Act + Assert:
+		EXPECT_TRUE(map1 == map2);
+		EXPECT_FALSE(map1 != map2);
+
+		for (const auto* pMap : { &map3, &map4 }) {
+			EXPECT_FALSE(map1 == *pMap);
+			EXPECT_TRUE(map1 != *pMap);
+		}
+	}
+
+	// endregion
 }}
@@ -0,0 +1,494 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/TransactionDataContainer.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TransactionDataContainerTests
+
+	namespace {
+		void InsertAll(TransactionDataContainer& container, const std::vector<model::TransactionInfo>& transactionInfos) {
+			for (const auto& transactionInfo : transactionInfos)
+				container.insert(transactionInfo, container.slotCount() + 1);
+		}
+
+		std::vector<Timestamp::ValueType> ExtractDeadlines(const TransactionDataContainer& container) {
+			std::vector<Timestamp::ValueType> deadlines;
+			container.forEach([&deadlines](const auto& data) {
+				deadlines.push_back(data.pEntity->Deadline.unwrap());
+				return true;
+			});
+			return deadlines;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractDeadlines(const TransactionDataContainer& container, MaxFeeMultiplierOrder order) {
+			std::vector<Timestamp::ValueType> deadlines;
+			container.forEach(order, [&deadlines](const auto& data) {
+				deadlines.push_back(data.pEntity->Deadline.unwrap());
+				return true;
+			});
+			return deadlines;
+		}
+
+		std::vector<Timestamp::ValueType> CreateDeadlines(size_t start, size_t end) {
+			std::vector<Timestamp::ValueType> deadlines;
+			for (auto i = start; i <= end; ++i)
+				deadlines.push_back(i);
+
+			return deadlines;
+		}
+
+		void RemoveRange(
+				TransactionDataContainer& container,
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				size_t start,
+				size_t end) {
+			for (auto i = start; i < end; ++i)
+				container.remove(transactionInfos[i].EntityHash);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyContainer) {
+		// Act:
+		TransactionDataContainer container;
+
+		// Assert:
+		EXPECT_EQ(0u, container.size());
+		EXPECT_TRUE(container.empty());
+		EXPECT_EQ(0u, container.slotCount());
+		EXPECT_TRUE(ExtractDeadlines(container).empty());
+	}
+
+	// endregion
+
+	// region insert / find
+
+	TEST(TEST_CLASS, CanInsertTransactionInfos) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(5);
+
+		// Act:
+		for (auto i = 0u; i < transactionInfos.size(); ++i)
+			EXPECT_TRUE(container.insert(transactionInfos[i], 10 + i));
+
+		// Assert:
+		EXPECT_EQ(5u, container.size());
+		EXPECT_FALSE(container.empty());
+		EXPECT_EQ(5u, container.slotCount());
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 3, 4, 5 }), ExtractDeadlines(container));
+
+		for (auto i = 0u; i < transactionInfos.size(); ++i) {
+			const auto* pData = container.find(transactionInfos[i].EntityHash);
+			ASSERT_TRUE(!!pData) << "info at " << i;
+			EXPECT_EQ(10 + i, pData->Id) << "info at " << i;
+			EXPECT_EQ(transactionInfos[i].pEntity, pData->pEntity) << "info at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotInsertTransactionInfoWithSameHashTwice) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfo = test::CreateTransactionInfoWithDeadline(7);
+		container.insert(transactionInfo, 1);
+
+		// Act:
+		auto result = container.insert(transactionInfo, 2);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(1u, container.size());
+		EXPECT_EQ(1u, container.slotCount());
+		EXPECT_EQ(1u, container.find(transactionInfo.EntityHash)->Id);
+	}
+
+	TEST(TEST_CLASS, FindReturnsNullptrForUnknownHash) {
+		// Arrange:
+		TransactionDataContainer container;
+		InsertAll(container, test::CreateTransactionInfos(3));
+
+		// Act + Assert:
+		EXPECT_FALSE(!!container.find(test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	// endregion
+
+	// region remove
+
+	TEST(TEST_CLASS, CanRemoveTransactionInfo) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		InsertAll(container, transactionInfos);
+
+		// Act:
+		auto removedInfo = container.remove(transactionInfos[1].EntityHash);
+
+		// Assert: removed data leaves a tombstone
+		ASSERT_TRUE(!!removedInfo);
+		EXPECT_EQ(transactionInfos[1].pEntity, removedInfo.pEntity);
+		EXPECT_EQ(transactionInfos[1].EntityHash, removedInfo.EntityHash);
+
+		EXPECT_EQ(4u, container.size());
+		EXPECT_EQ(5u, container.slotCount());
+		EXPECT_FALSE(!!container.find(transactionInfos[1].EntityHash));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 3, 4, 5 }), ExtractDeadlines(container));
+	}
+
+	TEST(TEST_CLASS, RemovingUnknownTransactionInfoHasNoEffect) {
+		// Arrange:
+		TransactionDataContainer container;
+		InsertAll(container, test::CreateTransactionInfos(5));
+
+		// Act:
+		auto removedInfo = container.remove(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_FALSE(!!removedInfo);
+		EXPECT_EQ(5u, container.size());
+		EXPECT_EQ(5u, container.slotCount());
+	}
+
+	TEST(TEST_CLASS, RemovingLastTransactionInfoReleasesAllSlots) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		InsertAll(container, transactionInfos);
+
+		// Act:
+		RemoveRange(container, transactionInfos, 0, 5);
+
+		// Assert:
+		EXPECT_TRUE(container.empty());
+		EXPECT_EQ(0u, container.slotCount());
+	}
+
+	TEST(TEST_CLASS, CanReinsertRemovedTransactionInfo) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		InsertAll(container, transactionInfos);
+		container.remove(transactionInfos[0].EntityHash);
+
+		// Act:
+		auto result = container.insert(transactionInfos[0], 4);
+
+		// Assert: reinserted info is added at the end
+		EXPECT_TRUE(result);
+		EXPECT_EQ(3u, container.size());
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 3, 1 }), ExtractDeadlines(container));
+	}
+
+	// endregion
+
+	// region compaction
+
+	TEST(TEST_CLASS, ContainerIsNotCompactedWhenTombstonesDoNotOutnumberLiveData) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(200);
+		InsertAll(container, transactionInfos);
+
+		// Act:
+		RemoveRange(container, transactionInfos, 0, 100);
+
+		// Assert:
+		EXPECT_EQ(100u, container.size());
+		EXPECT_EQ(200u, container.slotCount());
+		EXPECT_EQ(CreateDeadlines(101, 200), ExtractDeadlines(container));
+	}
+
+	TEST(TEST_CLASS, ContainerIsNotCompactedWhenThereAreFewTombstones) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(20);
+		InsertAll(container, transactionInfos);
+
+		// Act:
+		RemoveRange(container, transactionInfos, 0, 15);
+
+		// Assert:
+		EXPECT_EQ(5u, container.size());
+		EXPECT_EQ(20u, container.slotCount());
+		EXPECT_EQ(CreateDeadlines(16, 20), ExtractDeadlines(container));
+	}
+
+	TEST(TEST_CLASS, ContainerIsCompactedWhenTombstonesOutnumberLiveData) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(200);
+		InsertAll(container, transactionInfos);
+
+		// Act:
+		RemoveRange(container, transactionInfos, 0, 101);
+
+		// Assert:
+		EXPECT_EQ(99u, container.size());
+		EXPECT_EQ(99u, container.slotCount());
+		EXPECT_EQ(CreateDeadlines(102, 200), ExtractDeadlines(container));
+	}
+
+	TEST(TEST_CLASS, CompactionPreservesHashLookups) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(200);
+		InsertAll(container, transactionInfos);
+
+		// Act:
+		RemoveRange(container, transactionInfos, 0, 101);
+
+		// Assert:
+		for (auto i = 0u; i < transactionInfos.size(); ++i) {
+			const auto* pData = container.find(transactionInfos[i].EntityHash);
+			if (i < 101) {
+				EXPECT_FALSE(!!pData) << "info at " << i;
+			} else {
+				ASSERT_TRUE(!!pData) << "info at " << i;
+				EXPECT_EQ(transactionInfos[i].pEntity, pData->pEntity) << "info at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CompactionPreservesMaxFeeMultiplierOrder) {
+		// Arrange: max fee multipliers alternate between 1 and 2
+		std::vector<std::pair<uint32_t, uint32_t>> sizeMultiplierPairs;
+		for (auto i = 0u; i < 200; ++i)
+			sizeMultiplierPairs.emplace_back(200, 0 == i % 2 ? 10 : 20);
+
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfosFromSizeMultiplierPairs(sizeMultiplierPairs);
+		InsertAll(container, transactionInfos);
+
+		// Act: keep the last four transactions
+		RemoveRange(container, transactionInfos, 0, 196);
+
+		// Sanity: container has been compacted at least once
+		EXPECT_GT(200u, container.slotCount());
+
+		// Assert:
+		auto deadline = [&transactionInfos](auto index) { return transactionInfos[index].pEntity->Deadline.unwrap(); };
+		EXPECT_EQ(
+				std::vector<Timestamp::ValueType>({ deadline(197), deadline(199), deadline(196), deadline(198) }),
+				ExtractDeadlines(container, MaxFeeMultiplierOrder::Descending));
+		EXPECT_EQ(
+				std::vector<Timestamp::ValueType>({ deadline(196), deadline(198), deadline(197), deadline(199) }),
+				ExtractDeadlines(container, MaxFeeMultiplierOrder::Ascending));
+	}
+
+	TEST(TEST_CLASS, CanInsertAfterCompaction) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(200);
+		InsertAll(container, transactionInfos);
+		RemoveRange(container, transactionInfos, 0, 101);
+
+		// Act:
+		auto newTransactionInfo = test::CreateTransactionInfoWithDeadline(1234);
+		auto result = container.insert(newTransactionInfo, 201);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(100u, container.size());
+		EXPECT_EQ(100u, container.slotCount());
+		EXPECT_EQ(99u, container.find(newTransactionInfo.EntityHash) - container.find(transactionInfos[101].EntityHash));
+
+		auto expectedDeadlines = CreateDeadlines(102, 200);
+		expectedDeadlines.push_back(1234);
+		EXPECT_EQ(expectedDeadlines, ExtractDeadlines(container));
+	}
+
+	// endregion
+
+	// region removeAll
+
+	TEST(TEST_CLASS, RemoveAllReturnsAllLiveTransactionInfosInInsertionOrder) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		InsertAll(container, transactionInfos);
+		container.remove(transactionInfos[2].EntityHash);
+
+		// Act:
+		auto removedInfos = container.removeAll();
+
+		// Assert:
+		EXPECT_TRUE(container.empty());
+		EXPECT_EQ(0u, container.slotCount());
+
+		ASSERT_EQ(4u, removedInfos.size());
+		auto i = 0u;
+		for (auto index : { 0u, 1u, 3u, 4u }) {
+			EXPECT_EQ(transactionInfos[index].pEntity, removedInfos[i].pEntity) << "info at " << i;
+			EXPECT_EQ(transactionInfos[index].EntityHash, removedInfos[i].EntityHash) << "info at " << i;
+			++i;
+		}
+
+		for (const auto& transactionInfo : transactionInfos)
+			EXPECT_FALSE(!!container.find(transactionInfo.EntityHash));
+	}
+
+	// endregion
+
+	// region forEach
+
+	TEST(TEST_CLASS, ForEachCanBeShortCircuited) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		InsertAll(container, transactionInfos);
+		container.remove(transactionInfos[1].EntityHash);
+
+		// Act:
+		std::vector<size_t> ids;
+		container.forEach([&ids](const auto& data) {
+			ids.push_back(data.Id);
+			return 3 != ids.size();
+		});
+
+		// Assert: tombstones are skipped
+		EXPECT_EQ(std::vector<size_t>({ 1, 3, 4 }), ids);
+	}
+
+	// endregion
+
+	// region forEachUnknown
+
+	TEST(TEST_CLASS, ForEachUnknownForwardsTransactionDataWithShortHashesNotInFilter) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(6);
+		InsertAll(container, transactionInfos);
+		container.remove(transactionInfos[3].EntityHash);
+
+		utils::ShortHashesSet knownShortHashes{
+			utils::ToShortHash(transactionInfos[1].EntityHash),
+			utils::ToShortHash(transactionInfos[4].EntityHash)
+		};
+
+		// Act:
+		std::vector<size_t> ids;
+		container.forEachUnknown(knownShortHashes, [&ids](const auto& data) {
+			ids.push_back(data.Id);
+			return true;
+		});
+
+		// Assert: known data and tombstones are skipped
+		EXPECT_EQ(std::vector<size_t>({ 1, 3, 6 }), ids);
+	}
+
+	TEST(TEST_CLASS, ForEachUnknownCanBeShortCircuited) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(6);
+		InsertAll(container, transactionInfos);
+
+		// Act:
+		std::vector<size_t> ids;
+		container.forEachUnknown({ utils::ToShortHash(transactionInfos[0].EntityHash) }, [&ids](const auto& data) {
+			ids.push_back(data.Id);
+			return 2 != ids.size();
+		});
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 2, 3 }), ids);
+	}
+
+	TEST(TEST_CLASS, ForEachUnknownRespectsCompaction) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(200);
+		InsertAll(container, transactionInfos);
+		RemoveRange(container, transactionInfos, 0, 101);
+
+		// Act:
+		std::vector<size_t> ids;
+		container.forEachUnknown({ utils::ToShortHash(transactionInfos[150].EntityHash) }, [&ids](const auto& data) {
+			ids.push_back(data.Id);
+			return true;
+		});
+
+		// Assert:
+		std::vector<size_t> expectedIds;
+		for (auto id = 102u; id <= 200; ++id) {
+			if (151 != id)
+				expectedIds.push_back(id);
+		}
+
+		EXPECT_EQ(expectedIds, ids);
+	}
+
+	// endregion
+
+	// region copyShortHashesTo
+
+	namespace {
+		std::vector<utils::ShortHash> CopyShortHashes(const TransactionDataContainer& container) {
+			std::vector<utils::ShortHash> shortHashes(container.size());
+			container.copyShortHashesTo(shortHashes.data());
+			return shortHashes;
+		}
+
+		std::vector<utils::ShortHash> ToShortHashes(
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				std::initializer_list<size_t> indexes) {
+			std::vector<utils::ShortHash> shortHashes;
+			for (auto index : indexes)
+				shortHashes.push_back(utils::ToShortHash(transactionInfos[index].EntityHash));
+
+			return shortHashes;
+		}
+	}
+
+	TEST(TEST_CLASS, CopyShortHashesToCopiesAllShortHashesWhenThereAreNoTombstones) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(4);
+		InsertAll(container, transactionInfos);
+
+		// Act:
+		auto shortHashes = CopyShortHashes(container);
+
+		// Assert:
+		EXPECT_EQ(ToShortHashes(transactionInfos, { 0, 1, 2, 3 }), shortHashes);
+	}
+
+	TEST(TEST_CLASS, CopyShortHashesToSkipsTombstones) {
+		// Arrange:
+		TransactionDataContainer container;
+		auto transactionInfos = test::CreateTransactionInfos(4);
+		InsertAll(container, transactionInfos);
+		container.remove(transactionInfos[0].EntityHash);
+		container.remove(transactionInfos[2].EntityHash);
+
+		// Act:
+		auto shortHashes = CopyShortHashes(container);
+
+		// Assert:
+		EXPECT_EQ(ToShortHashes(transactionInfos, { 1, 3 }), shortHashes);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,278 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/TransactionHashIndex.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TransactionHashIndexTests
+
+	namespace {
+		// hashes with the same hasher bytes always share a home bucket
+		std::vector<Hash256> GenerateCollidingHashes(size_t count) {
+			std::vector<Hash256> hashes;
+			for (auto i = 0u; i < count; ++i) {
+				auto hash = test::GenerateRandomByteArray<Hash256>();
+				std::memset(&hash[4], 0, sizeof(size_t));
+				hashes.push_back(hash);
+			}
+
+			return hashes;
+		}
+
+		void AssertPositions(const TransactionHashIndex& index, const std::vector<Hash256>& hashes, size_t positionOffset = 0) {
+			for (auto i = 0u; i < hashes.size(); ++i)
+				EXPECT_EQ(positionOffset + i, index.find(hashes[i])) << "hash at " << i;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyIndex) {
+		// Act:
+		TransactionHashIndex index;
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_EQ(0u, index.capacity());
+		EXPECT_EQ(TransactionHashIndex::Npos, index.find(test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	// endregion
+
+	// region insert
+
+	TEST(TEST_CLASS, CanInsertHashes) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+
+		// Act:
+		for (auto i = 0u; i < hashes.size(); ++i)
+			EXPECT_TRUE(index.insert(hashes[i], i));
+
+		// Assert:
+		EXPECT_EQ(5u, index.size());
+		EXPECT_EQ(16u, index.capacity());
+		AssertPositions(index, hashes);
+		EXPECT_EQ(TransactionHashIndex::Npos, index.find(test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, CannotInsertSameHashTwice) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		index.insert(hash, 7);
+
+		// Act:
+		auto result = index.insert(hash, 9);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(1u, index.size());
+		EXPECT_EQ(7u, index.find(hash));
+	}
+
+	TEST(TEST_CLASS, InsertGrowsCapacityWhenLoadFactorIsExceeded) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(13);
+
+		// Act:
+		for (auto i = 0u; i < hashes.size(); ++i)
+			index.insert(hashes[i], i);
+
+		// Assert: 13 hashes do not fit into 16 buckets with a load factor of at most 3/4
+		EXPECT_EQ(13u, index.size());
+		EXPECT_EQ(32u, index.capacity());
+		AssertPositions(index, hashes);
+	}
+
+	TEST(TEST_CLASS, CanInsertCollidingHashes) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hashes = GenerateCollidingHashes(10);
+
+		// Act:
+		for (auto i = 0u; i < hashes.size(); ++i)
+			EXPECT_TRUE(index.insert(hashes[i], i));
+
+		// Assert:
+		EXPECT_EQ(10u, index.size());
+		AssertPositions(index, hashes);
+	}
+
+	// endregion
+
+	// region update
+
+	TEST(TEST_CLASS, CanUpdatePositionOfIndexedHash) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+		for (auto i = 0u; i < hashes.size(); ++i)
+			index.insert(hashes[i], i);
+
+		// Act:
+		auto result = index.update(hashes[1], 11);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(3u, index.size());
+		EXPECT_EQ(0u, index.find(hashes[0]));
+		EXPECT_EQ(11u, index.find(hashes[1]));
+		EXPECT_EQ(2u, index.find(hashes[2]));
+	}
+
+	TEST(TEST_CLASS, CannotUpdatePositionOfUnknownHash) {
+		// Arrange:
+		TransactionHashIndex index;
+		index.insert(test::GenerateRandomByteArray<Hash256>(), 0);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto result = index.update(hash, 11);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(1u, index.size());
+		EXPECT_EQ(TransactionHashIndex::Npos, index.find(hash));
+	}
+
+	// endregion
+
+	// region erase
+
+	TEST(TEST_CLASS, CanEraseHashes) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		for (auto i = 0u; i < hashes.size(); ++i)
+			index.insert(hashes[i], i);
+
+		// Act:
+		EXPECT_TRUE(index.erase(hashes[1]));
+		EXPECT_TRUE(index.erase(hashes[3]));
+
+		// Assert:
+		EXPECT_EQ(3u, index.size());
+		EXPECT_EQ(0u, index.find(hashes[0]));
+		EXPECT_EQ(TransactionHashIndex::Npos, index.find(hashes[1]));
+		EXPECT_EQ(2u, index.find(hashes[2]));
+		EXPECT_EQ(TransactionHashIndex::Npos, index.find(hashes[3]));
+		EXPECT_EQ(4u, index.find(hashes[4]));
+	}
+
+	TEST(TEST_CLASS, CannotEraseUnknownHash) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		index.insert(hash, 0);
+
+		// Act:
+		auto result = index.erase(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(1u, index.size());
+		EXPECT_EQ(0u, index.find(hash));
+	}
+
+	TEST(TEST_CLASS, ErasingCollidingHashKeepsRemainingHashesReachable) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hashes = GenerateCollidingHashes(10);
+		for (auto i = 0u; i < hashes.size(); ++i)
+			index.insert(hashes[i], i);
+
+		// Act: erase from the front, middle and back of the probe sequence
+		for (auto i : { 0u, 4u, 9u })
+			EXPECT_TRUE(index.erase(hashes[i]));
+
+		// Assert:
+		EXPECT_EQ(7u, index.size());
+		for (auto i = 0u; i < hashes.size(); ++i) {
+			auto isErased = 0 == i || 4 == i || 9 == i;
+			EXPECT_EQ(isErased ? TransactionHashIndex::Npos : i, index.find(hashes[i])) << "hash at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanReinsertErasedHash) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hashes = GenerateCollidingHashes(3);
+		for (auto i = 0u; i < hashes.size(); ++i)
+			index.insert(hashes[i], i);
+
+		index.erase(hashes[1]);
+
+		// Act:
+		auto result = index.insert(hashes[1], 5);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(3u, index.size());
+		EXPECT_EQ(0u, index.find(hashes[0]));
+		EXPECT_EQ(5u, index.find(hashes[1]));
+		EXPECT_EQ(2u, index.find(hashes[2]));
+	}
+
+	TEST(TEST_CLASS, IndexIsConsistentAfterManyInsertsAndErases) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(1000);
+		for (auto i = 0u; i < hashes.size(); ++i)
+			index.insert(hashes[i], i);
+
+		// Act: erase every third hash
+		for (auto i = 0u; i < hashes.size(); i += 3)
+			index.erase(hashes[i]);
+
+		// Assert:
+		EXPECT_EQ(666u, index.size());
+		for (auto i = 0u; i < hashes.size(); ++i)
+			EXPECT_EQ(0 == i % 3 ? TransactionHashIndex::Npos : i, index.find(hashes[i])) << "hash at " << i;
+	}
+
+	// endregion
+
+	// region clear
+
+	TEST(TEST_CLASS, CanClearIndex) {
+		// Arrange:
+		TransactionHashIndex index;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		for (auto i = 0u; i < hashes.size(); ++i)
+			index.insert(hashes[i], i);
+
+		// Act:
+		index.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_EQ(0u, index.capacity());
+		for (const auto& hash : hashes)
+			EXPECT_EQ(TransactionHashIndex::Npos, index.find(hash));
+	}
+
+	// endregion
+}}
@@ -104,6 +104,7 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.EnableAddressReuse);
 			EXPECT_FALSE(config.EnableSingleThreadPool);
 			EXPECT_TRUE(config.EnableCacheDatabaseStorage);
+			EXPECT_FALSE(config.EnablePackedBlockStorage);
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
@@ -111,6 +112,7 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(42u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(100u, config.MaxCachedBlockElements);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -138,6 +140,8 @@ namespace catapult { namespace config {
 			EXPECT_TRUE(config.EnableDispatcherInputAuditing);
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.MaxCacheDatabaseWriteBatchSize);
+			EXPECT_EQ(100'000u, config.MaxCachedPatriciaTreeNodes);
+			EXPECT_FALSE(config.EnablePatriciaTreeWarmStart);
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
 			EXPECT_EQ("/dev/urandom", config.BatchVerificationRandomSource);
@@ -169,6 +173,17 @@ namespace catapult { namespace config {
 			EXPECT_EQ(4u, config.Banning.NumReadRateMonitoringBuckets);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(15), config.Banning.ReadRateMonitoringBucketDuration);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.Banning.MaxReadRateMonitoringTotalSize);
+
+			EXPECT_FALSE(config.CacheDatabase.EnableStatistics);
+			EXPECT_EQ(4u, config.CacheDatabase.MaxBackgroundJobs);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(256), config.CacheDatabase.BlockCacheSize);
+			EXPECT_EQ(0u, config.CacheDatabase.MaxPendingWriteBatches);
+
+			EXPECT_EQ(utils::FileSize::FromMegabytes(64), config.CacheDatabase.WriteBufferSize);
+			EXPECT_EQ(10u, config.CacheDatabase.BloomFilterBitsPerKey);
+			EXPECT_FALSE(config.CacheDatabase.EnablePartitionedIndexFilters);
+			EXPECT_EQ("", config.CacheDatabase.CompressionPerLevel);
+			EXPECT_TRUE(config.CacheDatabase.Columns.empty());
 		}
 
 		void AssertDefaultLoggingConfiguration(
@@ -41,6 +41,7 @@ namespace catapult { namespace config {
 							{ "enableAddressReuse", "true" },
 							{ "enableSingleThreadPool", "true" },
 							{ "enableCacheDatabaseStorage", "true" },
+							{ "enablePackedBlockStorage", "true" },
 							{ "enableAutoSyncCleanup", "true" },
 
 							{ "enableTransactionSpamThrottling", "true" },
@@ -48,6 +49,7 @@ namespace catapult { namespace config {
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxCachedBlockElements", "75" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -75,6 +77,8 @@ namespace catapult { namespace config {
 							{ "enableDispatcherInputAuditing", "true" },
 
 							{ "maxCacheDatabaseWriteBatchSize", "17KB" },
+							{ "maxCachedPatriciaTreeNodes", "1234" },
+							{ "enablePatriciaTreeWarmStart", "true" },
 							{ "maxTrackedNodes", "222" },
 
 							{ "batchVerificationRandomSource", "/dev/random" },
@@ -123,6 +127,29 @@ namespace catapult { namespace config {
 							{ "readRateMonitoringBucketDuration", "9m" },
 							{ "maxReadRateMonitoringTotalSize", "11KB" }
 						}
+					},
+					{
+						"cache_database",
+						{
+							{ "enableStatistics", "true" },
+							{ "maxBackgroundJobs", "6" },
+							{ "blockCacheSize", "12MB" },
+							{ "maxPendingWriteBatches", "33" },
+
+							{ "writeBufferSize", "3MB" },
+							{ "bloomFilterBitsPerKey", "10" },
+							{ "enablePartitionedIndexFilters", "true" },
+							{ "compressionPerLevel", "none,lz4,zstd" }
+						}
+					},
+					{
+						"cache_database:patricia_tree",
+						{
+							{ "writeBufferSize", "5MB" },
+							{ "bloomFilterBitsPerKey", "14" },
+							{ "enablePartitionedIndexFilters", "false" },
+							{ "compressionPerLevel", "snappy" }
+						}
 					}
 				};
 			}
@@ -139,6 +166,7 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableAddressReuse);
 				EXPECT_FALSE(config.EnableSingleThreadPool);
 				EXPECT_FALSE(config.EnableCacheDatabaseStorage);
+				EXPECT_FALSE(config.EnablePackedBlockStorage);
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
@@ -146,6 +174,7 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxCachedBlockElements);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -173,6 +202,8 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableDispatcherInputAuditing);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(0u, config.MaxCachedPatriciaTreeNodes);
+				EXPECT_FALSE(config.EnablePatriciaTreeWarmStart);
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
 				EXPECT_EQ("", config.BatchVerificationRandomSource);
@@ -204,6 +235,18 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.Banning.NumReadRateMonitoringBuckets);
 				EXPECT_EQ(utils::TimeSpan(), config.Banning.ReadRateMonitoringBucketDuration);
 				EXPECT_EQ(utils::FileSize(), config.Banning.MaxReadRateMonitoringTotalSize);
+
+				EXPECT_FALSE(config.CacheDatabase.EnableStatistics);
+				EXPECT_EQ(0u, config.CacheDatabase.MaxBackgroundJobs);
+				EXPECT_EQ(utils::FileSize(), config.CacheDatabase.BlockCacheSize);
+				EXPECT_EQ(0u, config.CacheDatabase.MaxPendingWriteBatches);
+
+				EXPECT_EQ(utils::FileSize(), config.CacheDatabase.WriteBufferSize);
+				EXPECT_EQ(0u, config.CacheDatabase.BloomFilterBitsPerKey);
+				EXPECT_FALSE(config.CacheDatabase.EnablePartitionedIndexFilters);
+				EXPECT_EQ("", config.CacheDatabase.CompressionPerLevel);
+
+				EXPECT_TRUE(config.CacheDatabase.Columns.empty());
 			}
 
 			static void AssertCustom(const NodeConfiguration& config) {
@@ -214,6 +257,7 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableAddressReuse);
 				EXPECT_TRUE(config.EnableSingleThreadPool);
 				EXPECT_TRUE(config.EnableCacheDatabaseStorage);
+				EXPECT_TRUE(config.EnablePackedBlockStorage);
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
@@ -221,6 +265,7 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(75u, config.MaxCachedBlockElements);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -248,6 +293,8 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableDispatcherInputAuditing);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(1234u, config.MaxCachedPatriciaTreeNodes);
+				EXPECT_TRUE(config.EnablePatriciaTreeWarmStart);
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
 				EXPECT_EQ("/dev/random", config.BatchVerificationRandomSource);
@@ -279,12 +326,69 @@ namespace catapult { namespace config {
 				EXPECT_EQ(7u, config.Banning.NumReadRateMonitoringBuckets);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(9), config.Banning.ReadRateMonitoringBucketDuration);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(11), config.Banning.MaxReadRateMonitoringTotalSize);
+
+				EXPECT_TRUE(config.CacheDatabase.EnableStatistics);
+				EXPECT_EQ(6u, config.CacheDatabase.MaxBackgroundJobs);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(12), config.CacheDatabase.BlockCacheSize);
+				EXPECT_EQ(33u, config.CacheDatabase.MaxPendingWriteBatches);
+
+				EXPECT_EQ(utils::FileSize::FromMegabytes(3), config.CacheDatabase.WriteBufferSize);
+				EXPECT_EQ(10u, config.CacheDatabase.BloomFilterBitsPerKey);
+				EXPECT_TRUE(config.CacheDatabase.EnablePartitionedIndexFilters);
+				EXPECT_EQ("none,lz4,zstd", config.CacheDatabase.CompressionPerLevel);
+
+				ASSERT_EQ(1u, config.CacheDatabase.Columns.size());
+				const auto& columnConfig = config.CacheDatabase.Columns.find("patricia_tree")->second;
+				EXPECT_EQ(utils::FileSize::FromMegabytes(5), columnConfig.WriteBufferSize);
+				EXPECT_EQ(14u, columnConfig.BloomFilterBitsPerKey);
+				EXPECT_FALSE(columnConfig.EnablePartitionedIndexFilters);
+				EXPECT_EQ("snappy", columnConfig.CompressionPerLevel);
 			}
 		};
 	}
 
 	DEFINE_CONFIGURATION_TESTS(NodeConfigurationTests, Node)
 
+	// region cache database columns
+
+	TEST(TEST_CLASS, CanLoadConfigurationWithoutCustomCacheDatabaseColumns) {
+		// Arrange:
+		auto properties = NodeConfigurationTraits::CreateProperties();
+		properties.erase("cache_database:patricia_tree");
+
+		// Act:
+		auto config = NodeConfiguration::LoadFromBag(utils::ConfigurationBag(std::move(properties)));
+
+		// Assert:
+		EXPECT_TRUE(config.CacheDatabase.Columns.empty());
+	}
+
+	TEST(TEST_CLASS, CanLoadConfigurationWithMultipleCustomCacheDatabaseColumns) {
+		// Arrange:
+		auto properties = NodeConfigurationTraits::CreateProperties();
+		properties.insert({ "cache_database:default", {
+			{ "writeBufferSize", "7MB" },
+			{ "bloomFilterBitsPerKey", "0" },
+			{ "enablePartitionedIndexFilters", "true" },
+			{ "compressionPerLevel", "" }
+		} });
+
+		// Act:
+		auto config = NodeConfiguration::LoadFromBag(utils::ConfigurationBag(std::move(properties)));
+
+		// Assert:
+		ASSERT_EQ(2u, config.CacheDatabase.Columns.size());
+		EXPECT_EQ(14u, config.CacheDatabase.Columns.find("patricia_tree")->second.BloomFilterBitsPerKey);
+
+		const auto& columnConfig = config.CacheDatabase.Columns.find("default")->second;
+		EXPECT_EQ(utils::FileSize::FromMegabytes(7), columnConfig.WriteBufferSize);
+		EXPECT_EQ(0u, columnConfig.BloomFilterBitsPerKey);
+		EXPECT_TRUE(columnConfig.EnablePartitionedIndexFilters);
+		EXPECT_EQ("", columnConfig.CompressionPerLevel);
+	}
+
+	// endregion
+
 	// region utils
 
 	namespace {
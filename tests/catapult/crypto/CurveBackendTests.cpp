@@ -0,0 +1,176 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/CurveBackend.h"
+#include "catapult/crypto/CryptoUtils.h"
+#include "catapult/crypto/KeyPair.h"
+#include "catapult/utils/HexParser.h"
+#include "tests/TestHarness.h"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"
+#pragma clang diagnostic ignored "-Wcast-align"
+#pragma clang diagnostic ignored "-Wcast-qual"
+#pragma clang diagnostic ignored "-Wimplicit-fallthrough"
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#pragma clang diagnostic ignored "-Wunused-function"
+#pragma clang diagnostic ignored "-Wreserved-id-macro"
+#pragma clang diagnostic ignored "-Wdocumentation"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+#elif defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4324) /* ed25519 structs use __declspec(align()) */
+#pragma warning(disable : 4388) /* signed/unsigned mismatch */
+#pragma warning(disable : 4505) /* unreferenced local function has been removed */
+#endif
+
+extern "C" {
+#include <donna/ed25519-donna.h>
+}
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS CurveBackendTests
+
+	// region IsCurveBackendSupported / GetDefaultCurveBackend
+
+	TEST(TEST_CLASS, ScalarBackendIsAlwaysSupported) {
+		EXPECT_TRUE(IsCurveBackendSupported(CurveBackend::Scalar));
+	}
+
+	TEST(TEST_CLASS, DefaultBackendIsSupported) {
+		EXPECT_TRUE(IsCurveBackendSupported(GetDefaultCurveBackend()));
+	}
+
+	TEST(TEST_CLASS, DefaultBackendIsAvx512WhenSupportedAndScalarOtherwise) {
+		// Act:
+		auto backend = GetDefaultCurveBackend();
+
+		// Assert:
+		auto expectedBackend = IsCurveBackendSupported(CurveBackend::Avx512) ? CurveBackend::Avx512 : CurveBackend::Scalar;
+		EXPECT_EQ(expectedBackend, backend);
+	}
+
+	// endregion
+
+	// region CheckMainSubgroup
+
+	namespace {
+		// y = 0 is an element of order four
+		constexpr auto Small_Order_Element = "0000000000000000000000000000000000000000000000000000000000000000";
+
+		ge25519 UnpackValid(const Key& publicKey) {
+			ge25519 A;
+			EXPECT_TRUE(UnpackNegative(A, publicKey));
+			return A;
+		}
+
+		std::vector<ge25519> CreatePoints(size_t count) {
+			auto smallOrderElement = UnpackValid(utils::ParseByteArray<Key>(Small_Order_Element));
+
+			// every third point is not in the main subgroup
+			std::vector<ge25519> points(count);
+			for (auto i = 0u; i < count; ++i) {
+				auto keyPair = KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte));
+				points[i] = UnpackValid(keyPair.publicKey());
+				if (1 == i % 3)
+					ge25519_add(&points[i], &points[i], &smallOrderElement);
+			}
+
+			return points;
+		}
+
+		void AssertSameResultsAsIsInMainSubgroup(CurveBackend backend, size_t count) {
+			// Arrange:
+			auto points = CreatePoints(count);
+			std::unique_ptr<bool[]> pResults(new bool[count + 1]);
+
+			// Act:
+			CheckMainSubgroup(backend, points.data(), count, pResults.get());
+
+			// Assert:
+			for (auto i = 0u; i < count; ++i) {
+				EXPECT_EQ(IsInMainSubgroup(points[i]), pResults[i]) << "count " << count << ", at " << i;
+				EXPECT_EQ(1 != i % 3, pResults[i]) << "count " << count << ", at " << i;
+			}
+		}
+
+		void AssertSameResultsAsIsInMainSubgroup(CurveBackend backend) {
+			for (auto count : { 0u, 1u, 3u, 4u, 5u, 8u, 9u, 17u, 128u })
+				AssertSameResultsAsIsInMainSubgroup(backend, count);
+		}
+
+		void AssertNeutralElementIsInMainSubgroup(CurveBackend backend) {
+			// Arrange:
+			auto neutralElement = UnpackValid(utils::ParseByteArray<Key>(
+					"0100000000000000000000000000000000000000000000000000000000000000"));
+
+			// Act:
+			bool result = false;
+			CheckMainSubgroup(backend, &neutralElement, 1, &result);
+
+			// Assert:
+			EXPECT_TRUE(result);
+		}
+	}
+
+#define CURVE_BACKEND_TEST(TEST_NAME) \
+	void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(CurveBackend backend); \
+	TEST(TEST_CLASS, TEST_NAME##_Scalar) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(CurveBackend::Scalar); } \
+	TEST(TEST_CLASS, TEST_NAME##_Avx2) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(CurveBackend::Avx2); } \
+	TEST(TEST_CLASS, TEST_NAME##_Avx512) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(CurveBackend::Avx512); } \
+	void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(CurveBackend backend)
+
+	// unsupported backends fall back to the scalar backend, so these tests are valid on all cpus
+
+	CURVE_BACKEND_TEST(CheckMainSubgroupReturnsSameResultsAsIsInMainSubgroup) {
+		AssertSameResultsAsIsInMainSubgroup(backend);
+	}
+
+	CURVE_BACKEND_TEST(CheckMainSubgroupAcceptsNeutralElement) {
+		AssertNeutralElementIsInMainSubgroup(backend);
+	}
+
+	CURVE_BACKEND_TEST(CheckMainSubgroupRejectsSmallOrderElement) {
+		// Arrange:
+		auto smallOrderElement = UnpackValid(utils::ParseByteArray<Key>(Small_Order_Element));
+
+		// Act:
+		bool result = true;
+		CheckMainSubgroup(backend, &smallOrderElement, 1, &result);
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+	// endregion
+}}
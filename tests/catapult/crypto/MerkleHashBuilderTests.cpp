@@ -287,6 +287,256 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region final - incremental
+
+	TEST(TEST_CLASS, SizeReturnsNumberOfAddedHashes) {
+		// Arrange:
+		MerkleHashBuilder builder;
+
+		// Act:
+		for (const auto& hash : GenerateRandomHashes(5))
+			builder.update(hash);
+
+		// Assert:
+		EXPECT_EQ(5u, builder.size());
+	}
+
+	TRAITS_BASED_TEST(FinalizationDoesNotChangeBuilder) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(5);
+		MerkleHashBuilder builder;
+		for (const auto& hash : seedHashes)
+			builder.update(hash);
+
+		typename TTraits::ResultType result1;
+		builder.final(result1);
+
+		// Act:
+		typename TTraits::ResultType result2;
+		builder.final(result2);
+
+		// Assert:
+		EXPECT_EQ(5u, builder.size());
+		EXPECT_EQ(TTraits::PrepareExpected(seedHashes), result1);
+		EXPECT_EQ(result1, result2);
+	}
+
+	TRAITS_BASED_TEST(CanUpdateAfterFinalization) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(37);
+		MerkleHashBuilder builder;
+
+		for (auto i = 0u; i < seedHashes.size(); ++i) {
+			// Act: finalize after every update so that all cached interior nodes are exercised
+			builder.update(seedHashes[i]);
+
+			typename TTraits::ResultType result;
+			builder.final(result);
+
+			// Assert:
+			auto expectedResult = CalculateMerkleResult<TTraits>(Hashes(seedHashes.cbegin(), seedHashes.cbegin() + i + 1));
+			EXPECT_EQ(expectedResult, result) << "after update " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, TruncateToLargerSizeHasNoEffect) {
+		// Arrange:
+		MerkleHashBuilder builder;
+		for (const auto& hash : GenerateRandomHashes(5))
+			builder.update(hash);
+
+		// Act:
+		builder.truncate(5);
+		builder.truncate(7);
+
+		// Assert:
+		EXPECT_EQ(5u, builder.size());
+	}
+
+	TRAITS_BASED_TEST(CanTruncateAfterFinalization) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(37);
+
+		for (auto size : { 36u, 33u, 32u, 17u, 2u, 1u, 0u }) {
+			MerkleHashBuilder builder;
+			for (const auto& hash : seedHashes)
+				builder.update(hash);
+
+			typename TTraits::ResultType seedResult;
+			builder.final(seedResult);
+
+			// Act:
+			builder.truncate(size);
+
+			typename TTraits::ResultType result;
+			builder.final(result);
+
+			// Assert:
+			auto expectedResult = CalculateMerkleResult<TTraits>(Hashes(seedHashes.cbegin(), seedHashes.cbegin() + size));
+			EXPECT_EQ(size, builder.size());
+			EXPECT_EQ(expectedResult, result) << "after truncate " << size;
+		}
+	}
+
+	TRAITS_BASED_TEST(CanUpdateAfterTruncation) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(37);
+		auto newHashes = GenerateRandomHashes(10);
+		MerkleHashBuilder builder;
+		for (const auto& hash : seedHashes)
+			builder.update(hash);
+
+		typename TTraits::ResultType seedResult;
+		builder.final(seedResult);
+
+		// Act:
+		builder.truncate(20);
+		for (const auto& hash : newHashes)
+			builder.update(hash);
+
+		typename TTraits::ResultType result;
+		builder.final(result);
+
+		// Assert:
+		auto expectedHashes = Hashes(seedHashes.cbegin(), seedHashes.cbegin() + 20);
+		expectedHashes.insert(expectedHashes.end(), newHashes.cbegin(), newHashes.cend());
+		EXPECT_EQ(30u, builder.size());
+		EXPECT_EQ(CalculateMerkleResult<TTraits>(expectedHashes), result);
+	}
+
+	TRAITS_BASED_TEST(CanFinalizeAfterRebuild) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(37);
+		MerkleHashBuilder builder;
+
+		// Act: rebuild after every update so that all cached interior nodes are exercised
+		for (const auto& hash : seedHashes) {
+			builder.update(hash);
+			builder.rebuild();
+		}
+
+		typename TTraits::ResultType result;
+		builder.final(result);
+
+		// Assert:
+		EXPECT_EQ(37u, builder.size());
+		EXPECT_EQ(CalculateMerkleResult<TTraits>(seedHashes), result);
+	}
+
+	// endregion
+
+	// region final - partition runner
+
+	namespace {
+		constexpr auto Num_Partitioned_Leaves = 2 * MerkleHashBuilder::Min_Partitioned_Level_Size + 5;
+
+		struct PartitionRunnerCall {
+			size_t Count;
+			std::vector<std::pair<size_t, size_t>> Partitions;
+		};
+
+		utils::PartitionRunner CreatePartitionRunner(std::vector<PartitionRunnerCall>& calls) {
+			return [&calls](auto count, const auto& callback) {
+				// split work into three partitions and process them in reverse order
+				auto partitionSize = (count + 2) / 3;
+				std::vector<std::pair<size_t, size_t>> partitions;
+				for (auto i = 0u; i < count; i += partitionSize)
+					partitions.emplace_back(i, std::min<size_t>(partitionSize, count - i));
+
+				for (auto iter = partitions.crbegin(); partitions.crend() != iter; ++iter)
+					callback(iter->first, iter->second);
+
+				calls.push_back({ count, partitions });
+			};
+		}
+
+		template<typename TTraits>
+		auto CalculatePartitionedMerkleResult(const Hashes& hashes, std::vector<PartitionRunnerCall>& calls) {
+			MerkleHashBuilder builder(hashes.size(), CreatePartitionRunner(calls));
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			typename TTraits::ResultType result;
+			builder.final(result);
+			return result;
+		}
+	}
+
+	TRAITS_BASED_TEST(PartitionRunnerIsNotUsedForSmallLevels) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(2 * MerkleHashBuilder::Min_Partitioned_Level_Size - 2);
+		std::vector<PartitionRunnerCall> calls;
+
+		// Act:
+		auto result = CalculatePartitionedMerkleResult<TTraits>(seedHashes, calls);
+
+		// Assert:
+		EXPECT_EQ(CalculateMerkleResult<TTraits>(seedHashes), result);
+		EXPECT_TRUE(calls.empty());
+	}
+
+	TRAITS_BASED_TEST(PartitionRunnerIsUsedForLargeLevels) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(Num_Partitioned_Leaves);
+		std::vector<PartitionRunnerCall> calls;
+
+		// Act:
+		auto result = CalculatePartitionedMerkleResult<TTraits>(seedHashes, calls);
+
+		// Assert: only the first interior level (1027 nodes) is large enough to be partitioned
+		EXPECT_EQ(CalculateMerkleResult<TTraits>(seedHashes), result);
+		ASSERT_EQ(1u, calls.size());
+		EXPECT_EQ(1027u, calls[0].Count);
+
+		std::vector<std::pair<size_t, size_t>> expectedPartitions{ { 0, 343 }, { 343, 343 }, { 686, 341 } };
+		EXPECT_EQ(expectedPartitions, calls[0].Partitions);
+	}
+
+	TEST(TEST_CLASS, PartitionRunnerIsOnlyUsedForNodesThatNeedToBeRehashed) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(Num_Partitioned_Leaves + 7);
+		std::vector<PartitionRunnerCall> calls;
+		MerkleHashBuilder builder(seedHashes.size(), CreatePartitionRunner(calls));
+		for (auto i = 0u; i < Num_Partitioned_Leaves; ++i)
+			builder.update(seedHashes[i]);
+
+		Hash256 result;
+		builder.final(result);
+
+		// Act:
+		for (auto i = Num_Partitioned_Leaves; i < seedHashes.size(); ++i)
+			builder.update(seedHashes[i]);
+
+		builder.final(result);
+
+		// Assert: only the initial finalization was large enough to be partitioned
+		EXPECT_EQ(CalculateMerkleResult<MerkleHashTraits>(seedHashes), result);
+		ASSERT_EQ(1u, calls.size());
+		EXPECT_EQ(1027u, calls[0].Count);
+	}
+
+	TEST(TEST_CLASS, FinalizationAfterRebuildDoesNotRehashNodes) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(Num_Partitioned_Leaves);
+		std::vector<PartitionRunnerCall> calls;
+		MerkleHashBuilder builder(seedHashes.size(), CreatePartitionRunner(calls));
+		for (const auto& hash : seedHashes)
+			builder.update(hash);
+
+		builder.rebuild();
+
+		// Act:
+		Hash256 result;
+		builder.final(result);
+
+		// Assert: large level was only hashed by the rebuild
+		EXPECT_EQ(CalculateMerkleResult<MerkleHashTraits>(seedHashes), result);
+		ASSERT_EQ(1u, calls.size());
+		EXPECT_EQ(1027u, calls[0].Count);
+	}
+
+	// endregion
+
 	// region treeSize
 
 	TEST(TEST_CLASS, TreeSizeReturnsExpectedValue) {
@@ -0,0 +1,212 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/MultiBufferHashes.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/utils/HexParser.h"
+#include "tests/TestHarness.h"
+#include <algorithm>
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS MultiBufferHashesTests
+
+	// region IsMultiBufferHashBackendSupported / GetDefaultMultiBufferHashBackend
+
+	TEST(TEST_CLASS, ScalarBackendIsAlwaysSupported) {
+		EXPECT_TRUE(IsMultiBufferHashBackendSupported(MultiBufferHashBackend::Scalar));
+	}
+
+	TEST(TEST_CLASS, DefaultBackendIsSupported) {
+		EXPECT_TRUE(IsMultiBufferHashBackendSupported(GetDefaultMultiBufferHashBackend()));
+	}
+
+	TEST(TEST_CLASS, DefaultBackendIsWidestSupportedBackend) {
+		// Act:
+		auto backend = GetDefaultMultiBufferHashBackend();
+
+		// Assert:
+		auto expectedBackend = IsMultiBufferHashBackendSupported(MultiBufferHashBackend::Avx512)
+				? MultiBufferHashBackend::Avx512
+				: IsMultiBufferHashBackendSupported(MultiBufferHashBackend::Avx2)
+						? MultiBufferHashBackend::Avx2
+						: MultiBufferHashBackend::Scalar;
+		EXPECT_EQ(expectedBackend, backend);
+	}
+
+	// endregion
+
+	namespace {
+		// sizes around the sha3 256 rate (136 bytes)
+		constexpr size_t Data_Sizes[] = { 0, 1, 32, 64, 135, 136, 137, 271, 272, 273, 1000 };
+		constexpr auto Num_Data_Sizes = sizeof(Data_Sizes) / sizeof(size_t);
+
+		std::vector<std::vector<uint8_t>> GenerateRandomBuffers(size_t count) {
+			// use different sizes so that lanes complete at different times
+			std::vector<std::vector<uint8_t>> buffers;
+			for (auto i = 0u; i < count; ++i)
+				buffers.push_back(test::GenerateRandomVector(Data_Sizes[(i * 7) % Num_Data_Sizes]));
+
+			return buffers;
+		}
+
+		Hash256 CalculateSha3_256(std::initializer_list<const RawBuffer> buffers) {
+			Sha3_256_Builder builder;
+			builder.update(buffers);
+
+			Hash256 hash;
+			builder.final(hash);
+			return hash;
+		}
+
+		void AssertSameHashesAsSha3_256(MultiBufferHashBackend backend, size_t count) {
+			// Arrange:
+			auto buffers = GenerateRandomBuffers(count);
+			std::vector<RawBuffer> rawBuffers(buffers.cbegin(), buffers.cend());
+			std::vector<Hash256> hashes(count);
+
+			// Act:
+			Sha3_256_Multi(backend, rawBuffers.data(), count, hashes.data());
+
+			// Assert:
+			for (auto i = 0u; i < count; ++i) {
+				Hash256 expectedHash;
+				Sha3_256(buffers[i], expectedHash);
+				EXPECT_EQ(expectedHash, hashes[i]) << "count " << count << ", at " << i << " (size " << buffers[i].size() << ")";
+			}
+		}
+	}
+
+#define MULTI_BUFFER_HASH_BACKEND_TEST(TEST_NAME) \
+	void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(MultiBufferHashBackend backend); \
+	TEST(TEST_CLASS, TEST_NAME##_Scalar) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(MultiBufferHashBackend::Scalar); } \
+	TEST(TEST_CLASS, TEST_NAME##_Avx2) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(MultiBufferHashBackend::Avx2); } \
+	TEST(TEST_CLASS, TEST_NAME##_Avx512) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(MultiBufferHashBackend::Avx512); } \
+	void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(MultiBufferHashBackend backend)
+
+	// unsupported backends fall back to the scalar backend, so these tests are valid on all cpus
+
+	// region Sha3_256_Multi
+
+	MULTI_BUFFER_HASH_BACKEND_TEST(EmptyStringHasExpectedHash) {
+		// Arrange:
+		RawBuffer buffer;
+		Hash256 hash;
+
+		// Act:
+		Sha3_256_Multi(backend, &buffer, 1, &hash);
+
+		// Assert:
+		EXPECT_EQ(utils::ParseByteArray<Hash256>("A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A"), hash);
+	}
+
+	MULTI_BUFFER_HASH_BACKEND_TEST(MultiReturnsSameHashesAsSha3_256) {
+		for (auto count : { 0u, 1u, 3u, 4u, 5u, 8u, 9u, 17u, 100u })
+			AssertSameHashesAsSha3_256(backend, count);
+	}
+
+	TEST(TEST_CLASS, MultiWithDefaultBackendReturnsSameHashesAsSha3_256) {
+		// Arrange:
+		auto buffers = GenerateRandomBuffers(25);
+		std::vector<RawBuffer> rawBuffers(buffers.cbegin(), buffers.cend());
+		std::vector<Hash256> hashes(buffers.size());
+
+		// Act:
+		Sha3_256_Multi(rawBuffers.data(), rawBuffers.size(), hashes.data());
+
+		// Assert:
+		for (auto i = 0u; i < buffers.size(); ++i) {
+			Hash256 expectedHash;
+			Sha3_256(buffers[i], expectedHash);
+			EXPECT_EQ(expectedHash, hashes[i]) << "at " << i;
+		}
+	}
+
+	// endregion
+
+	// region Sha3_256_MultiBuilder
+
+	TEST(TEST_CLASS, BuilderIsInitiallyEmpty) {
+		// Act:
+		Sha3_256_MultiBuilder builder;
+
+		// Assert:
+		EXPECT_EQ(0u, builder.size());
+	}
+
+	TEST(TEST_CLASS, CannotAppendBufferToEmptyBuilder) {
+		// Arrange:
+		Sha3_256_MultiBuilder builder;
+		auto buffer = test::GenerateRandomVector(10);
+
+		// Act + Assert:
+		EXPECT_THROW(builder.append(buffer), catapult_runtime_error);
+	}
+
+	MULTI_BUFFER_HASH_BACKEND_TEST(BuilderCalculatesHashesOfConcatenatedBuffers) {
+		// Arrange: split every buffer into multiple parts with different boundaries
+		auto buffers = GenerateRandomBuffers(21);
+		std::vector<Hash256> hashes(buffers.size());
+		Sha3_256_MultiBuilder builder(backend, buffers.size());
+		for (auto i = 0u; i < buffers.size(); ++i) {
+			const auto& buffer = buffers[i];
+			auto split1 = buffer.size() / 3;
+			auto split2 = buffer.size() - std::min<size_t>(buffer.size(), i % 2);
+			builder.add({ { buffer.data(), split1 }, { buffer.data() + split1, split2 - split1 } }, hashes[i]);
+			builder.append({ buffer.data() + split2, buffer.size() - split2 });
+		}
+
+		// Sanity:
+		EXPECT_EQ(buffers.size(), builder.size());
+
+		// Act:
+		builder.final();
+
+		// Assert:
+		EXPECT_EQ(0u, builder.size());
+		for (auto i = 0u; i < buffers.size(); ++i) {
+			Hash256 expectedHash;
+			Sha3_256(buffers[i], expectedHash);
+			EXPECT_EQ(expectedHash, hashes[i]) << "at " << i;
+		}
+	}
+
+	MULTI_BUFFER_HASH_BACKEND_TEST(BuilderCanBeReusedAfterFinal) {
+		// Arrange:
+		auto buffer1 = test::GenerateRandomVector(100);
+		auto buffer2 = test::GenerateRandomVector(200);
+		Sha3_256_MultiBuilder builder(backend, 0);
+
+		Hash256 hash1;
+		builder.add({ buffer1, buffer2 }, hash1);
+		builder.final();
+
+		// Act:
+		Hash256 hash2;
+		builder.add({ buffer2, buffer1 }, hash2);
+		builder.final();
+
+		// Assert:
+		EXPECT_EQ(CalculateSha3_256({ buffer1, buffer2 }), hash1);
+		EXPECT_EQ(CalculateSha3_256({ buffer2, buffer1 }), hash2);
+	}
+
+	// endregion
+}}
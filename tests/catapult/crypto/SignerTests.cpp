@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/crypto/Signer.h"
+#include "catapult/utils/Casting.h"
 #include "catapult/utils/HexParser.h"
 #include "catapult/utils/RandomGenerator.h"
 #include "tests/test/crypto/CurveUtils.h"
@@ -29,6 +30,77 @@ namespace catapult { namespace crypto {
 
 #define TEST_CLASS SignerTests
 
+	// region SignatureInputBuffers
+
+	namespace {
+		void AssertBuffers(const std::vector<RawBuffer>& expectedBuffers, const SignatureInputBuffers& buffers) {
+			ASSERT_EQ(expectedBuffers.size(), buffers.size());
+			EXPECT_EQ(expectedBuffers.size(), static_cast<size_t>(std::distance(buffers.begin(), buffers.end())));
+
+			auto i = 0u;
+			for (const auto& buffer : buffers) {
+				EXPECT_EQ(expectedBuffers[i].pData, buffer.pData) << "buffer at " << i;
+				EXPECT_EQ(expectedBuffers[i].Size, buffer.Size) << "buffer at " << i;
+				EXPECT_EQ(expectedBuffers[i].pData, buffers[i].pData) << "buffer at " << i;
+				++i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptySignatureInputBuffers) {
+		// Act:
+		SignatureInputBuffers buffers;
+
+		// Assert:
+		AssertBuffers({}, buffers);
+	}
+
+	TEST(TEST_CLASS, CanCreateSignatureInputBuffersAroundInitializerList) {
+		// Arrange:
+		auto data1 = test::GenerateRandomVector(50);
+		auto data2 = test::GenerateRandomVector(70);
+
+		// Act:
+		SignatureInputBuffers buffers{ data1, data2 };
+
+		// Assert:
+		AssertBuffers({ data1, data2 }, buffers);
+	}
+
+	TEST(TEST_CLASS, CannotCreateSignatureInputBuffersAroundTooManyBuffers) {
+		// Arrange:
+		auto data = test::GenerateRandomVector(50);
+
+		// Act + Assert:
+		EXPECT_THROW(SignatureInputBuffers({ data, data, data }), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanAppendBuffersToSignatureInputBuffers) {
+		// Arrange:
+		auto data1 = test::GenerateRandomVector(50);
+		auto data2 = test::GenerateRandomVector(70);
+		SignatureInputBuffers buffers;
+
+		// Act:
+		buffers.push_back(data1);
+		buffers.push_back(data2);
+
+		// Assert:
+		AssertBuffers({ data1, data2 }, buffers);
+	}
+
+	TEST(TEST_CLASS, CannotAppendBufferToFullSignatureInputBuffers) {
+		// Arrange:
+		auto data = test::GenerateRandomVector(50);
+		SignatureInputBuffers buffers{ data, data };
+
+		// Act + Assert:
+		EXPECT_THROW(buffers.push_back(data), catapult_out_of_range);
+		AssertBuffers({ data, data }, buffers);
+	}
+
+	// endregion
+
 	// region Sign
 
 	namespace {
@@ -290,11 +362,10 @@ namespace catapult { namespace crypto {
 		}
 
 		template<typename TTraits, typename TMutator>
-		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(size_t count, std::unordered_set<size_t> failedIndexes, TMutator mutator) {
 			// Arrange:
 			DataHolder dataHolder;
-			auto signatureInputs = CreateSignatureInputs(Default_Signature_Count, dataHolder);
-			std::unordered_set<size_t> failedIndexes{ 1, 17, 58 };
+			auto signatureInputs = CreateSignatureInputs(count, dataHolder);
 			for (auto index : failedIndexes)
 				mutator(signatureInputs, index);
 
@@ -305,6 +376,11 @@ namespace catapult { namespace crypto {
 			TTraits::AssertVerifyResult(result, false, failedIndexes);
 		}
 
+		template<typename TTraits, typename TMutator>
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+			AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 1, 17, 58 }, mutator);
+		}
+
 		RandomFiller CreateRandomFiller() {
 			return [](auto* pOut, auto count) {
 				// can use low entropy source for tests
@@ -369,6 +445,36 @@ namespace catapult { namespace crypto {
 		AssertSignedPayloadsCanBeVerifiedAsBatches<TTraits>(100); // 2 batches
 	}
 
+	VERIFY_MULTI_TEST(SignedPayloadsCanBeVerifiedAsBatches_LargeBatches) {
+		AssertSignedPayloadsCanBeVerifiedAsBatches<TTraits>(128); // single bucket batch
+		AssertSignedPayloadsCanBeVerifiedAsBatches<TTraits>(300); // single bucket batch
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_LastSignatureNotBatchVerified) {
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(65, { 64 }, [](auto& signatureInputs, auto index) {
+			const_cast<Signature&>(signatureInputs[index].Signature)[5] ^= 0xFF;
+		});
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_LargeBatches) {
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(300, { 1, 150, 299 }, [](auto& signatureInputs, auto index) {
+			const_cast<Signature&>(signatureInputs[index].Signature)[5] ^= 0xFF;
+		});
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_MultipleLargeBatches) {
+		// Arrange: more than max bucket batch size (4096) with invalid signatures in first and last bucket batches
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(4096 + 300, { 10, 4096 + 150 }, [](auto& signatureInputs, auto index) {
+			const_cast<Signature&>(signatureInputs[index].Signature)[5] ^= 0xFF;
+		});
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_LargeBatches_DifferentSPart) {
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(200, { 0, 199 }, [](auto& signatureInputs, auto index) {
+			const_cast<Signature&>(signatureInputs[index].Signature)[47] ^= 0xFF;
+		});
+	}
+
 	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_DifferentKey) {
 		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>([](auto& signatureInputs, auto index) {
 			const_cast<Key&>(signatureInputs[index].PublicKey) = Valid_Public_Key;
@@ -420,6 +526,51 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region VerifyMulti - curve backends
+
+	namespace {
+		void AssertVerifyMultiResultsAreBackendIndependent(const std::vector<SignatureInput>& signatureInputs) {
+			// Arrange:
+			auto expectedResult = VerifyMulti(CurveBackend::Scalar, CreateRandomFiller(), signatureInputs.data(), signatureInputs.size());
+
+			for (auto backend : { CurveBackend::Avx2, CurveBackend::Avx512 }) {
+				// Act:
+				auto result = VerifyMulti(backend, CreateRandomFiller(), signatureInputs.data(), signatureInputs.size());
+				auto shortCircuitResult = VerifyMultiShortCircuit(
+						backend,
+						CreateRandomFiller(),
+						signatureInputs.data(),
+						signatureInputs.size());
+
+				// Assert:
+				EXPECT_EQ(expectedResult, result) << "backend " << utils::to_underlying_type(backend);
+				EXPECT_EQ(expectedResult.second, shortCircuitResult) << "backend " << utils::to_underlying_type(backend);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiResultsAreBackendIndependent_AllValid) {
+		// Arrange:
+		DataHolder dataHolder;
+		auto signatureInputs = CreateSignatureInputs(Default_Signature_Count + 30, dataHolder);
+
+		// Act + Assert:
+		AssertVerifyMultiResultsAreBackendIndependent(signatureInputs);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiResultsAreBackendIndependent_SomeInvalid) {
+		// Arrange: corrupt some public keys in different batches
+		DataHolder dataHolder;
+		auto signatureInputs = CreateSignatureInputs(Default_Signature_Count + 30, dataHolder);
+		for (auto index : { 2u, 67u, 129u })
+			const_cast<Key&>(signatureInputs[index].PublicKey) = Valid_Public_Key;
+
+		// Act + Assert:
+		AssertVerifyMultiResultsAreBackendIndependent(signatureInputs);
+	}
+
+	// endregion
+
 	// region test vectors
 
 	namespace {
@@ -0,0 +1,99 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/deltaset/BaseSetDelta.h"
+#include "tests/test/other/TestElement.h"
+#include "tests/TestHarness.h"
+#include <set>
+
+namespace catapult { namespace deltaset {
+
+#define TEST_CLASS BaseSetDeltaPrefetchTests
+
+	namespace {
+		using ElementType = test::MutableTestElement;
+		using MemorySetType = std::set<ElementType>;
+
+		// storage set that captures prefetched keys
+		class PrefetchCapturingSet : public MemorySetType {
+		public:
+			using MemorySetType::MemorySetType;
+
+		public:
+			mutable std::vector<std::vector<ElementType>> PrefetchedKeys;
+		};
+
+		void PrefetchBaseSet(const PrefetchCapturingSet& set, const std::vector<ElementType>& keys) {
+			set.PrefetchedKeys.push_back(keys);
+		}
+
+		using DeltaType = BaseSetDelta<MutableTypeTraits<ElementType>, SetStorageTraits<PrefetchCapturingSet, MemorySetType>>;
+
+		PrefetchCapturingSet CreateOriginalSet() {
+			return PrefetchCapturingSet{ ElementType("alpha", 1), ElementType("beta", 2), ElementType("gamma", 3) };
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchForwardsAllKeysToOriginalSetWhenThereAreNoPendingChanges) {
+		// Arrange:
+		auto originalSet = CreateOriginalSet();
+		DeltaType delta(originalSet);
+
+		// Act:
+		delta.prefetch({ ElementType("alpha", 1), ElementType("zeta", 9) });
+
+		// Assert:
+		ASSERT_EQ(1u, originalSet.PrefetchedKeys.size());
+		std::vector<ElementType> expectedKeys{ ElementType("alpha", 1), ElementType("zeta", 9) };
+		EXPECT_EQ(expectedKeys, originalSet.PrefetchedKeys[0]);
+	}
+
+	TEST(TEST_CLASS, PrefetchSkipsKeysWithPendingChanges) {
+		// Arrange: copy alpha, remove beta and add delta
+		auto originalSet = CreateOriginalSet();
+		DeltaType delta(originalSet);
+		delta.find(ElementType("alpha", 1));
+		delta.remove(ElementType("beta", 2));
+		delta.insert(ElementType("delta", 4));
+
+		// Act:
+		delta.prefetch({
+			ElementType("alpha", 1), ElementType("beta", 2), ElementType("gamma", 3), ElementType("delta", 4), ElementType("zeta", 9)
+		});
+
+		// Assert:
+		ASSERT_EQ(1u, originalSet.PrefetchedKeys.size());
+		std::vector<ElementType> expectedKeys{ ElementType("gamma", 3), ElementType("zeta", 9) };
+		EXPECT_EQ(expectedKeys, originalSet.PrefetchedKeys[0]);
+	}
+
+	TEST(TEST_CLASS, PrefetchIsBypassedWhenAllKeysHavePendingChanges) {
+		// Arrange:
+		auto originalSet = CreateOriginalSet();
+		DeltaType delta(originalSet);
+		delta.insert(ElementType("delta", 4));
+
+		// Act:
+		delta.prefetch({ ElementType("delta", 4) });
+
+		// Assert:
+		EXPECT_TRUE(originalSet.PrefetchedKeys.empty());
+	}
+}}
@@ -362,6 +362,58 @@ namespace catapult { namespace deltaset {
 
 	// endregion
 
+	// region prefetch
+
+	namespace {
+		using PrefetchElementType = SetTraits::Types::StorageSetType::value_type;
+
+		// storage set that captures prefetched keys
+		class PrefetchCapturingSet : public SetTraits::Types::StorageSetType {
+		public:
+			explicit PrefetchCapturingSet(std::vector<PrefetchElementType>& prefetchedKeys) : PrefetchedKeys(prefetchedKeys)
+			{}
+
+		public:
+			std::vector<PrefetchElementType>& PrefetchedKeys;
+		};
+
+		void PrefetchBaseSet(const PrefetchCapturingSet& set, const std::vector<PrefetchElementType>& keys) {
+			set.PrefetchedKeys.insert(set.PrefetchedKeys.end(), keys.cbegin(), keys.cend());
+		}
+
+		using PrefetchContainerType = ConditionalContainer<
+			SetTraits::Types::StorageTraits::KeyTraits,
+			PrefetchCapturingSet,
+			SetTraits::Types::MemorySetType>;
+	}
+
+	TEST(TEST_CLASS, PrefetchIsForwardedToUnderlyingStorageContainer) {
+		// Arrange:
+		std::vector<PrefetchElementType> prefetchedKeys;
+		PrefetchContainerType container(ConditionalContainerMode::Storage, prefetchedKeys);
+
+		// Act:
+		PrefetchBaseSet(container, { test::MutableTestElement("alpha", 5), test::MutableTestElement("gamma", 7) });
+
+		// Assert:
+		std::vector<PrefetchElementType> expectedKeys{ test::MutableTestElement("alpha", 5), test::MutableTestElement("gamma", 7) };
+		EXPECT_EQ(expectedKeys, prefetchedKeys);
+	}
+
+	TEST(TEST_CLASS, PrefetchIsNotForwardedToUnderlyingMemoryContainer) {
+		// Arrange:
+		std::vector<PrefetchElementType> prefetchedKeys;
+		PrefetchContainerType container(ConditionalContainerMode::Memory, prefetchedKeys);
+
+		// Act:
+		PrefetchBaseSet(container, { test::MutableTestElement("alpha", 5), test::MutableTestElement("gamma", 7) });
+
+		// Assert:
+		EXPECT_TRUE(prefetchedKeys.empty());
+	}
+
+	// endregion
+
 	// region iterable
 
 	TEST(TEST_CLASS, StorageBasedCacheIsNotIterable) {
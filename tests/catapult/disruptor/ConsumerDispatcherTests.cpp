@@ -455,6 +455,80 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
 	}
 
+	TEST(TEST_CLASS, LowerLevelConsumerProcessesNextElementsWhileHigherLevelConsumerIsBusy) {
+		// Arrange: second consumer is blocked while processing the first element
+		auto ranges = test::PrepareRanges(3);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		test::AutoSetFlag isUnblocked;
+		auto pIsUnblocked = isUnblocked.state();
+
+		CollectedHeights collectedHeights[2];
+		auto blockingConsumer = [&collector = collectedHeights[1], pIsUnblocked](auto& consumerInput) {
+			pIsUnblocked->wait();
+			collector.push_back(BlockElementVectorToHeights(consumerInput.blocks()));
+			return ConsumerResult::Continue();
+		};
+
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateConsumer(collectedHeights[0]), blockingConsumer });
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(3u, collectedHeights[0].size());
+
+		// Assert: first consumer processed all elements while second consumer is still processing the first one
+		EXPECT_EQ(0u, collectedHeights[1].size());
+
+		// Act: unblock the second consumer
+		pIsUnblocked->set();
+		WAIT_FOR_VALUE_EXPR(3u, collectedHeights[1].size());
+
+		// Assert:
+		EXPECT_EQ(expectedHeights, collectedHeights[0].get());
+		EXPECT_EQ(expectedHeights, collectedHeights[1].get());
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithMultipleProducers) {
+		// Arrange:
+		constexpr auto Num_Producers = 4u;
+		constexpr auto Num_Ranges_Per_Producer = 50u;
+		std::vector<std::vector<model::BlockRange>> producerRanges;
+		std::vector<Heights> expectedHeights;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			producerRanges.push_back(test::PrepareRanges(Num_Ranges_Per_Producer));
+			auto heights = GetExpectedHeights(producerRanges.back());
+			expectedHeights.insert(expectedHeights.end(), heights.cbegin(), heights.cend());
+		}
+
+		CollectedHeights collectedHeights[2];
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Act: push elements from multiple threads concurrently
+		boost::thread_group threads;
+		for (auto& ranges : producerRanges)
+			threads.create_thread([&dispatcher, &ranges]() { ProcessAll(dispatcher, std::move(ranges)); });
+
+		threads.join_all();
+		WAIT_FOR_VALUE_EXPR(Num_Producers * Num_Ranges_Per_Producer, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: all consumers see the elements in the same order
+		EXPECT_EQ(Num_Producers * Num_Ranges_Per_Producer, dispatcher.numAddedElements());
+		EXPECT_EQ(collectedHeights[0].get(), collectedHeights[1].get());
+		EXPECT_EQ(collectedHeights[0].get(), inspectedHeights.get());
+
+		// - every element is processed exactly once
+		auto sortedHeights = inspectedHeights.get();
+		std::sort(sortedHeights.begin(), sortedHeights.end());
+		std::sort(expectedHeights.begin(), expectedHeights.end());
+		EXPECT_EQ(expectedHeights, sortedHeights);
+	}
+
 	// endregion
 
 	// region element marking
@@ -531,6 +605,143 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region consumer levels
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithEmptyConsumerLevel) {
+		// Arrange:
+		DisruptorConsumerLevels consumerLevels{ {}, { CreateNoOpConsumer() } };
+
+		// Act + Assert:
+		auto inspector = [](const auto&, const auto&) {};
+		EXPECT_THROW(ConsumerDispatcher(Test_Dispatcher_Options, consumerLevels, inspector), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithMultipleConsumersInLastLevel) {
+		// Arrange:
+		DisruptorConsumerLevels consumerLevels{ { CreateNoOpConsumer() }, { CreateNoOpConsumer(), CreateNoOpConsumer() } };
+
+		// Act + Assert:
+		auto inspector = [](const auto&, const auto&) {};
+		EXPECT_THROW(ConsumerDispatcher(Test_Dispatcher_Options, consumerLevels, inspector), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateDispatcherWithMultipleConsumersInLevel) {
+		// Arrange:
+		DisruptorConsumerLevels consumerLevels{
+			{ CreateNoOpConsumer() },
+			{ CreateNoOpConsumer(), CreateNoOpConsumer(), CreateNoOpConsumer() },
+			{ CreateNoOpConsumer() }
+		};
+
+		// Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, consumerLevels, [](const auto&, const auto&) {});
+
+		// Assert:
+		EXPECT_EQ(5u, dispatcher.size());
+		AssertHasProcessedNoElements(dispatcher);
+	}
+
+	TEST(TEST_CLASS, ConsumersInSameLevelProcessElementConcurrently) {
+		// Arrange: each consumer in the level waits until all consumers in the level have started processing the element
+		constexpr auto Num_Level_Consumers = 3u;
+		auto ranges = test::PrepareRanges(2);
+		auto expectedHeights = GetExpectedHeights(ranges);
+
+		std::atomic<size_t> numStartedConsumers(0);
+		std::vector<DisruptorConsumer> levelConsumers;
+		for (auto i = 0u; i < Num_Level_Consumers; ++i) {
+			levelConsumers.push_back([&numStartedConsumers](const auto&) {
+				++numStartedConsumers;
+				WAIT_FOR_EXPR(numStartedConsumers >= Num_Level_Consumers);
+				return ConsumerResult::Continue();
+			});
+		}
+
+		CollectedHeights collectedHeights;
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				DisruptorConsumerLevels{ levelConsumers, { CreateConsumer(collectedHeights) } },
+				[](const auto&, const auto&) {});
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(2u, collectedHeights.size());
+
+		// Assert:
+		EXPECT_EQ(expectedHeights, collectedHeights.get());
+	}
+
+	TEST(TEST_CLASS, NextLevelWaitsForAllConsumersInLevel) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(1);
+		test::AutoSetFlag isUnblocked;
+		auto pIsUnblocked = isUnblocked.state();
+
+		std::atomic<size_t> numFastConsumerCalls(0);
+		auto fastConsumer = [&numFastConsumerCalls](const auto&) {
+			++numFastConsumerCalls;
+			return ConsumerResult::Continue();
+		};
+		auto slowConsumer = [pIsUnblocked](const auto&) {
+			pIsUnblocked->wait();
+			return ConsumerResult::Continue();
+		};
+
+		CollectedHeights collectedHeights;
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				DisruptorConsumerLevels{ { fastConsumer, slowConsumer }, { CreateConsumer(collectedHeights) } },
+				[](const auto&, const auto&) {});
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_ONE(numFastConsumerCalls);
+		test::Pause();
+
+		// Sanity: element was not passed to the next level
+		EXPECT_EQ(0u, collectedHeights.size());
+
+		// Act: unblock the slow consumer
+		pIsUnblocked->set();
+		WAIT_FOR_ONE_EXPR(collectedHeights.size());
+
+		// Assert:
+		EXPECT_EQ(1u, numFastConsumerCalls);
+		EXPECT_EQ(1u, collectedHeights.size());
+	}
+
+	TEST(TEST_CLASS, ElementsAbortedByConsumerInLevelAreSkippedByHigherLevels) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(5);
+		for (auto i = 0u; i < ranges.size(); ++i)
+			ranges[i].begin()->Height = Height(i + 1);
+
+		CollectedHeights collectedHeights;
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				DisruptorConsumerLevels{
+					{ CreateNoOpConsumer(), CreateSkipIfFirstBlockIsEvenConsumer() },
+					{ CreateConsumer(collectedHeights) }
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+
+		// Assert: ranges have first heights 1-5, where even heights should be aborted
+		EXPECT_EQ(3u, collectedHeights.size());
+
+		auto expectedStatuses = std::vector<CompletionStatus>(5, CompletionStatus::Normal);
+		expectedStatuses[1] = CompletionStatus::Aborted;
+		expectedStatuses[3] = CompletionStatus::Aborted;
+		EXPECT_EQ(expectedStatuses, inspectedStatuses);
+	}
+
+	// endregion
+
 	// region exception + space exhaution
 
 #ifdef __clang__
@@ -45,4 +45,32 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	TEST(TEST_CLASS, CanTryAdvanceBarrierAtExpectedPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+		PositionType expectedPosition = 1;
+
+		// Act:
+		auto result = barrier.tryAdvance(expectedPosition);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(1u, expectedPosition);
+		EXPECT_EQ(2u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, CannotTryAdvanceBarrierAtOtherPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 3);
+		PositionType expectedPosition = 1;
+
+		// Act:
+		auto result = barrier.tryAdvance(expectedPosition);
+
+		// Assert: expected position is updated to current position
+		EXPECT_FALSE(result);
+		EXPECT_EQ(3u, expectedPosition);
+		EXPECT_EQ(3u, barrier.position());
+	}
 }}
@@ -191,4 +191,42 @@ namespace catapult { namespace disruptor {
 			++i;
 		}
 	}
+
+	// region ToSequentialConsumerLevels
+
+	TEST(TEST_CLASS, ToSequentialConsumerLevelsReturnsNoLevelsWhenThereAreNoConsumers) {
+		// Act:
+		auto consumerLevels = ToSequentialConsumerLevels({});
+
+		// Assert:
+		EXPECT_TRUE(consumerLevels.empty());
+	}
+
+	TEST(TEST_CLASS, ToSequentialConsumerLevelsPlacesEachConsumerInSeparateLevel) {
+		// Arrange:
+		std::vector<size_t> calledConsumerIds;
+		std::vector<DisruptorConsumer> consumers;
+		for (auto i = 0u; i < 3; ++i) {
+			consumers.push_back([&calledConsumerIds, i](const auto&) {
+				calledConsumerIds.push_back(i);
+				return ConsumerResult::Continue();
+			});
+		}
+
+		// Act:
+		auto consumerLevels = ToSequentialConsumerLevels(consumers);
+
+		// Assert:
+		ASSERT_EQ(3u, consumerLevels.size());
+
+		ConsumerInput input;
+		for (const auto& levelConsumers : consumerLevels) {
+			ASSERT_EQ(1u, levelConsumers.size());
+			levelConsumers[0](input);
+		}
+
+		EXPECT_EQ(std::vector<size_t>({ 0, 1, 2 }), calledConsumerIds);
+	}
+
+	// endregion
 }}
@@ -25,6 +25,7 @@
 #include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
 #include <boost/thread.hpp>
+#include <set>
 
 namespace catapult { namespace disruptor {
 
@@ -206,4 +207,171 @@ namespace catapult { namespace disruptor {
 				EXPECT_TRUE(disruptor.isSkipped(i));
 		}
 	}
+
+	// region tryClaim / set / publish
+
+	TEST(TEST_CLASS, CanClaimPositionsWhenDisruptorHasSpareCapacity) {
+		// Arrange:
+		Disruptor disruptor(16);
+
+		// Act:
+		std::vector<PositionType> positions;
+		for (auto i = 0u; i < 15; ++i) {
+			PositionType position;
+			EXPECT_TRUE(disruptor.tryClaim(0, position)) << i;
+			positions.push_back(position);
+		}
+
+		// Assert: one slot is always kept free
+		EXPECT_EQ(15u, disruptor.added());
+		for (auto i = 0u; i < 15; ++i)
+			EXPECT_EQ(i, positions[i]);
+	}
+
+	TEST(TEST_CLASS, CannotClaimPositionWhenDisruptorIsFull) {
+		// Arrange:
+		Disruptor disruptor(16);
+		PositionType position;
+		for (auto i = 0u; i < 15; ++i)
+			disruptor.tryClaim(0, position);
+
+		// Act:
+		auto result = disruptor.tryClaim(0, position);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(15u, disruptor.added());
+	}
+
+	TEST(TEST_CLASS, CanClaimPositionWhenSlowestConsumerAdvances) {
+		// Arrange:
+		Disruptor disruptor(16);
+		PositionType position;
+		for (auto i = 0u; i < 15; ++i)
+			disruptor.tryClaim(0, position);
+
+		// Act:
+		auto result = disruptor.tryClaim(1, position);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(15u, position);
+		EXPECT_EQ(16u, disruptor.added());
+	}
+
+	TEST(TEST_CLASS, SetCreatesElementAtClaimedPosition) {
+		// Arrange:
+		Disruptor disruptor(16);
+		PositionType position;
+		disruptor.tryClaim(0, position);
+		disruptor.tryClaim(0, position);
+
+		auto pBlock = test::GenerateEmptyRandomBlock();
+		pBlock->Height = Height(123);
+
+		// Act:
+		auto id = disruptor.set(position, ConsumerInput(model::BlockRange::FromEntity(std::move(pBlock))), [](auto, auto) {});
+
+		// Assert:
+		EXPECT_EQ(2u, id);
+		EXPECT_EQ(2u, disruptor.elementAt(1).id());
+		EXPECT_EQ(Height(123), disruptor.elementAt(1).input().blocks()[0].Block.Height);
+	}
+
+	TEST(TEST_CLASS, PublishAdvancesBarrierWhenElementsArePublishedInOrder) {
+		// Arrange:
+		Disruptor disruptor(16);
+		DisruptorBarrier barrier(0, 0);
+		PositionType position;
+		for (auto i = 0u; i < 3; ++i)
+			disruptor.tryClaim(0, position);
+
+		// Act + Assert:
+		for (auto i = 0u; i < 3; ++i) {
+			disruptor.publish(i, barrier);
+			EXPECT_EQ(i + 1, barrier.position());
+		}
+	}
+
+	TEST(TEST_CLASS, PublishDoesNotAdvanceBarrierPastUnpublishedElements) {
+		// Arrange:
+		Disruptor disruptor(16);
+		DisruptorBarrier barrier(0, 0);
+		PositionType position;
+		for (auto i = 0u; i < 4; ++i)
+			disruptor.tryClaim(0, position);
+
+		// Act + Assert: barrier does not move until first element is published
+		disruptor.publish(2, barrier);
+		disruptor.publish(1, barrier);
+		EXPECT_EQ(0u, barrier.position());
+
+		// - publishing first element advances barrier past all consecutive published elements
+		disruptor.publish(0, barrier);
+		EXPECT_EQ(3u, barrier.position());
+
+		disruptor.publish(3, barrier);
+		EXPECT_EQ(4u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, PublishIgnoresElementsPublishedInPreviousRound) {
+		// Arrange: publish a full round of elements
+		Disruptor disruptor(4);
+		DisruptorBarrier barrier(0, 0);
+		PositionType position;
+		for (auto i = 0u; i < 4; ++i) {
+			disruptor.tryClaim(i, position);
+			disruptor.publish(position, barrier);
+		}
+
+		// Act: claim two more elements (wrapping around) but publish only the second one
+		disruptor.tryClaim(4, position);
+		disruptor.tryClaim(4, position);
+		disruptor.publish(5, barrier);
+
+		// Assert:
+		EXPECT_EQ(4u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, ConcurrentProducersClaimAndPublishAllElements) {
+		// Arrange:
+		constexpr auto Num_Producers = 8u;
+		constexpr auto Num_Elements_Per_Producer = 500u;
+		Disruptor disruptor(Num_Producers * Num_Elements_Per_Producer + 2);
+		DisruptorBarrier barrier(0, 0);
+
+		// Act:
+		std::vector<std::vector<DisruptorElementId>> producerIds(Num_Producers);
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			threads.create_thread([&disruptor, &barrier, &ids = producerIds[i]]() {
+				for (auto j = 0u; j < Num_Elements_Per_Producer; ++j) {
+					PositionType position;
+					if (!disruptor.tryClaim(0, position))
+						CATAPULT_THROW_RUNTIME_ERROR("unexpected full disruptor");
+
+					auto pBlock = test::GenerateEmptyRandomBlock();
+					auto input = ConsumerInput(model::BlockRange::FromEntity(std::move(pBlock)));
+					ids.push_back(disruptor.set(position, std::move(input), [](auto, auto) {}));
+					disruptor.publish(position, barrier);
+				}
+			});
+		}
+
+		threads.join_all();
+
+		// Assert: all elements are published and every id is assigned exactly once
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, disruptor.added());
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, barrier.position());
+
+		std::set<DisruptorElementId> allIds;
+		for (const auto& ids : producerIds)
+			allIds.insert(ids.cbegin(), ids.cend());
+
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, allIds.size());
+		EXPECT_EQ(1u, *allIds.cbegin());
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, *allIds.crbegin());
+	}
+
+	// endregion
 }}
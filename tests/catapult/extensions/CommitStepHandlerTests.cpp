@@ -34,8 +34,12 @@ namespace catapult { namespace extensions {
 		class CreateCommitStepHandlerTestContext {
 		public:
 			explicit CreateCommitStepHandlerTestContext(uint64_t syncIndexWriterValue)
+					: CreateCommitStepHandlerTestContext(syncIndexWriterValue, [](const auto& action) { action(); })
+			{}
+
+			CreateCommitStepHandlerTestContext(uint64_t syncIndexWriterValue, const StateDurabilityBarrier& stateDurabilityBarrier)
 					: m_dataDirectory(m_tempDir.name())
-					, m_commitStep(CreateCommitStepHandler(m_dataDirectory)) {
+					, m_commitStep(CreateCommitStepHandler(m_dataDirectory, stateDurabilityBarrier)) {
 				auto stateChangeDirectory = m_dataDirectory.spoolDir("state_change");
 				boost::filesystem::create_directories(stateChangeDirectory.path());
 
@@ -124,5 +128,41 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(123u, context.readIndexWriterValue());
 	}
 
+	TEST(TEST_CLASS, IndexWriterFileIsUpdatedOnlyWhenStateDurabilityBarrierExecutesAction) {
+		// Arrange:
+		std::vector<action> deferredActions;
+		CreateCommitStepHandlerTestContext context(123, [&deferredActions](const auto& action) {
+			deferredActions.push_back(action);
+		});
+
+		// Act:
+		context.commitStep(consumers::CommitOperationStep::All_Updated);
+
+		// Assert: commit step is updated immediately but index writer file is not
+		EXPECT_EQ(consumers::CommitOperationStep::All_Updated, context.readCommitStep());
+		EXPECT_FALSE(context.existsIndexWriterValue());
+		ASSERT_EQ(1u, deferredActions.size());
+
+		// Act: execute the deferred action
+		deferredActions[0]();
+
+		// Assert:
+		EXPECT_TRUE(context.existsIndexWriterValue());
+		EXPECT_EQ(123u, context.readIndexWriterValue());
+	}
+
+	TEST(TEST_CLASS, StateDurabilityBarrierIsNotUsedWhenOperationIsNotAllUpdated) {
+		// Arrange:
+		auto numBarrierCalls = 0u;
+		CreateCommitStepHandlerTestContext context(123, [&numBarrierCalls](const auto&) { ++numBarrierCalls; });
+
+		// Act:
+		context.commitStep(consumers::CommitOperationStep::Blocks_Written);
+		context.commitStep(consumers::CommitOperationStep::State_Written);
+
+		// Assert:
+		EXPECT_EQ(0u, numBarrierCalls);
+	}
+
 	// endregion
 }}
@@ -35,6 +35,7 @@ namespace catapult { namespace extensions {
 		test::MutableCatapultConfiguration config;
 		config.Node.EnableCacheDatabaseStorage = true;
 		config.Node.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromKilobytes(123);
+		config.Node.MaxCachedPatriciaTreeNodes = 4321;
 		config.User.DataDirectory = "foo_bar";
 
 		// Act:
@@ -44,6 +45,51 @@ namespace catapult { namespace extensions {
 		EXPECT_TRUE(storageConfig.PreferCacheDatabase);
 		EXPECT_EQ("foo_bar/statedb", storageConfig.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(123), storageConfig.MaxCacheDatabaseWriteBatchSize);
+		EXPECT_EQ(4321u, storageConfig.MaxCachedPatriciaTreeNodes);
+	}
+
+	TEST(TEST_CLASS, CanCreateStorageConfigurationWithCacheDatabaseTuning) {
+		// Arrange:
+		test::MutableCatapultConfiguration config;
+		auto& cacheDatabaseConfig = config.Node.CacheDatabase;
+		cacheDatabaseConfig.EnableStatistics = true;
+		cacheDatabaseConfig.MaxBackgroundJobs = 7;
+		cacheDatabaseConfig.BlockCacheSize = utils::FileSize::FromMegabytes(12);
+		cacheDatabaseConfig.MaxPendingWriteBatches = 9;
+		cacheDatabaseConfig.WriteBufferSize = utils::FileSize::FromMegabytes(3);
+		cacheDatabaseConfig.BloomFilterBitsPerKey = 10;
+		cacheDatabaseConfig.EnablePartitionedIndexFilters = true;
+		cacheDatabaseConfig.CompressionPerLevel = "none,lz4";
+
+		auto& columnConfig = cacheDatabaseConfig.Columns["patricia_tree"];
+		columnConfig.WriteBufferSize = utils::FileSize::FromMegabytes(5);
+		columnConfig.BloomFilterBitsPerKey = 16;
+		columnConfig.EnablePartitionedIndexFilters = false;
+		columnConfig.CompressionPerLevel = "zstd";
+
+		// Act:
+		auto storageConfig = CreateStorageConfiguration(config.ToConst());
+
+		// Assert:
+		EXPECT_EQ(utils::FileSize::FromMegabytes(12), storageConfig.CacheDatabaseBlockCacheSize);
+		EXPECT_TRUE(storageConfig.EnableCacheDatabaseStatistics);
+		EXPECT_EQ(9u, storageConfig.MaxPendingCacheDatabaseWriteBatches);
+
+		const auto& tuning = storageConfig.CacheDatabaseTuning;
+		EXPECT_EQ(7u, tuning.MaxBackgroundJobs);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(3), tuning.DefaultColumnSettings.WriteBufferSize);
+		EXPECT_EQ(10u, tuning.DefaultColumnSettings.BloomFilterBitsPerKey);
+		EXPECT_TRUE(tuning.DefaultColumnSettings.EnablePartitionedIndexFilters);
+		EXPECT_EQ("none,lz4", tuning.DefaultColumnSettings.CompressionPerLevel);
+
+		ASSERT_EQ(1u, tuning.ColumnSettings.size());
+		const auto& columnSettings = tuning.ColumnSettings.find("patricia_tree")->second;
+		EXPECT_EQ(utils::FileSize::FromMegabytes(5), columnSettings.WriteBufferSize);
+		EXPECT_EQ(16u, columnSettings.BloomFilterBitsPerKey);
+		EXPECT_FALSE(columnSettings.EnablePartitionedIndexFilters);
+		EXPECT_EQ("zstd", columnSettings.CompressionPerLevel);
+
+		EXPECT_FALSE(!!tuning.pSharedResources);
 	}
 
 	namespace {
@@ -101,12 +101,12 @@ namespace catapult { namespace handlers {
 		static auto ExtractFromPacket(const ionet::Packet& packet, size_t numRequestHashes) {
 			auto minFeeMultiplier = reinterpret_cast<const BlockFeeMultiplier&>(*packet.Data());
 
-			utils::ShortHashesSet extractedShortHashes;
+			std::vector<utils::ShortHash> extractedShortHashes;
 			auto pShortHashData = reinterpret_cast<const utils::ShortHash*>(packet.Data() + sizeof(BlockFeeMultiplier));
 			for (auto i = 0u; i < numRequestHashes; ++i)
-				extractedShortHashes.insert(*pShortHashData++);
+				extractedShortHashes.push_back(*pShortHashData++);
 
-			return std::make_pair(minFeeMultiplier, extractedShortHashes);
+			return std::make_pair(minFeeMultiplier, utils::ShortHashesSet(std::move(extractedShortHashes)));
 		}
 
 		class PullResponseContext {
@@ -274,6 +274,37 @@ namespace catapult { namespace io {
 		EXPECT_EQ(context.storage().pBlockElement, pBlockElement);
 	}
 
+	TEST(TEST_CLASS, LoadBlockElementsDelegatesToStorage) {
+		// Arrange:
+		class MockBlockStorage : public UnsupportedBlockStorage {
+		public:
+			mutable std::vector<std::tuple<Height, size_t, size_t>> Params;
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+
+		public:
+			std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(
+					Height height,
+					size_t maxBlocks,
+					size_t maxBytes) const override {
+				Params.emplace_back(height, maxBlocks, maxBytes);
+				return { pBlockElement };
+			}
+		};
+
+		TestContext<MockBlockStorage> context;
+		auto pBlock = test::GenerateEmptyRandomBlock();
+		context.storage().pBlockElement = std::make_shared<model::BlockElement>(*pBlock);
+
+		// Act:
+		auto blockElements = context.aggregate().loadBlockElements(Height(321), 7, 1234);
+
+		// Assert:
+		ASSERT_EQ(1u, context.storage().Params.size());
+		EXPECT_EQ(std::make_tuple(Height(321), 7u, 1234u), context.storage().Params[0]);
+		ASSERT_EQ(1u, blockElements.size());
+		EXPECT_EQ(context.storage().pBlockElement, blockElements[0]);
+	}
+
 	TEST(TEST_CLASS, LoadBlockStatementDataDelegatesToStorage) {
 		// Arrange:
 		class MockBlockStorage : public UnsupportedBlockStorage {
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/io/BlockStorageCache.h"
+#include "tests/test/core/BlockStatementTestUtils.h"
 #include "tests/test/core/BlockStorageTests.h"
 #include "tests/test/nodeps/LockTestUtils.h"
 #include "tests/TestHarness.h"
@@ -30,11 +31,14 @@ namespace catapult { namespace io {
 	namespace {
 		// region BlockStorageCacheToBlockStorageAdapter
 
+		constexpr size_t Max_Cached_Block_Elements = 5;
+
 		// wraps a BlockStorageCache in a BlockStorage so that it can be tested via the tests in ChainStorageTests.h
+		// (recent block element caching is enabled with a small capacity so that eviction and invalidation are exercised)
 		class BlockStorageCacheToBlockStorageAdapter : public BlockStorage {
 		public:
 			explicit BlockStorageCacheToBlockStorageAdapter(std::unique_ptr<BlockStorage>&& pStorage)
-					: m_cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0))
+					: m_cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), Max_Cached_Block_Elements)
 			{}
 
 		public: // LightBlockStorage
@@ -71,6 +75,13 @@ namespace catapult { namespace io {
 				return m_cache.view().loadBlockElement(height);
 			}
 
+			std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(
+					Height height,
+					size_t maxBlocks,
+					size_t maxBytes) const override {
+				return m_cache.view().loadBlockElements(height, maxBlocks, maxBytes);
+			}
+
 			std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override {
 				return m_cache.view().loadBlockStatementData(height);
 			}
@@ -490,6 +501,147 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region recent block elements
+
+	namespace {
+		void AssertStatistics(const BlockStorageCache& cache, uint64_t numHits, uint64_t numMisses, size_t size) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(size, statistics.Size);
+		}
+
+		void LoadBlockElements(const BlockStorageCache& cache, std::initializer_list<uint64_t> heights) {
+			for (auto height : heights)
+				cache.view().loadBlockElement(Height(height));
+		}
+	}
+
+	TEST(TEST_CLASS, RecentBlockElementsAreNotCachedByDefault) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0));
+
+		// Act:
+		LoadBlockElements(cache, { 3, 3, 4 });
+		cache.view().loadBlock(Height(3));
+		cache.view().loadBlockStatementData(Height(3));
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementCachesRecentBlockElements) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto* pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), 5);
+		LoadBlockElements(cache, { 3, 4 });
+
+		auto pExpectedBlockElement3 = pStorageRaw->loadBlockElement(Height(3));
+		auto pExpectedBlockElement4 = pStorageRaw->loadBlockElement(Height(4));
+
+		// - drop blocks from the underlying storage so that subsequent loads can only be served from memory
+		pStorageRaw->dropBlocksAfter(Height(1));
+
+		// Act:
+		auto pBlockElement3 = cache.view().loadBlockElement(Height(3));
+		auto pBlockElement4 = cache.view().loadBlockElement(Height(4));
+		auto pBlock3 = cache.view().loadBlock(Height(3));
+
+		// Assert:
+		test::AssertEqual(*pExpectedBlockElement3, *pBlockElement3);
+		test::AssertEqual(*pExpectedBlockElement4, *pBlockElement4);
+		EXPECT_EQ(pExpectedBlockElement3->Block, *pBlock3);
+		AssertStatistics(cache, 3, 2, 2);
+	}
+
+	TEST(TEST_CLASS, LoadBlockCachesRecentBlockElements) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto* pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), 5);
+		cache.view().loadBlock(Height(3));
+
+		auto pExpectedBlockElement = pStorageRaw->loadBlockElement(Height(3));
+		pStorageRaw->dropBlocksAfter(Height(1));
+
+		// Act:
+		auto pBlock = cache.view().loadBlock(Height(3));
+		auto pBlockElement = cache.view().loadBlockElement(Height(3));
+
+		// Assert:
+		EXPECT_EQ(pExpectedBlockElement->Block, *pBlock);
+		test::AssertEqual(*pExpectedBlockElement, *pBlockElement);
+		AssertStatistics(cache, 2, 1, 1);
+	}
+
+	TEST(TEST_CLASS, LoadBlockStatementDataCachesRecentBlockStatementData) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(0);
+		auto* pStorageRaw = pStorage.get();
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		blockElement.OptionalStatement = test::GenerateRandomStatements({ 2, 3, 4 });
+		pStorageRaw->saveBlock(blockElement);
+
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), 5);
+		auto expectedBlockStatementData = cache.view().loadBlockStatementData(Height(2));
+		pStorageRaw->dropBlocksAfter(Height(1));
+
+		// Act:
+		auto blockStatementData = cache.view().loadBlockStatementData(Height(2));
+
+		// Assert:
+		EXPECT_TRUE(blockStatementData.second);
+		EXPECT_EQ(expectedBlockStatementData, blockStatementData);
+		AssertStatistics(cache, 1, 1, 1);
+	}
+
+	TEST(TEST_CLASS, RecentBlockElementsCacheEvictsLeastRecentlyUsedBlockElements) {
+		// Arrange: fill the cache and then touch the oldest entry
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0), 3);
+		LoadBlockElements(cache, { 2, 3, 4, 2 });
+
+		// Act: add a new entry
+		LoadBlockElements(cache, { 5 });
+
+		// Assert: 3 was evicted
+		AssertStatistics(cache, 1, 4, 3);
+
+		LoadBlockElements(cache, { 2, 4, 5 });
+		AssertStatistics(cache, 4, 4, 3);
+
+		LoadBlockElements(cache, { 3 });
+		AssertStatistics(cache, 4, 5, 3);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterInvalidatesRecentBlockElements) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0), 5);
+		LoadBlockElements(cache, { 5, 6, 7, 8 });
+
+		auto pNewBlock = test::GenerateBlockWithTransactions(5, Height(7));
+		auto newBlockElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.dropBlocksAfter(Height(6));
+			modifier.saveBlock(newBlockElement);
+			modifier.commit();
+		}
+
+		// Assert: only blocks at or below drop height are still cached
+		AssertStatistics(cache, 0, 4, 2);
+
+		// - new block is loaded from storage (it is the tip, so the recent block elements cache is bypassed)
+		test::AssertEqual(newBlockElement, *cache.view().loadBlockElement(Height(7)));
+		LoadBlockElements(cache, { 5, 6 });
+		AssertStatistics(cache, 2, 4, 2);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
@@ -97,6 +97,93 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region hashes mapping
+
+	namespace {
+		void SaveBlockWithEntityHash(FileBlockStorage& storage, Height height, const Hash256& entityHash) {
+			auto pBlock = test::GenerateBlockWithTransactions(1, height);
+			auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+			blockElement.EntityHash = entityHash;
+			storage.saveBlock(blockElement);
+		}
+	}
+
+	TEST(TEST_CLASS, LoadHashesFromReturnsHashesSavedAfterPreviousLoad) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+		auto hashes1 = pStorage->loadHashesFrom(Height(1), 100);
+
+		// - save more blocks than are present in the initial mapping
+		std::vector<Hash256> entityHashes;
+		for (auto i = 2u; i <= 10; ++i) {
+			entityHashes.push_back(test::GenerateRandomByteArray<Hash256>());
+			SaveBlockWithEntityHash(*pStorage, Height(i), entityHashes.back());
+		}
+
+		// Act:
+		auto hashes2 = pStorage->loadHashesFrom(Height(2), 100);
+
+		// Assert:
+		EXPECT_EQ(1u, hashes1.size());
+		EXPECT_EQ(entityHashes, std::vector<Hash256>(hashes2.cbegin(), hashes2.cend()));
+	}
+
+	TEST(TEST_CLASS, LoadHashesFromReturnsOverwrittenHashes) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+		SaveBlockWithEntityHash(*pStorage, Height(2), test::GenerateRandomByteArray<Hash256>());
+		pStorage->loadHashesFrom(Height(2), 1);
+
+		// - replace the block at height 2
+		auto entityHash = test::GenerateRandomByteArray<Hash256>();
+		pStorage->dropBlocksAfter(Height(1));
+		SaveBlockWithEntityHash(*pStorage, Height(2), entityHash);
+
+		// Act:
+		auto hashes = pStorage->loadHashesFrom(Height(2), 1);
+
+		// Assert:
+		ASSERT_EQ(1u, hashes.size());
+		EXPECT_EQ(entityHash, *hashes.cbegin());
+	}
+
+	TEST(TEST_CLASS, LoadedHashesAreNotChangedWhenHashesAreOverwritten) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+		auto entityHash = test::GenerateRandomByteArray<Hash256>();
+		SaveBlockWithEntityHash(*pStorage, Height(2), entityHash);
+		auto hashes = pStorage->loadHashesFrom(Height(2), 1);
+
+		// Act: replace the block at height 2
+		pStorage->dropBlocksAfter(Height(1));
+		SaveBlockWithEntityHash(*pStorage, Height(2), test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		ASSERT_EQ(1u, hashes.size());
+		EXPECT_EQ(entityHash, *hashes.cbegin());
+	}
+
+	TEST(TEST_CLASS, LoadedHashesCanOutliveStorage) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+		auto entityHash = test::GenerateRandomByteArray<Hash256>();
+		SaveBlockWithEntityHash(*pStorage, Height(2), entityHash);
+
+		// Act:
+		auto hashes = pStorage->loadHashesFrom(Height(2), 1);
+		pStorage.reset();
+
+		// Assert:
+		ASSERT_EQ(1u, hashes.size());
+		EXPECT_EQ(entityHash, *hashes.cbegin());
+	}
+
+	// endregion
+
 	// region folder management
 
 	TEST(TEST_CLASS, PurgeDoesNotDeleteDataDirectory) {
@@ -0,0 +1,89 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/MemoryMappedFile.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileTests
+
+	namespace {
+		auto WriteRandomVectorToFile(const std::string& filename, size_t size) {
+			auto inputData = test::GenerateRandomVector(size);
+			RawFile file(filename, OpenMode::Read_Append);
+			file.seek(file.size());
+			file.write(inputData);
+			return inputData;
+		}
+
+		std::vector<uint8_t> ToVector(const MemoryMappedFile& mappedFile) {
+			return std::vector<uint8_t>(mappedFile.data(), mappedFile.data() + mappedFile.size());
+		}
+	}
+
+	TEST(TEST_CLASS, CannotMapNonexistentFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(guard.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotMapEmptyFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		RawFile(guard.name(), OpenMode::Read_Write);
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(guard.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanMapFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard.name(), 123);
+
+		// Act:
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Assert:
+		EXPECT_EQ(123u, mappedFile.size());
+		EXPECT_EQ(inputData, ToVector(mappedFile));
+	}
+
+	TEST(TEST_CLASS, MappingIsNotExtendedWhenDataIsAppended) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard.name(), 123);
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Act:
+		WriteRandomVectorToFile(guard.name(), 50);
+
+		// Assert: original mapping is unchanged but a new mapping contains all data
+		EXPECT_EQ(123u, mappedFile.size());
+		EXPECT_EQ(inputData, ToVector(mappedFile));
+
+		EXPECT_EQ(173u, MemoryMappedFile(guard.name()).size());
+	}
+}}
@@ -0,0 +1,291 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/PackFileBlockStorage.h"
+#include "catapult/io/IndexFile.h"
+#include "catapult/io/MoveBlockFiles.h"
+#include "catapult/io/PodIoUtils.h"
+#include "tests/test/core/BlockStorageTests.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS PackFileBlockStorageTests
+
+	namespace {
+		constexpr auto Seed_Directory = "../seed/mijin-test";
+
+		struct PackTraits {
+			using Guard = test::TempDirectoryGuard;
+			using StorageType = PackFileBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				if (Seed_Directory != destination)
+					return std::make_unique<StorageType>(destination);
+
+				// seed uses file per block layout, so it needs to be packed before it can be opened
+				static test::TempDirectoryGuard packedSeedGuard("packed_seed");
+				return PrepareStorage(packedSeedGuard.name());
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				boost::filesystem::create_directories(destination);
+
+				auto pStorage = std::make_unique<StorageType>(destination);
+				CopyBlockFiles(FileBlockStorage(Seed_Directory), *pStorage, Height(1), Height(1));
+
+				if (Height() != height)
+					IndexFile(destination + "/index.dat").set(height.unwrap() - 1);
+
+				return pStorage;
+			}
+		};
+	}
+
+	DEFINE_BLOCK_STORAGE_TESTS(PackTraits)
+	DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(PackTraits)
+
+	// region modes
+
+	TEST(TEST_CLASS, HashIndexCanBeEnabled) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		PackFileBlockStorage storage(tempDir.name(), FileBlockStorageMode::Hash_Index);
+
+		// - save a block
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(1));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		storage.saveBlock(blockElement);
+
+		// Act:
+		auto pStorageBlockElement = storage.loadBlockElement(Height(1));
+		auto hashes = storage.loadHashesFrom(Height(1), 100);
+
+		// Assert: hashes are present
+		ASSERT_EQ(1u, hashes.size());
+		EXPECT_EQ(blockElement.EntityHash, *hashes.cbegin());
+		test::AssertEqual(blockElement, *pStorageBlockElement);
+	}
+
+	TEST(TEST_CLASS, HashIndexCanBeDisabled) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		PackFileBlockStorage storage(tempDir.name(), FileBlockStorageMode::None);
+
+		// - save a block
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(1));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		storage.saveBlock(blockElement);
+
+		// Act:
+		auto pStorageBlockElement = storage.loadBlockElement(Height(1));
+
+		// Assert: hashes are not accessible
+		EXPECT_THROW(storage.loadHashesFrom(Height(1), 100), catapult_invalid_argument);
+		test::AssertEqual(blockElement, *pStorageBlockElement);
+	}
+
+	// endregion
+
+	// region folder management
+
+	TEST(TEST_CLASS, PurgeDoesNotDeleteDataDirectory) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		PackFileBlockStorage storage(tempDir.name());
+
+		// Sanity:
+		EXPECT_TRUE(boost::filesystem::exists(tempDir.name()));
+
+		// Act:
+		storage.purge();
+
+		// Assert:
+		EXPECT_TRUE(boost::filesystem::exists(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, BlocksAreStoredInSegmentPackFiles) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = PackTraits::PrepareStorage(tempDir.name());
+
+		// Assert:
+		EXPECT_TRUE(boost::filesystem::exists(tempDir.name() + "/index.dat"));
+		EXPECT_TRUE(boost::filesystem::exists(tempDir.name() + "/00000.pack"));
+		EXPECT_TRUE(boost::filesystem::exists(tempDir.name() + "/00000.index"));
+		EXPECT_FALSE(boost::filesystem::exists(tempDir.name() + "/00000"));
+	}
+
+	TEST(TEST_CLASS, CannotOpenStorageContainingUnpackedBlocks) {
+		// Arrange: prepare a directory with one file per block
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+
+		// Act + Assert:
+		EXPECT_THROW(PackFileBlockStorage(tempDir.name()), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CanOpenStorageWithZeroHeightWithoutPackFiles) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		IndexFile(tempDir.name() + "/index.dat").set(0);
+
+		// Act:
+		PackFileBlockStorage storage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(0), storage.chainHeight());
+	}
+
+	// endregion
+
+	// region storage trailing data
+
+	TEST(TEST_CLASS, CannotReadSavedBlockElementWithTrailingData) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>());
+		{
+			auto pStorage = PackTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element);
+		}
+
+		// - increase the size of the second block element in the index (its statement size is zero)
+		{
+			constexpr auto Entry_Size = Hash256::Size + sizeof(uint64_t) + 2 * sizeof(uint32_t);
+			constexpr auto Block_Element_Size_Offset = 2 * Entry_Size + Hash256::Size + sizeof(uint64_t);
+
+			io::RawFile file(tempDir.name() + "/00000.index", io::OpenMode::Read_Append);
+			file.seek(Block_Element_Size_Offset);
+			auto blockElementSize = io::Read32(file);
+			file.seek(Block_Element_Size_Offset);
+			io::Write32(file, blockElementSize + 1);
+		}
+
+		// - append some data
+		{
+			io::RawFile file(tempDir.name() + "/00000.pack", io::OpenMode::Read_Append);
+			file.seek(file.size());
+			std::vector<uint8_t> buffer{ 42 };
+			file.write(buffer);
+		}
+
+		// Act + Assert:
+		PackFileBlockStorage storage(tempDir.name());
+		EXPECT_THROW(storage.loadBlockElement(Height(2)), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region disk persistence
+
+	// these tests do not make sense for memory-based storage because blocks stored in memory-based storage
+	// do not persist across instances
+
+	TEST(TEST_CLASS, CanReadSavedBlockAcrossDifferentStorageInstances) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>());
+		{
+			auto pStorage = PackTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element);
+		}
+
+		// Act:
+		PackFileBlockStorage storage(tempDir.name());
+		auto pBlockElement = storage.loadBlockElement(Height(2));
+
+		// Assert:
+		test::AssertEqual(element, *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, CanReadMultipleSavedBlocksAcrossDifferentStorageInstances) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(2));
+		auto pBlock2 = test::GenerateBlockWithTransactions(5, Height(3));
+		auto element1 = test::BlockToBlockElement(*pBlock1, test::GenerateRandomByteArray<Hash256>());
+		auto element2 = test::BlockToBlockElement(*pBlock2, test::GenerateRandomByteArray<Hash256>());
+		{
+			auto pStorage = PackTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element1);
+			pStorage->saveBlock(element2);
+		}
+
+		// Act:
+		PackFileBlockStorage storage(tempDir.name());
+		auto pBlockElement1 = storage.loadBlockElement(Height(2));
+		auto pBlockElement2 = storage.loadBlockElement(Height(3));
+
+		// Assert:
+		test::AssertEqual(element1, *pBlockElement1);
+		test::AssertEqual(element2, *pBlockElement2);
+	}
+
+	// endregion
+
+	// region memory mapping
+
+	TEST(TEST_CLASS, LoadedBlockElementRemainsValidAfterBlockIsOverwritten) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = PackTraits::PrepareStorage(tempDir.name());
+
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(2));
+		auto pBlock2 = test::GenerateBlockWithTransactions(7, Height(2));
+		auto element1 = test::BlockToBlockElement(*pBlock1, test::GenerateRandomByteArray<Hash256>());
+		auto element2 = test::BlockToBlockElement(*pBlock2, test::GenerateRandomByteArray<Hash256>());
+		pStorage->saveBlock(element1);
+		auto pBlockElement1 = pStorage->loadBlockElement(Height(2));
+
+		// Act:
+		pStorage->dropBlocksAfter(Height(1));
+		pStorage->saveBlock(element2);
+		auto pBlockElement2 = pStorage->loadBlockElement(Height(2));
+
+		// Assert: the previously loaded element is unchanged
+		test::AssertEqual(element1, *pBlockElement1);
+		test::AssertEqual(element2, *pBlockElement2);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockRemainsValidAfterStorageIsDestroyed) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		std::shared_ptr<const model::Block> pLoadedBlock;
+		{
+			auto pStorage = PackTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>()));
+
+			// Act:
+			pLoadedBlock = pStorage->loadBlock(Height(2));
+		}
+
+		// Assert:
+		EXPECT_EQ(*pBlock, *pLoadedBlock);
+	}
+
+	// endregion
+}}
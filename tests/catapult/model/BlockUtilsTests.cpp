@@ -73,6 +73,26 @@ namespace catapult { namespace model {
 		EXPECT_EQ(context.ExpectedBlockTransactionsHash, actualBlockTransactionsHash);
 	}
 
+	TEST(TEST_CLASS, CanCalculateBlockTransactionsHashWithPartitionRunner) {
+		// Arrange:
+		CalculateBlockTransactionsHashTestContext context(2 * crypto::MerkleHashBuilder::Min_Partitioned_Level_Size + 1);
+
+		auto numRunnerCalls = 0u;
+		auto partitionRunner = [&numRunnerCalls](auto count, const auto& callback) {
+			++numRunnerCalls;
+			callback(0, count / 2);
+			callback(count / 2, count - count / 2);
+		};
+
+		// Act:
+		Hash256 actualBlockTransactionsHash;
+		CalculateBlockTransactionsHash(context.TransactionInfoPointers, partitionRunner, actualBlockTransactionsHash);
+
+		// Assert:
+		EXPECT_EQ(1u, numRunnerCalls);
+		EXPECT_EQ(context.ExpectedBlockTransactionsHash, actualBlockTransactionsHash);
+	}
+
 	namespace {
 		using CalculateBlockTransactionsHashTestContextModifierFunc = consumer<CalculateBlockTransactionsHashTestContext&>;
 
@@ -410,4 +410,59 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region TransactionHashesBuilder
+
+	namespace {
+		void AssertTransactionHashesBuilderMatchesUpdateHashes(
+				const mocks::OffsetRange& dataBufferRange,
+				const std::vector<mocks::OffsetRange>& supplementaryBufferRanges) {
+			// Arrange:
+			auto registry = TransactionRegistry();
+			registry.registerPlugin(mocks::CreateMockTransactionPluginWithCustomBuffers(dataBufferRange, supplementaryBufferRanges));
+
+			auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+			std::vector<std::unique_ptr<Transaction>> transactions;
+			std::vector<TransactionElement> transactionElements;
+			for (auto i = 0u; i < 11; ++i) {
+				transactions.push_back(test::GenerateRandomTransaction());
+				transactionElements.emplace_back(*transactions.back());
+			}
+
+			// Act:
+			TransactionHashesBuilder builder(registry, generationHashSeed);
+			for (auto& transactionElement : transactionElements)
+				builder.update(transactionElement);
+
+			builder.final();
+
+			// Assert:
+			for (auto i = 0u; i < transactionElements.size(); ++i) {
+				auto expectedTransactionElement = TransactionElement(*transactions[i]);
+				UpdateHashes(registry, generationHashSeed, expectedTransactionElement);
+
+				EXPECT_EQ(expectedTransactionElement.EntityHash, transactionElements[i].EntityHash) << "at " << i;
+				EXPECT_EQ(expectedTransactionElement.MerkleComponentHash, transactionElements[i].MerkleComponentHash) << "at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, TransactionHashesBuilder_CanFinalizeWithoutTransactionElements) {
+		// Arrange:
+		auto registry = TransactionRegistry();
+		TransactionHashesBuilder builder(registry, test::GenerateRandomByteArray<GenerationHashSeed>());
+
+		// Act + Assert:
+		EXPECT_NO_THROW(builder.final());
+	}
+
+	TEST(TEST_CLASS, TransactionHashesBuilder_CalculatesSameHashesAsUpdateHashes_NoSupplementaryBuffers) {
+		AssertTransactionHashesBuilderMatchesUpdateHashes({ 5, 15 }, {});
+	}
+
+	TEST(TEST_CLASS, TransactionHashesBuilder_CalculatesSameHashesAsUpdateHashes_SupplementaryBuffers) {
+		AssertTransactionHashesBuilderMatchesUpdateHashes({ 6, 10 }, { { 7, 11 }, { 4, 7 }, { 12, 20 } });
+	}
+
+	// endregion
 }}
@@ -21,6 +21,8 @@
 #include "catapult/plugins/PluginManager.h"
 #include "sdk/src/extensions/ConversionExtensions.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "catapult/cache_db/RocksWriteQueue.h"
 #include "catapult/model/Address.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
@@ -85,6 +87,7 @@ namespace catapult { namespace plugins {
 			EXPECT_EQ(expectedDirectory, cacheConfig.CacheDatabaseDirectory);
 			EXPECT_EQ(utils::FileSize::FromKilobytes(23), cacheConfig.MaxCacheDatabaseWriteBatchSize);
 			EXPECT_FALSE(cacheConfig.ShouldStorePatriciaTrees);
+			EXPECT_FALSE(!!cacheConfig.pPatriciaTreeNodeCache);
 		};
 
 		// Act:
@@ -97,6 +100,129 @@ namespace catapult { namespace plugins {
 		// Assert: cache configuration is constructed appropriately
 		assertCacheConfiguration(manager.cacheConfig("foo"), "abc/foo");
 		assertCacheConfiguration(manager.cacheConfig("bar"), "abc/bar");
+		EXPECT_FALSE(!!manager.patriciaTreeNodeCache());
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithSharedPatriciaTreeNodeCache) {
+		// Arrange:
+		auto config = model::BlockChainConfiguration::Uninitialized();
+		config.EnableVerifiableState = true;
+
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = "abc";
+		storageConfig.MaxCachedPatriciaTreeNodes = 123;
+
+		// Act:
+		auto userConfig = config::UserConfiguration::Uninitialized();
+		PluginManager manager(config, storageConfig, userConfig, config::InflationConfiguration::Uninitialized());
+		auto fooCacheConfig = manager.cacheConfig("foo");
+		auto barCacheConfig = manager.cacheConfig("bar");
+
+		// Assert: all cache configurations share the same node cache
+		ASSERT_TRUE(!!manager.patriciaTreeNodeCache());
+		EXPECT_EQ(123u, manager.patriciaTreeNodeCache()->maxNodes());
+
+		EXPECT_TRUE(fooCacheConfig.ShouldStorePatriciaTrees);
+		EXPECT_EQ(manager.patriciaTreeNodeCache(), fooCacheConfig.pPatriciaTreeNodeCache.get());
+		EXPECT_EQ(manager.patriciaTreeNodeCache(), barCacheConfig.pPatriciaTreeNodeCache.get());
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithCacheDatabaseTuning) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = "abc";
+		storageConfig.CacheDatabaseTuning.MaxBackgroundJobs = 7;
+		storageConfig.CacheDatabaseTuning.DefaultColumnSettings.BloomFilterBitsPerKey = 10;
+
+		// Act:
+		PluginManager manager(
+				model::BlockChainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+		auto fooCacheConfig = manager.cacheConfig("foo");
+		auto barCacheConfig = manager.cacheConfig("bar");
+
+		// Assert: all cache configurations share the same tuning settings
+		ASSERT_TRUE(!!fooCacheConfig.pDatabaseTuning);
+		EXPECT_EQ(fooCacheConfig.pDatabaseTuning, barCacheConfig.pDatabaseTuning);
+		EXPECT_EQ(7u, fooCacheConfig.pDatabaseTuning->MaxBackgroundJobs);
+		EXPECT_EQ(10u, fooCacheConfig.pDatabaseTuning->DefaultColumnSettings.BloomFilterBitsPerKey);
+
+		// - no shared resources are created when neither block cache nor statistics are enabled
+		EXPECT_FALSE(!!manager.cacheDatabaseResources());
+		EXPECT_FALSE(!!fooCacheConfig.pDatabaseTuning->pSharedResources);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithSharedCacheDatabaseResources) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = "abc";
+		storageConfig.CacheDatabaseBlockCacheSize = utils::FileSize::FromMegabytes(1);
+		storageConfig.EnableCacheDatabaseStatistics = true;
+
+		// Act:
+		PluginManager manager(
+				model::BlockChainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+		auto fooCacheConfig = manager.cacheConfig("foo");
+		auto barCacheConfig = manager.cacheConfig("bar");
+
+		// Assert: all cache configurations share the same resources
+		ASSERT_TRUE(!!manager.cacheDatabaseResources());
+		EXPECT_TRUE(!!manager.cacheDatabaseResources()->blockCache());
+		EXPECT_TRUE(!!manager.cacheDatabaseResources()->statistics());
+
+		EXPECT_EQ(manager.cacheDatabaseResources(), fooCacheConfig.pDatabaseTuning->pSharedResources.get());
+		EXPECT_EQ(manager.cacheDatabaseResources(), barCacheConfig.pDatabaseTuning->pSharedResources.get());
+	}
+
+	TEST(TEST_CLASS, CacheDatabaseWriteQueueIsNotCreatedWhenMaxPendingWriteBatchesIsZero) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = "abc";
+
+		// Act:
+		PluginManager manager(
+				model::BlockChainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+		auto cacheConfig = manager.cacheConfig("foo");
+
+		// Assert:
+		EXPECT_FALSE(!!manager.cacheDatabaseWriteQueue());
+		EXPECT_FALSE(!!cacheConfig.pDatabaseTuning->pWriteQueue);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithSharedCacheDatabaseWriteQueue) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = "abc";
+		storageConfig.MaxPendingCacheDatabaseWriteBatches = 5;
+
+		// Act:
+		PluginManager manager(
+				model::BlockChainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+		auto fooCacheConfig = manager.cacheConfig("foo");
+		auto barCacheConfig = manager.cacheConfig("bar");
+
+		// Assert: all cache configurations share the same write queue
+		ASSERT_TRUE(!!manager.cacheDatabaseWriteQueue());
+		EXPECT_EQ(5u, manager.cacheDatabaseWriteQueue()->maxPendingOperations());
+
+		EXPECT_EQ(manager.cacheDatabaseWriteQueue(), fooCacheConfig.pDatabaseTuning->pWriteQueue.get());
+		EXPECT_EQ(manager.cacheDatabaseWriteQueue(), barCacheConfig.pDatabaseTuning->pWriteQueue.get());
 	}
 
 	// endregion
@@ -0,0 +1,38 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/CpuFeatures.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS CpuFeaturesTests
+
+	TEST(TEST_CLASS, FeatureDetectionIsDeterministic) {
+		for (auto feature : { CpuFeature::Avx2, CpuFeature::Avx512 })
+			EXPECT_EQ(IsCpuFeatureSupported(feature), IsCpuFeatureSupported(feature));
+	}
+
+	TEST(TEST_CLASS, Avx512SupportImpliesAvx2Support) {
+		// Act + Assert: all cpus with avx512 foundation instructions also support avx2
+		if (IsCpuFeatureSupported(CpuFeature::Avx512))
+			EXPECT_TRUE(IsCpuFeatureSupported(CpuFeature::Avx2));
+	}
+}}
@@ -0,0 +1,97 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/DurationHistogram.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS DurationHistogramTests
+
+	namespace {
+		void AssertBuckets(const DurationHistogram& histogram, const std::array<uint64_t, DurationHistogram::Num_Buckets>& expected) {
+			for (auto i = 0u; i < DurationHistogram::Num_Buckets; ++i)
+				EXPECT_EQ(expected[i], histogram.bucket(i)) << "bucket " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptyHistogram) {
+		// Act:
+		DurationHistogram histogram;
+
+		// Assert:
+		AssertBuckets(histogram, { { 0, 0, 0, 0 } });
+		EXPECT_EQ(0u, histogram.count());
+		EXPECT_EQ(0u, histogram.maxMillis());
+	}
+
+	TEST(TEST_CLASS, CanAddDurationToEachBucket) {
+		// Arrange:
+		DurationHistogram histogram;
+
+		// Act:
+		for (auto millis : { 0u, 9u, 10u, 99u, 100u, 999u, 1000u, 12345u })
+			histogram.add(millis);
+
+		// Assert: lower bounds are inclusive and upper bounds are exclusive
+		AssertBuckets(histogram, { { 2, 2, 2, 2 } });
+		EXPECT_EQ(8u, histogram.count());
+		EXPECT_EQ(12345u, histogram.maxMillis());
+	}
+
+	TEST(TEST_CLASS, MaxMillisIsNotDecreasedBySmallerDurations) {
+		// Arrange:
+		DurationHistogram histogram;
+
+		// Act:
+		histogram.add(50);
+		histogram.add(7);
+		histogram.add(20);
+
+		// Assert:
+		AssertBuckets(histogram, { { 1, 2, 0, 0 } });
+		EXPECT_EQ(3u, histogram.count());
+		EXPECT_EQ(50u, histogram.maxMillis());
+	}
+
+	TEST(TEST_CLASS, CanAddDurationsConcurrently) {
+		// Arrange:
+		constexpr auto Num_Threads = 4u;
+		constexpr auto Num_Durations_Per_Thread = 1000u;
+		DurationHistogram histogram;
+
+		// Act:
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.create_thread([&histogram, i] {
+				for (auto j = 0u; j < Num_Durations_Per_Thread; ++j)
+					histogram.add(i * Num_Durations_Per_Thread + j);
+			});
+		}
+
+		threads.join_all();
+
+		// Assert:
+		AssertBuckets(histogram, { { 10, 90, 900, 3000 } });
+		EXPECT_EQ(Num_Threads * Num_Durations_Per_Thread, histogram.count());
+		EXPECT_EQ(Num_Threads * Num_Durations_Per_Thread - 1, histogram.maxMillis());
+	}
+}}
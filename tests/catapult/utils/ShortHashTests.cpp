@@ -98,4 +98,101 @@ namespace catapult { namespace utils {
 	}
 
 	// endregion
+
+	// region ShortHashesSet
+
+	namespace {
+		std::vector<ShortHash> ToVector(const ShortHashesSet& shortHashes) {
+			return std::vector<ShortHash>(shortHashes.begin(), shortHashes.end());
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptyShortHashesSet) {
+		// Act:
+		ShortHashesSet shortHashes;
+
+		// Assert:
+		EXPECT_EQ(0u, shortHashes.size());
+		EXPECT_TRUE(shortHashes.empty());
+		EXPECT_FALSE(shortHashes.contains(ShortHash(0)));
+		EXPECT_EQ(ShortHashesSet::Npos, shortHashes.find(ShortHash(0)));
+	}
+
+	TEST(TEST_CLASS, CanCreateShortHashesSetFromInitializerList) {
+		// Act:
+		ShortHashesSet shortHashes{ ShortHash(30), ShortHash(10), ShortHash(20) };
+
+		// Assert:
+		EXPECT_EQ(3u, shortHashes.size());
+		EXPECT_FALSE(shortHashes.empty());
+		EXPECT_EQ(std::vector<ShortHash>({ ShortHash(10), ShortHash(20), ShortHash(30) }), ToVector(shortHashes));
+	}
+
+	TEST(TEST_CLASS, CanCreateShortHashesSetFromVector) {
+		// Act:
+		ShortHashesSet shortHashes(std::vector<ShortHash>{ ShortHash(30), ShortHash(10), ShortHash(20) });
+
+		// Assert:
+		EXPECT_EQ(3u, shortHashes.size());
+		EXPECT_EQ(std::vector<ShortHash>({ ShortHash(10), ShortHash(20), ShortHash(30) }), ToVector(shortHashes));
+	}
+
+	TEST(TEST_CLASS, ShortHashesSetIgnoresDuplicateShortHashes) {
+		// Act:
+		ShortHashesSet shortHashes{ ShortHash(30), ShortHash(10), ShortHash(30), ShortHash(20), ShortHash(10) };
+
+		// Assert:
+		EXPECT_EQ(3u, shortHashes.size());
+		EXPECT_EQ(std::vector<ShortHash>({ ShortHash(10), ShortHash(20), ShortHash(30) }), ToVector(shortHashes));
+	}
+
+	TEST(TEST_CLASS, ShortHashesSetFindReturnsSortedPositionOfContainedShortHashes) {
+		// Arrange:
+		ShortHashesSet shortHashes{ ShortHash(30), ShortHash(10), ShortHash(50), ShortHash(20), ShortHash(40) };
+
+		// Act + Assert:
+		EXPECT_EQ(0u, shortHashes.find(ShortHash(10)));
+		EXPECT_EQ(1u, shortHashes.find(ShortHash(20)));
+		EXPECT_EQ(2u, shortHashes.find(ShortHash(30)));
+		EXPECT_EQ(3u, shortHashes.find(ShortHash(40)));
+		EXPECT_EQ(4u, shortHashes.find(ShortHash(50)));
+	}
+
+	TEST(TEST_CLASS, ShortHashesSetFindReturnsNposForOtherShortHashes) {
+		// Arrange:
+		ShortHashesSet shortHashes{ ShortHash(30), ShortHash(10), ShortHash(50), ShortHash(20), ShortHash(40) };
+
+		// Act + Assert: check values smaller than, between and larger than all contained short hashes
+		for (auto rawShortHash : { 0u, 9u, 11u, 25u, 39u, 41u, 51u, 0xFFFF'FFFFu })
+			EXPECT_EQ(ShortHashesSet::Npos, shortHashes.find(ShortHash(rawShortHash))) << rawShortHash;
+	}
+
+	TEST(TEST_CLASS, ShortHashesSetContainsReturnsTrueOnlyForContainedShortHashes) {
+		// Arrange:
+		std::vector<ShortHash> rawShortHashes;
+		for (auto i = 0u; i < 100; ++i)
+			rawShortHashes.push_back(ShortHash(3 * i + 1));
+
+		ShortHashesSet shortHashes(std::move(rawShortHashes));
+
+		// Act + Assert:
+		for (auto i = 0u; i < 310; ++i)
+			EXPECT_EQ(1 == i % 3 && i < 300, shortHashes.contains(ShortHash(i))) << i;
+	}
+
+	TEST(TEST_CLASS, ShortHashesSetsWithSameShortHashesAreEqual) {
+		// Arrange:
+		ShortHashesSet shortHashes1{ ShortHash(30), ShortHash(10), ShortHash(20) };
+		ShortHashesSet shortHashes2{ ShortHash(20), ShortHash(30), ShortHash(10), ShortHash(10) };
+		ShortHashesSet shortHashes3{ ShortHash(20), ShortHash(30) };
+
+		// Act + Assert:
+		EXPECT_TRUE(shortHashes1 == shortHashes2);
+		EXPECT_FALSE(shortHashes1 != shortHashes2);
+
+		EXPECT_FALSE(shortHashes1 == shortHashes3);
+		EXPECT_TRUE(shortHashes1 != shortHashes3);
+	}
+
+	// endregion
 }}
@@ -76,6 +76,9 @@ namespace catapult { namespace local {
 		EXPECT_TRUE(test::HasCounter(counters, "NODES")) << "node container counters";
 		EXPECT_TRUE(test::HasCounter(counters, "BAN ACT")) << "banned nodes container counters";
 		EXPECT_TRUE(test::HasCounter(counters, "BAN ALL")) << "banned nodes container counters";
+		EXPECT_TRUE(test::HasCounter(counters, "BLKCACHE HIT")) << "block storage counters";
+		EXPECT_TRUE(test::HasCounter(counters, "CMT LT TEN MS")) << "cache commit counters";
+		EXPECT_TRUE(test::HasCounter(counters, "LCK MAX MS")) << "cache commit counters";
 	}
 
 	// endregion
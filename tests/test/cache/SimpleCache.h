@@ -22,6 +22,7 @@
 #include "catapult/cache/CacheConfiguration.h"
 #include "catapult/cache/ReadOnlySimpleCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
+#include "catapult/cache/SubCachePlugin.h"
 #include "catapult/cache/SynchronizedCache.h"
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/io/Stream.h"
@@ -178,6 +179,11 @@ namespace catapult { namespace test {
 			(*m_pMerkleRoot)[0] = static_cast<uint8_t>(height.unwrap());
 		}
 
+		/// Recalculates the merkle root given the specified chain \a height if supported (\a subtreeRunner is ignored).
+		void updateMerkleRoot(Height height, const utils::ParallelRunner&) {
+			updateMerkleRoot(height);
+		}
+
 		/// Sets the merkle root (\a merkleRoot) if supported.
 		/// \note There must not be any pending changes.
 		void setMerkleRoot(const Hash256& merkleRoot) {
@@ -328,6 +328,77 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region loadBlockElements
+
+	private:
+		static void AssertCanLoadBlockElements(
+				size_t maxBlocks,
+				size_t maxBytes,
+				Height startHeight,
+				const std::vector<uint64_t>& expectedHeights) {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			// Act:
+			auto blockElements = pStorage->loadBlockElements(startHeight, maxBlocks, maxBytes);
+
+			// Assert:
+			ASSERT_EQ(expectedHeights.size(), blockElements.size());
+			for (auto i = 0u; i < expectedHeights.size(); ++i) {
+				auto pExpectedBlockElement = pStorage->loadBlockElement(Height(expectedHeights[i]));
+				AssertEqual(*pExpectedBlockElement, *blockElements[i]);
+			}
+		}
+
+		static size_t CalculateTotalBlockSize(const io::BlockStorage& storage, Height startHeight, size_t numBlocks) {
+			size_t totalSize = 0;
+			for (auto i = 0u; i < numBlocks; ++i)
+				totalSize += storage.loadBlock(startHeight + Height(i))->Size;
+
+			return totalSize;
+		}
+
+	public:
+		static void AssertLoadBlockElements_LoadsZeroBlockElementsWhenRequestHeightIsZero() {
+			AssertCanLoadBlockElements(5, 1'000'000, Height(0), {});
+		}
+
+		static void AssertLoadBlockElements_LoadsZeroBlockElementsWhenRequestHeightIsLargerThanLocalHeight() {
+			AssertCanLoadBlockElements(1, 1'000'000, Height(11), {});
+			AssertCanLoadBlockElements(5, 1'000'000, Height(23), {});
+		}
+
+		static void AssertLoadBlockElements_LoadsAtMostMaxBlocks() {
+			AssertCanLoadBlockElements(1, 1'000'000, Height(5), { 5 });
+			AssertCanLoadBlockElements(3, 1'000'000, Height(2), { 2, 3, 4 });
+		}
+
+		static void AssertLoadBlockElements_LoadsAreBoundedByLastBlock() {
+			AssertCanLoadBlockElements(10, 1'000'000, Height(8), { 8, 9, 10 });
+		}
+
+		static void AssertLoadBlockElements_LoadsAreBoundedByMaxBytes() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+			auto maxBytes = CalculateTotalBlockSize(*pStorage, Height(4), 3);
+
+			// Act:
+			auto blockElements1 = pStorage->loadBlockElements(Height(4), 10, maxBytes);
+			auto blockElements2 = pStorage->loadBlockElements(Height(4), 10, maxBytes - 1);
+
+			// Assert:
+			ASSERT_EQ(3u, blockElements1.size());
+			ASSERT_EQ(2u, blockElements2.size());
+			for (auto i = 0u; i < blockElements1.size(); ++i)
+				EXPECT_EQ(Height(4 + i), blockElements1[i]->Block.Height) << i;
+		}
+
+		static void AssertLoadBlockElements_AlwaysLoadsFirstBlockElement() {
+			AssertCanLoadBlockElements(10, 0, Height(7), { 7 });
+		}
+
+		// endregion
+
 		// region saveBlock - statements
 
 	private:
@@ -633,6 +704,13 @@ namespace catapult { namespace test {
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadHashesFrom_LoadsAreBoundedByLastBlock) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadHashesFrom_LoadsCanCrossIndexFileBoundary) \
 	\
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockElements_LoadsZeroBlockElementsWhenRequestHeightIsZero) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockElements_LoadsZeroBlockElementsWhenRequestHeightIsLargerThanLocalHeight) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockElements_LoadsAtMostMaxBlocks) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockElements_LoadsAreBoundedByLastBlock) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockElements_LoadsAreBoundedByMaxBytes) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlockElements_AlwaysLoadsFirstBlockElement) \
+	\
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveBlockWithoutStatements) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveBlockWithOnlyTransactionStatements) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveBlockWithOnlyAddressResolutions) \
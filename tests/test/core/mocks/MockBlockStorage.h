@@ -56,6 +56,10 @@ namespace catapult { namespace mocks {
 			CATAPULT_THROW_RUNTIME_ERROR("loadBlockElement - not supported in mock");
 		}
 
+		std::vector<std::shared_ptr<const model::BlockElement>> loadBlockElements(Height, size_t, size_t) const override {
+			CATAPULT_THROW_RUNTIME_ERROR("loadBlockElements - not supported in mock");
+		}
+
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height) const override {
 			CATAPULT_THROW_RUNTIME_ERROR("loadBlockStatementData - not supported in mock");
 		}
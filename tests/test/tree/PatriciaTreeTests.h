@@ -1645,6 +1645,200 @@ namespace catapult { namespace test {
 		}
 
 		// endregion
+
+		// region setAll
+
+	private:
+		using KeyValuePairs = std::vector<std::pair<uint32_t, std::string>>;
+
+		static KeyValuePairs GenerateKeyValuePairs(size_t count, size_t seed) {
+			KeyValuePairs pairs;
+			for (auto i = 0u; i < count; ++i) {
+				// multiply by a large odd constant to spread the keys across the tree
+				pairs.emplace_back(static_cast<uint32_t>((seed + i) * 2'654'435'761u), std::to_string(seed + i));
+			}
+
+			return pairs;
+		}
+
+		template<typename TTree>
+		static void SetAll(TTree& tree, const KeyValuePairs& pairs) {
+			std::vector<const std::pair<uint32_t, std::string>*> pairPointers;
+			for (const auto& pair : pairs)
+				pairPointers.push_back(&pair);
+
+			tree.setAll(pairPointers);
+		}
+
+		static void AssertSetAllIsEquivalentToSet(const KeyValuePairs& seedPairs, const KeyValuePairs& pairs) {
+			// Arrange: seed both trees, save them and reload them so that they are composed of data source nodes
+			TestContext context(tree::DataSourceVerbosity::Off);
+			TestContext context2(tree::DataSourceVerbosity::Off);
+			for (auto* pContext : { &context, &context2 }) {
+				for (const auto& pair : seedPairs)
+					pContext->tree().set(pair.first, pair.second);
+
+				pContext->tree().saveAll();
+				pContext->tree().tryLoad(pContext->tree().root());
+			}
+
+			for (const auto& pair : pairs)
+				context.tree().set(pair.first, pair.second);
+
+			// Act:
+			SetAll(context2.tree(), pairs);
+
+			// Assert:
+			EXPECT_EQ(context.tree().root(), context2.tree().root());
+		}
+
+	public:
+		static void AssertSetAllHasNoEffectWhenPairsAreEmpty() {
+			AssertSetAllIsEquivalentToSet(GenerateKeyValuePairs(100, 0), {});
+		}
+
+		static void AssertSetAllCanInsertSingleValue() {
+			AssertSetAllIsEquivalentToSet({}, { { 0x64'6F'67'01, "alpha" } });
+			AssertSetAllIsEquivalentToSet(GenerateKeyValuePairs(100, 0), { { 0x64'6F'67'01, "alpha" } });
+		}
+
+		static void AssertSetAllCanInsertValuesIntoEmptyTree() {
+			AssertSetAllIsEquivalentToSet({}, GenerateKeyValuePairs(1000, 0));
+		}
+
+		static void AssertSetAllCanInsertValuesIntoTreeWithRootLeafNode() {
+			// Assert: leaf is split
+			AssertSetAllIsEquivalentToSet({ { 0x64'6F'67'01, "alpha" } }, GenerateKeyValuePairs(100, 0));
+
+			// - leaf is replaced
+			auto pairs = GenerateKeyValuePairs(100, 0);
+			AssertSetAllIsEquivalentToSet({ { pairs[50].first, "alpha" } }, pairs);
+		}
+
+		static void AssertSetAllCanInsertValuesIntoTreeWithRootExtensionNode() {
+			// Arrange: all seed keys share the first two nibbles, so the root node has a path
+			KeyValuePairs seedPairs;
+			for (auto i = 0u; i < 100; ++i)
+				seedPairs.emplace_back(0x64'00'00'00 | static_cast<uint32_t>(i * 2'654'435'761u >> 8), std::to_string(i));
+
+			// Assert: pairs that do and do not share the root path
+			AssertSetAllIsEquivalentToSet(seedPairs, GenerateKeyValuePairs(100, 1000));
+			AssertSetAllIsEquivalentToSet(seedPairs, { { 0x64'6F'67'01, "alpha" }, { 0x64'6F'67'02, "beta" } });
+		}
+
+		static void AssertSetAllCanUpdateAndInsertValues() {
+			// Arrange: update half of the existing values and insert new ones
+			auto pairs = GenerateKeyValuePairs(200, 500);
+			for (auto& pair : pairs)
+				pair.second += "_updated";
+
+			// Assert:
+			AssertSetAllIsEquivalentToSet(GenerateKeyValuePairs(1000, 0), pairs);
+		}
+
+		static void AssertSetAllUsesLastValueWhenKeyIsSetMultipleTimes() {
+			// Arrange:
+			KeyValuePairs pairs{
+				{ 0x64'6F'67'01, "alpha" },
+				{ 0x74'6F'67'02, "beta" },
+				{ 0x64'6F'67'01, "gamma" },
+				{ 0x64'6F'67'01, "zeta" }
+			};
+
+			// Assert:
+			AssertSetAllIsEquivalentToSet({}, pairs);
+			AssertSetAllIsEquivalentToSet(GenerateKeyValuePairs(100, 0), pairs);
+		}
+
+		// endregion
+
+		// region hashAll
+
+	private:
+		template<typename TTree>
+		static void SetMany(TTree& tree, size_t count, size_t seed) {
+			for (auto i = 0u; i < count; ++i) {
+				// multiply by a large odd constant to spread the keys across the tree
+				auto key = static_cast<uint32_t>((seed + i) * 2'654'435'761u);
+				tree.set(key, std::to_string(seed + i));
+			}
+		}
+
+		template<typename TTree>
+		static std::vector<size_t> HashAllRecordingCounts(TTree& tree) {
+			std::vector<size_t> counts;
+			tree.hashAll([&counts](auto count, const auto& callback) {
+				counts.push_back(count);
+				for (auto i = 0u; i < count; ++i)
+					callback(i);
+			});
+			return counts;
+		}
+
+	public:
+		static void AssertHashAllDoesNotInvokeRunnerWhenTreeHasNoSubtrees() {
+			// Arrange:
+			TestContext context(tree::DataSourceVerbosity::Off);
+			context.tree().set(0x64'6F'67'01, "alpha");
+			context.tree().set(0x74'6F'67'02, "beta");
+			auto expectedRoot = context.tree().root();
+
+			TestContext context2(tree::DataSourceVerbosity::Off);
+			context2.tree().set(0x64'6F'67'01, "alpha");
+			context2.tree().set(0x74'6F'67'02, "beta");
+
+			// Act:
+			auto counts = HashAllRecordingCounts(context2.tree());
+
+			// Assert: root branch only has leaves, so there are no subtrees to hash
+			EXPECT_TRUE(counts.empty());
+			EXPECT_EQ(expectedRoot, context2.tree().root());
+		}
+
+		static void AssertHashAllCalculatesSameRootAsSequentialHashing() {
+			// Arrange:
+			TestContext context(tree::DataSourceVerbosity::Off);
+			SetMany(context.tree(), 1000, 0);
+			auto expectedRoot = context.tree().root();
+
+			TestContext context2(tree::DataSourceVerbosity::Off);
+			SetMany(context2.tree(), 1000, 0);
+
+			// Act:
+			auto counts = HashAllRecordingCounts(context2.tree());
+
+			// Assert:
+			ASSERT_EQ(1u, counts.size());
+			EXPECT_LT(1u, counts[0]);
+			EXPECT_GE(256u, counts[0]);
+			EXPECT_EQ(expectedRoot, context2.tree().root());
+		}
+
+		static void AssertHashAllCalculatesSameRootAsSequentialHashingAfterSave() {
+			// Arrange: modify a saved tree so that it is composed of both loaded and in-memory nodes
+			TestContext context(tree::DataSourceVerbosity::Off);
+			SetMany(context.tree(), 1000, 0);
+			context.tree().saveAll();
+			context.tree().tryLoad(context.tree().root());
+			SetMany(context.tree(), 100, 2000);
+			auto expectedRoot = context.tree().root();
+
+			TestContext context2(tree::DataSourceVerbosity::Off);
+			SetMany(context2.tree(), 1000, 0);
+			context2.tree().saveAll();
+			context2.tree().tryLoad(context2.tree().root());
+			SetMany(context2.tree(), 100, 2000);
+
+			// Act:
+			auto counts = HashAllRecordingCounts(context2.tree());
+
+			// Assert:
+			ASSERT_EQ(1u, counts.size());
+			EXPECT_LT(1u, counts[0]);
+			EXPECT_EQ(expectedRoot, context2.tree().root());
+		}
+
+		// endregion
 	};
 
 #define MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, TEST_NAME) \
@@ -1712,5 +1906,17 @@ namespace catapult { namespace test {
 	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanSetArbitraryRoot) \
 	\
-	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanClearTree)
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanClearTree) \
+	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetAllHasNoEffectWhenPairsAreEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetAllCanInsertSingleValue) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetAllCanInsertValuesIntoEmptyTree) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetAllCanInsertValuesIntoTreeWithRootLeafNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetAllCanInsertValuesIntoTreeWithRootExtensionNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetAllCanUpdateAndInsertValues) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetAllUsesLastValueWhenKeyIsSetMultipleTimes) \
+	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, HashAllDoesNotInvokeRunnerWhenTreeHasNoSubtrees) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, HashAllCalculatesSameRootAsSequentialHashing) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, HashAllCalculatesSameRootAsSequentialHashingAfterSave)
 }}
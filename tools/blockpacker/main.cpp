@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/MoveBlockFiles.h"
+#include "catapult/io/PackFileBlockStorage.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace tools { namespace blockpacker {
+
+	namespace {
+		class BlockPackerTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Block Packer Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("source,s",
+						OptionsValue<std::string>(m_sourceDirectory)->required(),
+						"path to the data directory containing one file per block");
+				optionsBuilder("destination,d",
+						OptionsValue<std::string>(m_destinationDirectory)->required(),
+						"path to the data directory that will contain the pack files");
+				optionsBuilder("batchSize,b",
+						OptionsValue<uint32_t>(m_batchSize)->default_value(10'000),
+						"number of blocks to copy before reporting progress");
+			}
+
+			int run(const Options&) override {
+				if (!boost::filesystem::is_directory(m_sourceDirectory))
+					CATAPULT_THROW_INVALID_ARGUMENT_1("source directory does not exist", m_sourceDirectory);
+
+				if (0 == m_batchSize)
+					CATAPULT_THROW_INVALID_ARGUMENT("batch size must be nonzero");
+
+				boost::filesystem::create_directories(m_destinationDirectory);
+				if (boost::filesystem::equivalent(m_sourceDirectory, m_destinationDirectory))
+					CATAPULT_THROW_INVALID_ARGUMENT_1("source and destination directories must be different", m_destinationDirectory);
+
+				io::FileBlockStorage sourceStorage(m_sourceDirectory);
+				io::PackFileBlockStorage destinationStorage(m_destinationDirectory);
+
+				// resume an interrupted migration from the first block that has not been packed yet
+				auto sourceHeight = sourceStorage.chainHeight();
+				auto height = destinationStorage.chainHeight() + Height(1);
+				if (height > sourceHeight) {
+					CATAPULT_LOG(info) << "destination storage is up to date at height " << destinationStorage.chainHeight();
+					return 0;
+				}
+
+				CATAPULT_LOG(info) << "packing blocks " << height << " to " << sourceHeight;
+				while (height <= sourceHeight) {
+					auto endHeight = std::min(sourceHeight, height + Height(m_batchSize - 1));
+					io::CopyBlockFiles(sourceStorage, destinationStorage, height, endHeight);
+
+					CATAPULT_LOG(info) << "packed blocks up to height " << endHeight << " / " << sourceHeight;
+					height = endHeight + Height(1);
+				}
+
+				return 0;
+			}
+
+		private:
+			std::string m_sourceDirectory;
+			std::string m_destinationDirectory;
+			uint32_t m_batchSize;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::blockpacker::BlockPackerTool tool;
+	return catapult::tools::ToolMain(argc, argv, tool);
+}